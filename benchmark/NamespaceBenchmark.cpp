@@ -0,0 +1,334 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <CLI11.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <net/if.h>
+#include <sched.h>
+#include <stdexcept>
+#include <string>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "utils/file/temporary/TemporaryFile.h"
+#include "utils/helper/Errno.h"
+
+#include "generator/ConfigGenerator.h"
+
+using namespace benchmarking;
+using namespace utils::file;
+using namespace utils::helper;
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/* Exit code telling ctest that the test was skipped (SKIP_RETURN_CODE) */
+constexpr int EXIT_SKIPPED = 77;
+
+/* Sysctl written by the layer commands. It exists in every network
+ * namespace and root of a user namespace owning it can write it */
+constexpr const char* const LAYER_PATHNAME = "/proc/sys/net/ipv4/ip_forward";
+
+struct CommandLine {
+    std::string service = NETWORKSERVICE_PATH;
+    std::vector<std::string> passes;
+    std::size_t minRules        = 10;
+    std::size_t maxRules        = 1000;
+    std::size_t factor          = 10;
+    std::size_t commandsPerRule = 2;
+    std::size_t rulesPerItem    = 10;
+    std::size_t repetitions     = 3;
+};
+
+struct Result {
+    ConfigGenerator::Sizes sizes {};
+    std::size_t nbCommands = 0;
+    double durationMs      = std::numeric_limits<double>::max();
+};
+
+CommandLine parseCommandLine(int argc, char** argv)
+{
+    CLI::App app("Apply synthetic configurations of growing size with the "
+                 "service against the real kernel, from a user and network "
+                 "namespace where no root privileges are needed, and report "
+                 "the end-to-end apply latency");
+
+    CommandLine commandLine;
+    app.add_option("--service", commandLine.service, "Service executable to run")
+        ->check(CLI::ExistingFile);
+    app.add_option("-O,--optimize",
+                   commandLine.passes,
+                   "Optimization pass given to the service. Repeatable");
+    app.add_option("--min-rules", commandLine.minRules, "Rules of the first step")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--max-rules", commandLine.maxRules, "Rules of the last step")
+        ->check(CLI::PositiveNumber);
+    app.add_option(
+           "--factor", commandLine.factor, "Growth from one step to the next")
+        ->check(CLI::Range(2, 1000));
+    app.add_option(
+           "--commands-per-rule", commandLine.commandsPerRule, "Commands per rule")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--rules-per-item",
+                   commandLine.rulesPerItem,
+                   "One interface and one layer command every that many rules")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--repetitions",
+                   commandLine.repetitions,
+                   "Runs per step; the fastest one is reported")
+        ->check(CLI::PositiveNumber);
+
+    try {
+        app.parse(argc, argv);
+    }
+    catch (const CLI::ParseError& e) {
+        std::exit(app.exit(e));
+    }
+
+    return commandLine;
+}
+
+void writeFile(const std::string& pathname, const std::string& content)
+{
+    std::ofstream stream(pathname);
+    stream << content;
+    stream.close();
+
+    if (stream.fail()) {
+        throw std::runtime_error("Failed to write " + pathname);
+    }
+}
+
+/* Become root of a new user namespace owning a new network namespace. The
+ * caller gets CAP_NET_ADMIN over the latter without being privileged */
+void enterNamespaces()
+{
+    const uid_t uid = getuid();
+    const gid_t gid = getgid();
+
+    if (unshare(CLONE_NEWUSER | CLONE_NEWNET) == -1) {
+        throw std::runtime_error(Errno::toString("unshare()", errno));
+    }
+
+    // Unprivileged processes must give up setgroups() to map their group
+    writeFile("/proc/self/setgroups", "deny");
+    writeFile("/proc/self/uid_map", "0 " + std::to_string(uid) + " 1");
+    writeFile("/proc/self/gid_map", "0 " + std::to_string(gid) + " 1");
+}
+
+/* Start each run from a pristine network namespace (only "lo" exists, no
+ * rules). The previous one is released with its last reference */
+void renewNetworkNamespace()
+{
+    if (unshare(CLONE_NEWNET) == -1) {
+        throw std::runtime_error(Errno::toString("unshare(CLONE_NEWNET)", errno));
+    }
+}
+
+/* Run a program in a child process and return its exit status or -1 */
+int run(std::vector<std::string> arguments)
+{
+    std::vector<char*> argv;
+    for (std::string& argument : arguments) {
+        argv.push_back(argument.data());
+    }
+    argv.push_back(nullptr);
+
+    const pid_t pid = fork();
+    if (pid == -1) {
+        throw std::runtime_error(Errno::toString("fork()", errno));
+    }
+
+    if (pid == 0) {
+        (void)execv(argv[0], argv.data());
+        _exit(EXIT_FAILURE);
+    }
+
+    int status = 0;
+    if (waitpid(pid, &status, 0) == -1) {
+        throw std::runtime_error(Errno::toString("waitpid()", errno));
+    }
+
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+/* Tell why the generated configurations can't be applied on this host or
+ * return an empty string */
+std::string checkHost()
+{
+    for (const char* const program : {"/sbin/ip", "/sbin/iptables"}) {
+        if (access(program, X_OK) == -1) {
+            return std::string(program) + " is missing";
+        }
+    }
+
+    try {
+        enterNamespaces();
+    }
+    catch (const std::runtime_error& e) {
+        return std::string("Can't create namespaces: ") + e.what();
+    }
+
+    if (run({"/sbin/ip", "link", "add", "probe", "type", "dummy"}) != 0) {
+        return "Dummy interfaces are not supported";
+    }
+
+    // An installed iptables may still be unusable here (E.g: its backend is
+    // not available in a user namespace): add then delete a rule to know
+    const std::vector<std::string> rule = {"INPUT", "-s", "10.0.0.1", "-j", "DROP"};
+    for (const char* const action : {"-A", "-D"}) {
+        std::vector<std::string> arguments = {"/sbin/iptables", action};
+        arguments.insert(arguments.end(), rule.begin(), rule.end());
+        if (run(arguments) != 0) {
+            return "iptables can't change rules in a network namespace";
+        }
+    }
+
+    return {};
+}
+
+/* Check that the configuration was really applied */
+void checkKernel(const ConfigGenerator::Sizes& sizes)
+{
+    const std::string lastInterface
+        = "bench" + std::to_string(sizes.nbInterfaces - 1);
+    if (if_nametoindex(lastInterface.c_str()) == 0) {
+        throw std::runtime_error(lastInterface + " was not created");
+    }
+
+    std::ifstream stream(LAYER_PATHNAME);
+    std::string value;
+    stream >> value;
+    if (value != std::to_string(sizes.nbLayerCommands - 1)) {
+        throw std::runtime_error(std::string(LAYER_PATHNAME) + " is " + value);
+    }
+}
+
+/* Apply the configuration several times and keep the fastest run */
+Result best(const CommandLine& commandLine, const ConfigGenerator::Sizes& sizes)
+{
+    const ConfigGenerator generator(sizes, LAYER_PATHNAME);
+    const TemporaryFile configFile;
+    {
+        std::ofstream stream(configFile.pathname());
+        generator.writeJson(stream);
+    }
+
+    std::vector<std::string> arguments = {commandLine.service,
+                                          "--config",
+                                          configFile.pathname(),
+                                          "--secure",
+                                          "false",
+                                          "--log-level",
+                                          "error"};
+    for (const std::string& pass : commandLine.passes) {
+        arguments.insert(arguments.end(), {"--optimize", pass});
+    }
+
+    Result result = {sizes, generator.nbCommands()};
+    for (std::size_t index = 0; index < commandLine.repetitions; ++index) {
+        renewNetworkNamespace();
+
+        const Clock::time_point start = Clock::now();
+        if (run(arguments) != EXIT_SUCCESS) {
+            throw std::runtime_error("Failed to apply " + configFile.pathname());
+        }
+        const std::chrono::duration<double, std::milli> duration
+            = Clock::now() - start;
+
+        checkKernel(sizes);
+        result.durationMs = std::min(result.durationMs, duration.count());
+    }
+
+    return result;
+}
+
+void printHeader()
+{
+    std::cout << std::setw(8) << "rules" << std::setw(8) << "ifaces" << std::setw(8)
+              << "layers" << std::setw(9) << "commands" << std::setw(12)
+              << "apply ms" << std::setw(12) << "us/cmd" << "\n";
+}
+
+void printResult(const Result& result)
+{
+    constexpr double US_PER_MS = 1e3;
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(8)
+              << result.sizes.nbRules << std::setw(8) << result.sizes.nbInterfaces
+              << std::setw(8) << result.sizes.nbLayerCommands << std::setw(9)
+              << result.nbCommands << std::setw(12) << result.durationMs
+              << std::setw(12)
+              << result.durationMs * US_PER_MS
+                     / static_cast<double>(result.nbCommands)
+              << std::endl;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const CommandLine commandLine = parseCommandLine(argc, argv);
+
+    const std::string reason = checkHost();
+    if (!reason.empty()) {
+        std::cerr << "Skipped: " << reason << std::endl;
+        return EXIT_SKIPPED;
+    }
+
+    printHeader();
+
+    try {
+        for (std::size_t nbRules = commandLine.minRules;
+             nbRules <= commandLine.maxRules;
+             nbRules *= commandLine.factor) {
+            const std::size_t nbItems = std::max<std::size_t>(
+                1, nbRules / commandLine.rulesPerItem);
+
+            const ConfigGenerator::Sizes sizes
+                = {nbItems, nbItems, nbRules, commandLine.commandsPerRule};
+            printResult(best(commandLine, sizes));
+        }
+    }
+    catch (const std::runtime_error& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,382 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <CLI11.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "plugins/config/Config.h"
+#include "plugins/firewall/RuleFactory.h"
+#include "plugins/logger/Logger.h"
+#include "plugins/network/Network.h"
+#include "plugins/optimizer/Optimizer.h"
+#include "plugins/reorderer/Reorderer.h"
+#include "plugins/simulator/SimulatedNetwork.h"
+#include "plugins/simulator/SimulatedRuleFactory.h"
+#include "plugins/simulator/SimulatedWriter.h"
+#include "plugins/transaction/Transaction.h"
+
+#include "service/NetworkService.h"
+
+#include "utils/command/executor/Executor.h"
+#include "utils/file/reader/Reader.h"
+#include "utils/file/temporary/TemporaryFile.h"
+#include "utils/file/writer/Writer.h"
+#include "utils/helper/AllocationCounter.h"
+
+#include "fake/NullOsal.h"
+#include "generator/ConfigGenerator.h"
+
+using namespace benchmarking;
+using namespace service;
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::logger;
+using namespace service::plugins::network;
+using namespace service::plugins::optimizer;
+using namespace service::plugins::profiler;
+using namespace service::plugins::reorderer;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+using namespace service::plugins::transaction;
+
+using namespace utils::command;
+using namespace utils::file;
+using namespace utils::helper;
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct CommandLine {
+    std::size_t minRules        = 100;
+    std::size_t maxRules        = 100000;
+    std::size_t factor          = 10;
+    std::size_t commandsPerRule = 2;
+    std::size_t rulesPerItem    = 100;
+    std::size_t repetitions     = 3;
+    double maxGrowth            = 2.0;
+    bool optimize               = false;
+    bool simulate               = false;
+};
+
+/* Time and allocations of each phase reported by the core service */
+class PhaseProfiler : public IProfiler {
+
+public:
+    struct Measure {
+        double durationMs       = 0.0;
+        std::size_t allocations = 0;
+    };
+
+    void startPhase(const std::string& phaseName) const override
+    {
+        m_current[phaseName] = {Clock::now(), AllocationCounter::count()};
+    }
+
+    void stopPhase(const std::string& phaseName) const override
+    {
+        const auto& [start, allocations] = m_current.at(phaseName);
+
+        const std::chrono::duration<double, std::milli> duration
+            = Clock::now() - start;
+
+        Measure& measure = m_measures[phaseName];
+        measure.durationMs += duration.count();
+        measure.allocations += AllocationCounter::count() - allocations;
+    }
+
+    /* Sum of the measures of the given phases */
+    [[nodiscard]] Measure sum(const std::vector<std::string>& phaseNames) const
+    {
+        Measure total;
+        for (const std::string& phaseName : phaseNames) {
+            const auto it = m_measures.find(phaseName);
+            if (it != m_measures.end()) {
+                total.durationMs += it->second.durationMs;
+                total.allocations += it->second.allocations;
+            }
+        }
+
+        return total;
+    }
+
+private:
+    using Start = std::pair<Clock::time_point, std::size_t>;
+
+    mutable std::map<std::string, Start> m_current;
+    mutable std::map<std::string, Measure> m_measures;
+};
+
+struct Result {
+    ConfigGenerator::Sizes sizes {};
+    std::size_t nbCommands = 0;
+    PhaseProfiler::Measure load;
+    PhaseProfiler::Measure plan;
+    PhaseProfiler::Measure apply;
+
+    /* Time charged to the simulated kernel (see --simulate) */
+    double kernelMs = 0.0;
+};
+
+CommandLine parseCommandLine(int argc, char** argv)
+{
+    CLI::App app("Apply synthetic configurations of growing size against a "
+                 "backend that executes nothing (or a simulated kernel) and "
+                 "report what each phase of the service costs");
+
+    CommandLine commandLine;
+    app.add_option("--min-rules", commandLine.minRules, "Rules of the first step")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--max-rules", commandLine.maxRules, "Rules of the last step")
+        ->check(CLI::PositiveNumber);
+    app.add_option(
+           "--factor", commandLine.factor, "Growth from one step to the next")
+        ->check(CLI::Range(2, 1000));
+    app.add_option(
+           "--commands-per-rule", commandLine.commandsPerRule, "Commands per rule")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--rules-per-item",
+                   commandLine.rulesPerItem,
+                   "One interface and one layer command every that many rules")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--repetitions",
+                   commandLine.repetitions,
+                   "Runs per step; the fastest one is reported")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--max-growth",
+                   commandLine.maxGrowth,
+                   "Fail when the cost per command of a phase grows more than "
+                   "this from one step to the next");
+    app.add_flag("--optimize", commandLine.optimize, "Run all optimization passes");
+    app.add_flag("--simulate",
+                 commandLine.simulate,
+                 "Apply commands to a simulated kernel and report its cost");
+
+    try {
+        app.parse(argc, argv);
+    }
+    catch (const CLI::ParseError& e) {
+        std::exit(app.exit(e));
+    }
+
+    return commandLine;
+}
+
+Result run(const CommandLine& commandLine, const ConfigGenerator::Sizes& sizes)
+{
+    const ConfigGenerator generator(sizes);
+    const TemporaryFile configFile;
+    {
+        std::ofstream stream(configFile.pathname());
+        generator.writeJson(stream);
+    }
+
+    unsigned int passes = Optimizer::Passes::NONE;
+    if (commandLine.optimize) {
+        passes = Optimizer::Passes::IPTABLES | Optimizer::Passes::CIDR
+                 | Optimizer::Passes::IPSET | Optimizer::Passes::NFT_VMAP;
+    }
+
+    const NullOsal osal;
+    const Executor executor(osal, Executor::Flags::WAIT_COMMAND);
+    const Kernel kernel(CostModel {});
+
+    std::unique_ptr<IWriter> writer;
+    std::unique_ptr<INetwork> network;
+    std::unique_ptr<IRuleFactory> ruleFactory;
+    if (commandLine.simulate) {
+        writer      = std::make_unique<SimulatedWriter>(kernel);
+        network     = std::make_unique<SimulatedNetwork>(kernel);
+        ruleFactory = std::make_unique<SimulatedRuleFactory>(kernel);
+    }
+    else {
+        writer      = std::make_unique<Writer>();
+        network     = std::make_unique<Network>(executor, *writer);
+        ruleFactory = std::make_unique<RuleFactory>(executor);
+    }
+
+    const Reader reader;
+    const Logger logger(ILogger::Level::ERROR);
+    const Config config(reader);
+    const PhaseProfiler profiler;
+    const Transaction transaction(executor, *writer, false);
+    const Optimizer optimizer(*writer, static_cast<Optimizer::Passes>(passes));
+    const Reorderer reorderer(executor, *writer, false);
+
+    const NetworkService::NetworkServiceParams params({logger,
+                                                       config,
+                                                       *network,
+                                                       *ruleFactory,
+                                                       profiler,
+                                                       transaction,
+                                                       optimizer,
+                                                       reorderer});
+    const NetworkService networkService(params);
+    if (networkService.applyConfig(configFile.pathname()) != EXIT_SUCCESS) {
+        throw std::runtime_error("Failed to apply " + configFile.pathname());
+    }
+
+    return {sizes,
+            generator.nbCommands(),
+            profiler.sum({"load"}),
+            profiler.sum({"optimize", "createRules"}),
+            profiler.sum({"checkInterfaces",
+                          "applyLayerCommands",
+                          "applyInterfaceCommands",
+                          "applyRules"}),
+            std::chrono::duration<double, std::milli>(kernel.elapsed()).count()};
+}
+
+/* Keep the fastest run */
+Result best(const CommandLine& commandLine, const ConfigGenerator::Sizes& sizes)
+{
+    Result result = run(commandLine, sizes);
+    for (std::size_t index = 1; index < commandLine.repetitions; ++index) {
+        const Result other = run(commandLine, sizes);
+        for (auto measure : {&Result::load, &Result::plan, &Result::apply}) {
+            double& durationMs = (result.*measure).durationMs;
+            durationMs = std::min(durationMs, (other.*measure).durationMs);
+        }
+
+        result.kernelMs = std::min(result.kernelMs, other.kernelMs);
+    }
+
+    return result;
+}
+
+double nsPerCommand(const PhaseProfiler::Measure& measure, std::size_t nbCommands)
+{
+    constexpr double NS_PER_MS = 1e6;
+    return measure.durationMs * NS_PER_MS / static_cast<double>(nbCommands);
+}
+
+void printHeader(const CommandLine& commandLine)
+{
+    std::cout << std::setw(8) << "rules" << std::setw(8) << "ifaces" << std::setw(8)
+              << "layers" << std::setw(9) << "commands" << std::setw(11) << "load ms"
+              << std::setw(11) << "plan ms" << std::setw(11) << "apply ms"
+              << std::setw(11) << "allocs" << std::setw(11) << "ns/cmd"
+              << std::setw(11) << "allocs/cmd";
+    if (commandLine.simulate) {
+        std::cout << std::setw(11) << "kernel ms";
+    }
+    std::cout << "\n";
+}
+
+void printResult(const CommandLine& commandLine, const Result& result)
+{
+    const std::size_t allocations = result.load.allocations
+                                    + result.plan.allocations
+                                    + result.apply.allocations;
+    const double nbCommands = static_cast<double>(result.nbCommands);
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(8)
+              << result.sizes.nbRules << std::setw(8) << result.sizes.nbInterfaces
+              << std::setw(8) << result.sizes.nbLayerCommands << std::setw(9)
+              << result.nbCommands << std::setw(11) << result.load.durationMs
+              << std::setw(11) << result.plan.durationMs << std::setw(11)
+              << result.apply.durationMs << std::setw(11) << allocations
+              << std::setw(11) << nsPerCommand(result.apply, result.nbCommands)
+              << std::setw(11) << static_cast<double>(allocations) / nbCommands;
+    if (commandLine.simulate) {
+        std::cout << std::setw(11) << result.kernelMs;
+    }
+    std::cout << std::endl;
+}
+
+/* Tell whether the cost per command of each phase stayed (almost) flat */
+bool isLinear(const CommandLine& commandLine,
+              const Result& previous,
+              const Result& current)
+{
+    // Phases shorter than that are dominated by noise
+    constexpr double MIN_DURATION_MS = 5.0;
+
+    using Phase = std::pair<const char*, PhaseProfiler::Measure Result::*>;
+    const std::vector<Phase> phases = {
+        {"load", &Result::load}, {"plan", &Result::plan}, {"apply", &Result::apply}};
+
+    bool linear = true;
+    for (const auto& [name, measure] : phases) {
+        if ((current.*measure).durationMs < MIN_DURATION_MS) {
+            continue;
+        }
+
+        const double growth = nsPerCommand(current.*measure, current.nbCommands)
+                              / std::max(nsPerCommand(previous.*measure,
+                                                      previous.nbCommands),
+                                         std::numeric_limits<double>::min());
+        if (growth > commandLine.maxGrowth) {
+            std::cout << "  super-linear: " << name << " cost per command grew x"
+                      << growth << " from " << previous.sizes.nbRules << " to "
+                      << current.sizes.nbRules << " rules" << std::endl;
+            linear = false;
+        }
+    }
+
+    return linear;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    const CommandLine commandLine = parseCommandLine(argc, argv);
+
+    printHeader(commandLine);
+
+    bool linear = true;
+    std::vector<Result> results;
+    for (std::size_t nbRules = commandLine.minRules; nbRules <= commandLine.maxRules;
+         nbRules *= commandLine.factor) {
+        const std::size_t nbItems = std::max<std::size_t>(
+            1, nbRules / commandLine.rulesPerItem);
+
+        const ConfigGenerator::Sizes sizes
+            = {nbItems, nbItems, nbRules, commandLine.commandsPerRule};
+        results.push_back(best(commandLine, sizes));
+        printResult(commandLine, results.back());
+
+        if (results.size() > 1) {
+            const Result& previous = results[results.size() - 2];
+            linear = isLinear(commandLine, previous, results.back()) && linear;
+        }
+    }
+
+    return linear ? EXIT_SUCCESS : EXIT_FAILURE;
+}
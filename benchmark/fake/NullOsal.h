@@ -0,0 +1,101 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __BENCHMARK_FAKE_NULL_OSAL_H__
+#define __BENCHMARK_FAKE_NULL_OSAL_H__
+
+#include "utils/command/executor/IOsal.h"
+
+namespace benchmarking {
+
+/**
+ * @class NullOsal NullOsal.h "fake/NullOsal.h"
+ * @ingroup Helper
+ *
+ * @brief An OSAL that pretends programs have been executed successfully
+ *
+ * No process is created: createProcess() always returns in the "parent"
+ * and the "child" consumed no resource. Plugged into the real Executor, it
+ * lets the whole service run without root and without touching the host
+ * so that what is measured is the overhead of the service itself
+ * (parsing, planning, bookkeeping, ...) per command.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NullOsal : public utils::command::osal::IOsal {
+
+public:
+    /** Class constructor */
+    NullOsal() = default;
+
+    /** Class destructor */
+    ~NullOsal() override = default;
+
+    /** Class copy constructor */
+    NullOsal(const NullOsal&) = delete;
+
+    /** Class copy-assignment operator */
+    NullOsal& operator=(const NullOsal&) = delete;
+
+    /** Class move constructor */
+    NullOsal(NullOsal&&) = delete;
+
+    /** Class move-assignment operator */
+    NullOsal& operator=(NullOsal&&) = delete;
+
+    /** Always in the parent process */
+    [[nodiscard]] ProcessId createProcess() const override;
+
+    /** The child consumed nothing */
+    [[nodiscard]] ResourceUsage waitChildProcess() const override;
+
+    /** Never called since there is no child process */
+    void executeProgram(const char* pathname,
+                        char* const argv[],
+                        char* const envp[]) const override;
+
+    /** Nothing to do */
+    void reseedPRNG() const override;
+
+    /** Nothing to do */
+    void sanitizeFiles() const override;
+
+    /** Nothing to do */
+    void dropPrivileges() const override;
+};
+
+}
+
+#endif
@@ -0,0 +1,131 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <string>
+#include <utility>
+
+#include "ConfigGenerator.h"
+
+using namespace benchmarking;
+
+namespace {
+
+/* A distinct IPv4 address for each index in 10.0.0.0/8 */
+std::string address(std::size_t index)
+{
+    constexpr std::size_t BYTE = 256;
+
+    return "10." + std::to_string((index / (BYTE * BYTE)) % BYTE) + "."
+           + std::to_string((index / BYTE) % BYTE) + "."
+           + std::to_string(index % BYTE);
+}
+
+/* Write "[", the items produced by writeItem separated by commas, then "]" */
+template <typename WriteItem>
+void writeArray(std::ostream& stream, std::size_t nbItems, WriteItem writeItem)
+{
+    stream << "[";
+    for (std::size_t index = 0; index < nbItems; ++index) {
+        stream << (index == 0 ? "\n" : ",\n");
+        writeItem(index);
+    }
+    stream << "]";
+}
+
+}
+
+struct ConfigGenerator::Internal {
+    const Sizes sizes;
+    const std::string layerPathname;
+
+    explicit Internal(const Sizes& providedSizes, std::string providedLayerPathname)
+        : sizes(providedSizes), layerPathname(std::move(providedLayerPathname))
+    {}
+
+    void writeInterfaceCommands(std::ostream& stream, std::size_t index) const
+    {
+        const std::string name = "bench" + std::to_string(index);
+
+        stream << "\"/sbin/ip link add " << name << " type dummy\",\n"
+               << "\"/sbin/ip addr add " << address(index) << "/32 dev " << name
+               << "\",\n"
+               << "\"/sbin/ip link set dev " << name << " up\"";
+    }
+
+    void writeRule(std::ostream& stream, std::size_t index) const
+    {
+        constexpr std::size_t NB_PORTS = 65535;
+
+        stream << "{\"name\": \"rule " << index << "\", \"commands\": ";
+        const std::size_t nbCommands = sizes.nbCommandsPerRule;
+        writeArray(stream, nbCommands, [&stream, index, nbCommands](auto command) {
+            const std::size_t id = index * nbCommands + command;
+            stream << "\"/sbin/iptables -A INPUT -s " << address(id)
+                   << " -p tcp --dport " << 1 + id % NB_PORTS << " -j DROP\"";
+        });
+        stream << "}";
+    }
+};
+
+ConfigGenerator::ConfigGenerator(const Sizes& sizes,
+                                 const std::string& layerPathname)
+    : m_internal(std::make_unique<Internal>(sizes, layerPathname))
+{}
+
+ConfigGenerator::~ConfigGenerator() = default;
+
+void ConfigGenerator::writeJson(std::ostream& stream) const
+{
+    const Sizes& sizes = m_internal->sizes;
+
+    stream << "{\"network\": {\"interfaceNames\": [\"lo\"],\n"
+           << "\"interfaceCommands\": ";
+    writeArray(stream, sizes.nbInterfaces, [this, &stream](auto index) {
+        m_internal->writeInterfaceCommands(stream, index);
+    });
+
+    stream << ",\n\"layerCommands\": ";
+    writeArray(stream, sizes.nbLayerCommands, [this, &stream](auto index) {
+        stream << "{\"pathname\": \"" << m_internal->layerPathname
+               << "\", \"value\": \"" << index << "\"}";
+    });
+
+    stream << "},\n\"rules\": ";
+    writeArray(stream, sizes.nbRules, [this, &stream](auto index) {
+        m_internal->writeRule(stream, index);
+    });
+    stream << "}\n";
+}
+
+std::size_t ConfigGenerator::nbCommands() const
+{
+    const Sizes& sizes = m_internal->sizes;
+
+    return sizes.nbInterfaces * COMMANDS_PER_INTERFACE + sizes.nbLayerCommands
+           + sizes.nbRules * sizes.nbCommandsPerRule;
+}
@@ -0,0 +1,129 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __BENCHMARK_GENERATOR_CONFIG_GENERATOR_H__
+#define __BENCHMARK_GENERATOR_CONFIG_GENERATOR_H__
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace benchmarking {
+
+/**
+ * @class ConfigGenerator ConfigGenerator.h "generator/ConfigGenerator.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to generate synthetic configurations of any size
+ *
+ * The generated configuration has the format expected by the json config
+ * plugin. Each interface is created with 3 commands (add, address, up),
+ * each layer command writes to the same file and each rule is made of
+ * iptables commands matching distinct addresses and ports so that they
+ * look like real rules to the optimization passes.
+ *
+ * The configuration is written as it is generated: it is never held in
+ * memory, which allows generating configurations with 100k+ rules.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class ConfigGenerator {
+
+public:
+    /**
+     * @struct Sizes
+     *
+     * @brief Size of each section of the generated configuration
+     */
+    struct Sizes {
+        /** Number of interfaces created by interface commands */
+        std::size_t nbInterfaces;
+
+        /** Number of layer commands */
+        std::size_t nbLayerCommands;
+
+        /** Number of rules */
+        std::size_t nbRules;
+
+        /** Number of commands in each rule */
+        std::size_t nbCommandsPerRule;
+    };
+
+    /** Number of interface commands generated per interface */
+    static constexpr std::size_t COMMANDS_PER_INTERFACE = 3;
+
+    /**
+     * Class constructor
+     *
+     * @param sizes         Size of each section
+     * @param layerPathname File written by all layer commands
+     */
+    explicit ConfigGenerator(const Sizes& sizes,
+                             const std::string& layerPathname = "/dev/null");
+
+    /** Class destructor */
+    ~ConfigGenerator();
+
+    /** Class copy constructor */
+    ConfigGenerator(const ConfigGenerator&) = delete;
+
+    /** Class copy-assignment operator */
+    ConfigGenerator& operator=(const ConfigGenerator&) = delete;
+
+    /** Class move constructor */
+    ConfigGenerator(ConfigGenerator&&) = delete;
+
+    /** Class move-assignment operator */
+    ConfigGenerator& operator=(ConfigGenerator&&) = delete;
+
+    /**
+     * @brief Write the configuration in JSON
+     *
+     * @param stream The output stream where to write the configuration
+     */
+    void writeJson(std::ostream& stream) const;
+
+    /** Number of commands (interface, layer and rule) the service applies */
+    [[nodiscard]] std::size_t nbCommands() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
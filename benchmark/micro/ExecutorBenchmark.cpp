@@ -0,0 +1,82 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <benchmark/benchmark.h>
+
+#include "utils/command/executor/Executor.h"
+#include "utils/command/executor/PoolExecutor.h"
+#include "utils/command/executor/osal/Linux.h"
+
+using namespace utils::command;
+using namespace utils::command::osal;
+
+namespace {
+
+/* Spawn /bin/true and wait for it: the fixed cost paid by every
+ * command of a configuration, whatever it does */
+void executeProgram(benchmark::State& state)
+{
+    const Linux osal;
+    const Executor executor(osal, Executor::Flags::WAIT_COMMAND);
+
+    char pathname[] = "/bin/true";
+    char* const argv[] = {pathname, nullptr};
+    char* const envp[] = {nullptr};
+
+    for (auto _ : state) {
+        executor.executeProgram({pathname, argv, envp});
+    }
+}
+
+/* Same from several threads sharing a pool of workers: the cost of
+ * handing programs over to workers and of the contention on its queue */
+void executeProgramOnPool(benchmark::State& state)
+{
+    static const Linux osal;
+    static const Executor executor(osal, Executor::Flags::WAIT_COMMAND);
+    static const PoolExecutor poolExecutor(executor, PoolExecutor::Options());
+
+    char pathname[] = "/bin/true";
+    char* const argv[] = {pathname, nullptr};
+    char* const envp[] = {nullptr};
+
+    for (auto _ : state) {
+        poolExecutor.executeProgram({pathname, argv, envp});
+    }
+}
+
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(executeProgram)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(executeProgramOnPool)
+    ->Unit(benchmark::kMicrosecond)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
@@ -0,0 +1,76 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <benchmark/benchmark.h>
+#include <fstream>
+
+#include "plugins/config/Config.h"
+
+#include "utils/file/reader/Reader.h"
+#include "utils/file/temporary/TemporaryFile.h"
+
+#include "generator/ConfigGenerator.h"
+
+using namespace benchmarking;
+using namespace service::plugins::config;
+using namespace utils::file;
+
+namespace {
+
+/* Load a configuration file containing state.range(0) rules. The file
+ * is generated once, before timing starts */
+void load(benchmark::State& state)
+{
+    const auto nbRules = static_cast<std::size_t>(state.range(0));
+
+    const ConfigGenerator generator({1, 1, nbRules, 2});
+    const TemporaryFile configFile;
+    {
+        std::ofstream stream(configFile.pathname());
+        generator.writeJson(stream);
+    }
+
+    const Reader reader;
+    const Config config(reader);
+
+    for (auto _ : state) {
+        auto configData = config.load(configFile.pathname());
+        benchmark::DoNotOptimize(configData);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations())
+                            * static_cast<int64_t>(nbRules));
+}
+
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(load)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "utils/concurrency/MpmcQueue.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+/* The baseline: the usual mutex-protected queue */
+class LockedQueue {
+
+public:
+    bool tryPush(std::size_t&& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_values.push_back(value);
+        return true;
+    }
+
+    bool tryPop(std::size_t& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_values.empty()) {
+            return false;
+        }
+
+        value = m_values.front();
+        m_values.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::deque<std::size_t> m_values;
+};
+
+/* Each thread pushes an element then pops one, the way callers and
+ * workers of a pool share its queue. Contention grows with the number of
+ * threads, all of them hammering the same queue */
+template <typename Queue>
+void pushAndPop(benchmark::State& state, Queue& queue)
+{
+    std::size_t value = 0;
+
+    for (auto _ : state) {
+        while (!queue.tryPush(std::size_t {value})) {
+            std::this_thread::yield();
+        }
+        while (!queue.tryPop(value)) {
+            std::this_thread::yield();
+        }
+        benchmark::DoNotOptimize(value);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void pushAndPopLockFree(benchmark::State& state)
+{
+    static MpmcQueue<std::size_t> queue(1024);
+    pushAndPop(state, queue);
+}
+
+void pushAndPopLocked(benchmark::State& state)
+{
+    static LockedQueue queue;
+    pushAndPop(state, queue);
+}
+
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(pushAndPopLockFree)->ThreadRange(1, 8)->UseRealTime();
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(pushAndPopLocked)->ThreadRange(1, 8)->UseRealTime();
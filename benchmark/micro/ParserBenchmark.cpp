@@ -0,0 +1,62 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "utils/command/parser/Parser.h"
+
+using namespace utils::command;
+
+namespace {
+
+/* Parse a command made of state.range(0) arguments of state.range(1)
+ * characters each */
+void parse(benchmark::State& state)
+{
+    const auto nbArguments = static_cast<std::size_t>(state.range(0));
+    const auto length      = static_cast<std::size_t>(state.range(1));
+
+    std::string command = "/sbin/iptables";
+    for (std::size_t index = 0; index < nbArguments; ++index) {
+        command += ' ' + std::string(length, 'a');
+    }
+
+    for (auto _ : state) {
+        auto parsedCommand = Parser::parse(command);
+        benchmark::DoNotOptimize(parsedCommand);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())
+                            * static_cast<int64_t>(command.size()));
+}
+
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(parse)->ArgsProduct({{1, 8, 64}, {4, 64}});
@@ -0,0 +1,68 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+
+#include "utils/file/reader/Reader.h"
+
+using namespace utils::file;
+
+namespace {
+
+/* Read a stream of state.range(0) bytes made of 80-character lines,
+ * the typical shape of a configuration file */
+void readFromStream(benchmark::State& state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+
+    std::string content;
+    content.reserve(size);
+    while (content.size() < size) {
+        content += std::string(79, 'a') + '\n';
+    }
+    content.resize(size);
+
+    const Reader reader;
+    std::string result;
+
+    for (auto _ : state) {
+        std::istringstream stream(content);
+        reader.readFromStream(stream, result);
+        benchmark::DoNotOptimize(result.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations())
+                            * static_cast<int64_t>(size));
+}
+
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp)
+BENCHMARK(readFromStream)->RangeMultiplier(16)->Range(1 << 10, 1 << 24);
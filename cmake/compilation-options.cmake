@@ -96,6 +96,16 @@ list(APPEND CFLAGS_OPTIONS -Wall -Wextra -Werror
                            -Wparentheses -Winit-self -Wredundant-decls
                            -Wcast-qual -Wcast-align -Wshadow)
 
+# Objects are also linked into the shared library (see src/embedded).
+# CMake compiles them with -fPIC and executables with -fPIE/-pie
+include(CheckPIESupported)
+check_pie_supported()
+set(CMAKE_POSITION_INDEPENDENT_CODE ON)
+
+# Only the API of the shared library is exported (see service/Export.h):
+# its helpers can't clash with the symbols of the program embedding it
+set(CMAKE_CXX_VISIBILITY_PRESET hidden)
+
 # Force build type to Release if not defined
 if (NOT CMAKE_BUILD_TYPE)
     set(CMAKE_BUILD_TYPE "Release" CACHE STRING
@@ -129,7 +139,7 @@ if (ENABLE_SECURITY)
     list(APPEND LDFLAGS_OPTIONS -Wl,-z,now -Wl,-z,relro -Wl,-z,noexecstack)
     list(APPEND CFLAGS_OPTIONS -D_FORTIFY_SOURCE=2 -Wformat -Wformat-security
                                -fstack-protector-all -Wstack-protector --param ssp-buffer-size=4
-                               -pie -fPIE -ftrapv)
+                               -ftrapv)
 endif()
 
 # Add logic to generate output files that can be processed by the gcov command.
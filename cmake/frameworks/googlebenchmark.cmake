@@ -0,0 +1,57 @@
+##
+#
+# \file googlebenchmark.cmake
+#
+# \author Boubacar DIENE <boubacar.diene@gmail.com>
+# \date   October 2026
+#
+# \brief  A CMake script to fetch Google Benchmark at configure
+#         time and also adds it to the main build. However, in
+#         case the library is already present on the system, it
+#         will be used instead.
+#
+# \see    https://github.com/google/benchmark
+#
+##
+
+#################################################################
+#                          Variables                            #
+#################################################################
+
+set(GBENCHMARK_VERSION 1.7.1
+    CACHE STRING "Which release are you interested in?"
+    FORCE)
+
+#################################################################
+#                           Install                             #
+#################################################################
+
+# Find installed Google Benchmark package
+find_package(benchmark ${GBENCHMARK_VERSION} QUIET)
+
+if(NOT benchmark_FOUND)
+
+    #---------------------------------------------------------------#
+    #                            Fetch                              #
+    #---------------------------------------------------------------#
+
+    # Only the library is needed: neither its own tests (which would
+    # also require googletest) nor its installation
+    set(BENCHMARK_ENABLE_TESTING OFF
+        CACHE BOOL "Disable tests of Google Benchmark")
+    set(BENCHMARK_ENABLE_INSTALL OFF
+        CACHE BOOL "Disable installation of Google Benchmark")
+
+    include(FetchContent)
+    FetchContent_Declare(
+        googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG        v${GBENCHMARK_VERSION}
+    )
+
+    # After the following call, the benchmark::benchmark and
+    # benchmark::benchmark_main targets will be available to the
+    # rest of the build
+    FetchContent_MakeAvailable(googlebenchmark)
+
+endif()
@@ -35,9 +35,11 @@ find_program(CLANG_FORMAT_EXECUTABLE NAMES clang-format)
 #################################################################
 
 # Prepare the complete list of files to take into account
-# ALL_CXX_TEST_FILES is empty when unit testing is not enabled
+# ALL_CXX_TEST_FILES (resp. ALL_CXX_BENCHMARK_FILES) is empty when
+# unit testing (resp. benchmarking) is not enabled
 set(CXX_FILES ${ALL_CXX_SOURCE_FILES})
 list(APPEND CXX_FILES ${ALL_CXX_TEST_FILES})
+list(APPEND CXX_FILES ${ALL_CXX_BENCHMARK_FILES})
 
 # Define "clang-format" target
 # "make clang-format" has to be used to format the source code
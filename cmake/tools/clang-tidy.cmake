@@ -31,9 +31,11 @@ find_program(CLANG_TIDY_EXECUTABLE NAMES clang-tidy)
 #################################################################
 
 # Prepare the complete list of files to take into account
-# ALL_CXX_TEST_FILES is empty when unit testing is not enabled
+# ALL_CXX_TEST_FILES (resp. ALL_CXX_BENCHMARK_FILES) is empty when
+# unit testing (resp. benchmarking) is not enabled
 set(CXX_FILES ${ALL_CXX_SOURCE_FILES})
 list(APPEND CXX_FILES ${ALL_CXX_TEST_FILES})
+list(APPEND CXX_FILES ${ALL_CXX_BENCHMARK_FILES})
 
 # Define "clang-tidy" target
 # "make clang-tidy" has to be used to "lint" the source code
@@ -27,36 +27,80 @@
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
 #include <CLI11.hpp>
+#include <csignal>
 #include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "plugins/config/Config.h"
 #include "plugins/firewall/RuleFactory.h"
 #include "plugins/logger/Logger.h"
 #include "plugins/network/Network.h"
+#include "plugins/optimizer/Optimizer.h"
+#include "plugins/profiler/Profiler.h"
+#include "plugins/reorderer/Reorderer.h"
+#include "plugins/transaction/Transaction.h"
 
+#include "service/ControlServer.h"
 #include "service/NetworkService.h"
 
+#include "utils/command/accounting/Accounting.h"
 #include "utils/command/executor/Executor.h"
+#include "utils/command/executor/PoolExecutor.h"
+#include "utils/command/executor/osal/CountingOsal.h"
 #include "utils/command/executor/osal/Linux.h"
+#include "utils/command/recorder/FlightRecorder.h"
 
 #include "utils/file/reader/Reader.h"
 #include "utils/file/writer/Writer.h"
+#include "utils/helper/AllocationCounter.h"
 
 using namespace service;
 using namespace service::plugins::config;
 using namespace service::plugins::firewall;
 using namespace service::plugins::logger;
 using namespace service::plugins::network;
+using namespace service::plugins::optimizer;
+using namespace service::plugins::profiler;
+using namespace service::plugins::reorderer;
+using namespace service::plugins::transaction;
 
 using namespace utils::command;
 using namespace utils::command::osal;
 using namespace utils::file;
+using namespace utils::helper;
 
 struct CommandLine {
     std::string configFile;
     Executor::Flags flags;
+    bool reportUsage        = false;
+    bool profile            = false;
+    bool transactional      = false;
+    bool reorder            = false;
+    ILogger::Level logLevel = ILogger::Level::DEBUG;
+    std::string flightRecordFile;
+    std::vector<std::string> namespaces;
+    std::size_t nbJobs       = 0;
+    bool async               = false;
+    std::size_t nbWorkers    = 0;
+    std::vector<unsigned int> cpus;
+    std::size_t pipelineSize = 0;
+    std::string socketPath;
+    std::string socketGroup;
+    std::vector<Optimizer::Passes> passes;
 };
 
+/* Resident service to stop when SIGINT or SIGTERM is received */
+static const ControlServer* gControlServer = nullptr;
+
+static void onStopSignal([[maybe_unused]] int signalNumber)
+{
+    if (gControlServer != nullptr) {
+        gControlServer->stop();
+    }
+}
+
 static inline CommandLine parseCommandLine(int argc, char** argv)
 {
     CLI::App app(" ");
@@ -67,10 +111,22 @@ static inline CommandLine parseCommandLine(int argc, char** argv)
 
     CommandLine commandLine;
 
-    app.add_option(
-           "-c,--config", commandLine.configFile, "Path to configuration file")
-        ->required()
-        ->check(CLI::ExistingFile);
+    CLI::Option* configOption
+        = app.add_option(
+                 "-c,--config", commandLine.configFile, "Path to configuration file")
+              ->check(CLI::ExistingFile);
+
+    CLI::Option* listenOption
+        = app.add_option("-L,--listen",
+                         commandLine.socketPath,
+                         "Stay resident and apply the configurations submitted to "
+                         "this Unix socket")
+              ->excludes(configOption);
+
+    app.add_option("--listen-group",
+                   commandLine.socketGroup,
+                   "Also let the members of this group use the socket")
+        ->needs(listenOption);
 
     std::map<bool, Executor::Flags> option2Flags {
         {false, Executor::Flags::WAIT_COMMAND}, {true, Executor::Flags::ALL}};
@@ -80,14 +136,115 @@ static inline CommandLine parseCommandLine(int argc, char** argv)
         ->required()
         ->transform(CLI::CheckedTransformer(option2Flags));
 
+    std::map<std::string, ILogger::Level> option2Level {
+        {"debug", ILogger::Level::DEBUG},
+        {"info", ILogger::Level::INFO},
+        {"warn", ILogger::Level::WARN},
+        {"error", ILogger::Level::ERROR}};
+
+    app.add_option("-l,--log-level",
+                   commandLine.logLevel,
+                   "Do not print logs below this level (default: debug)")
+        ->transform(CLI::CheckedTransformer(option2Level));
+
+    app.add_option("-f,--flight-record",
+                   commandLine.flightRecordFile,
+                   "Where to dump the last executed commands on failure");
+
+    std::map<std::string, Optimizer::Passes> option2Pass {
+        {"iptables", Optimizer::Passes::IPTABLES},
+        {"cidr", Optimizer::Passes::CIDR},
+        {"ipset", Optimizer::Passes::IPSET},
+        {"nft-vmap", Optimizer::Passes::NFT_VMAP}};
+
+    CLI::Option* optimizeOption = app.add_option("-O,--optimize",
+                   commandLine.passes,
+                   "Optimization pass to run on rules before applying them. "
+                   "Repeatable")
+        ->transform(CLI::CheckedTransformer(option2Pass));
+
+    CLI::Option* netnsOption = app.add_option(
+        "-n,--netns",
+        commandLine.namespaces,
+        "Network namespace (path or PID) to configure. Repeatable");
+
+    app.add_option("-j,--jobs",
+                   commandLine.nbJobs,
+                   "Namespaces configured in parallel (default: 0 i.e. all CPUs)");
+
+    app.add_flag("-a,--async",
+                 commandLine.async,
+                 "Configure all the namespaces of a job at once, each one waiting "
+                 "for its commands without blocking the others")
+        ->needs(netnsOption);
+
+    // A single namespace waits for each of its commands in turn: workers
+    // would only add a hand-over to every command
+    CLI::Option* workersOption
+        = app.add_option("-w,--workers",
+                         commandLine.nbWorkers,
+                         "Execute commands on a pool of this number of threads. "
+                         "Needs --netns, where commands of several namespaces "
+                         "run at once")
+              ->check(CLI::PositiveNumber)
+              ->needs(netnsOption);
+
+    app.add_option("-C,--cpus",
+                   commandLine.cpus,
+                   "Comma-separated CPUs the workers are pinned to, in turn")
+        ->delimiter(',')
+        ->needs(workersOption);
+
+    app.add_flag("-u,--report-usage",
+                 commandLine.reportUsage,
+                 "Report resources consumed by commands per rule and binary");
+
+    app.add_flag("-p,--profile",
+                 commandLine.profile,
+                 "Report wall time and perf counters of each apply phase");
+
+    CLI::Option* transactionalOption
+        = app.add_flag("-t,--transactional",
+                       commandLine.transactional,
+                       "Restore the previous state if applying the config fails")
+              ->excludes(netnsOption);
+
+    CLI::Option* reorderOption
+        = app.add_flag("-r,--reorder",
+                       commandLine.reorder,
+                       "Move rules matching the most packets first when it is safe")
+              ->excludes(netnsOption);
+
+    app.add_option("-P,--pipeline",
+                   commandLine.pipelineSize,
+                   "Apply rules while the config is read, with at most this "
+                   "number of rules waiting")
+        ->check(CLI::PositiveNumber)
+        ->excludes(optimizeOption)
+        ->excludes(netnsOption)
+        ->excludes(transactionalOption)
+        ->excludes(reorderOption);
+
     try {
         app.parse(argc, argv);
+
+        if (commandLine.configFile.empty() && commandLine.socketPath.empty()) {
+            throw CLI::RequiredError("--config or --listen");
+        }
     }
     catch (const CLI::ParseError& e) {
         app.exit(e);
         std::exit(EXIT_FAILURE);
     }
 
+    /* A PID refers to the network namespace of that process */
+    for (std::string& ns : commandLine.namespaces) {
+        if (!ns.empty()
+            && (ns.find_first_not_of("0123456789") == std::string::npos)) {
+            ns = "/proc/" + ns + "/ns/net";
+        }
+    }
+
     return commandLine;
 }
 
@@ -96,19 +253,152 @@ int main(int argc, char** argv)
     CommandLine commandLine = parseCommandLine(argc, argv);
 
     /* Initialize and inject dependencies */
-    Logger logger           = Logger();
-    Linux osal              = Linux();
-    Executor executor       = Executor(osal, commandLine.flags);
+    Logger logger           = Logger(commandLine.logLevel);
+    std::unique_ptr<FlightRecorder> flightRecorder;
+    if (!commandLine.flightRecordFile.empty()) {
+        flightRecorder = std::make_unique<FlightRecorder>();
+        flightRecorder->dumpOnFatalSignals(commandLine.flightRecordFile);
+    }
+
+    Linux linuxOsal         = Linux(flightRecorder.get());
+    CountingOsal osal       = CountingOsal(linuxOsal);
+    Accounting accounting   = Accounting();
+    Executor executor       = Executor(
+        osal,
+        commandLine.flags,
+        {commandLine.reportUsage ? &accounting : nullptr, flightRecorder.get()});
+
+    /* Commands are handed over to workers when a pool is requested */
+    std::unique_ptr<PoolExecutor> poolExecutor;
+    if (commandLine.nbWorkers != 0) {
+        PoolExecutor::Options options;
+        options.nbWorkers = commandLine.nbWorkers;
+        options.cpus      = commandLine.cpus;
+        try {
+            poolExecutor = std::make_unique<PoolExecutor>(executor, options);
+        }
+        catch (const std::exception& e) {
+            logger.error(e.what());
+            return EXIT_FAILURE;
+        }
+    }
+    const IExecutor& commandExecutor
+        = poolExecutor ? static_cast<const IExecutor&>(*poolExecutor) : executor;
+
     Writer writer           = Writer();
     Reader reader           = Reader();
-    Network network         = Network(executor, writer);
-    RuleFactory ruleFactory = RuleFactory(executor);
+    Network network         = Network(commandExecutor, writer);
+    RuleFactory ruleFactory = RuleFactory(commandExecutor);
     Config config           = Config(reader);
+    Profiler profiler
+        = Profiler(commandLine.profile, &osal, &AllocationCounter::count);
+    Transaction transaction
+        = Transaction(commandExecutor, writer, commandLine.transactional);
 
-    NetworkService::NetworkServiceParams networkServiceParams(
-        {logger, config, network, ruleFactory});
+    unsigned int passes = Optimizer::Passes::NONE;
+    for (const Optimizer::Passes pass : commandLine.passes) {
+        passes |= pass;
+    }
+    Optimizer optimizer = Optimizer(writer, static_cast<Optimizer::Passes>(passes));
+    Reorderer reorderer = Reorderer(commandExecutor, writer, commandLine.reorder);
+
+    NetworkService::NetworkServiceParams networkServiceParams({logger,
+                                                               config,
+                                                               network,
+                                                               ruleFactory,
+                                                               profiler,
+                                                               transaction,
+                                                               optimizer,
+                                                               reorderer});
     NetworkService networkService(networkServiceParams);
 
     /* Set up the network and firewall based on provided file */
-    return networkService.applyConfig(commandLine.configFile);
+    auto applyConfig = [&](const std::string& configFile) {
+        int status = EXIT_SUCCESS;
+        if (commandLine.pipelineSize != 0) {
+            status = networkService.applyConfigPipelined(configFile,
+                                                         commandLine.pipelineSize);
+        }
+        else if (commandLine.async) {
+            status = networkService.applyConfigAsync(
+                configFile, commandLine.namespaces, commandLine.nbJobs);
+        }
+        else if (!commandLine.namespaces.empty()) {
+            status = networkService.applyConfig(
+                configFile, commandLine.namespaces, commandLine.nbJobs);
+        }
+        else {
+            status = networkService.applyConfig(configFile);
+        }
+
+        /* Keep track of what happened until the failure */
+        if ((status == EXIT_FAILURE) && flightRecorder) {
+            if (flightRecorder->dump(commandLine.flightRecordFile.c_str())) {
+                logger.error("Flight record written to "
+                             + commandLine.flightRecordFile);
+            }
+            else {
+                logger.error("Failed to write flight record to "
+                             + commandLine.flightRecordFile);
+            }
+        }
+
+        return status;
+    };
+
+    int status = EXIT_SUCCESS;
+    if (commandLine.socketPath.empty()) {
+        status = applyConfig(commandLine.configFile);
+    }
+    else {
+        /* Apply submitted configurations without starting again each time */
+        try {
+            /* Each apply is reported as it ends, not only when exiting */
+            auto reportApply = [&optimizer, &reorderer]() {
+                return optimizer.toString() + reorderer.toString();
+            };
+            const ControlServer controlServer(logger,
+                                              applyConfig,
+                                              commandLine.socketPath,
+                                              commandLine.socketGroup,
+                                              reportApply);
+
+            gControlServer = &controlServer;
+            struct sigaction action {};
+            action.sa_handler = onStopSignal;
+            (void)sigemptyset(&action.sa_mask);
+            (void)sigaction(SIGINT, &action, nullptr);
+            (void)sigaction(SIGTERM, &action, nullptr);
+
+            controlServer.run();
+            gControlServer = nullptr;
+        }
+        catch (const std::exception& e) {
+            gControlServer = nullptr;
+            logger.error(e.what());
+            status = EXIT_FAILURE;
+        }
+    }
+
+    /* Tell which commands have been the most expensive */
+    if (commandLine.reportUsage) {
+        logger.info(accounting.toString());
+    }
+
+    /* Tell how rules have been rewritten */
+    if (commandLine.socketPath.empty() && !commandLine.passes.empty()) {
+        logger.info(optimizer.toString());
+    }
+
+    /* Tell how much cheaper the new order of rules is */
+    if (commandLine.socketPath.empty() && commandLine.reorder) {
+        logger.info(reorderer.toString());
+    }
+
+    /* Tell which phases have been the most expensive */
+    if (commandLine.profile) {
+        logger.info(profiler.toString());
+    }
+
+    return status;
 }
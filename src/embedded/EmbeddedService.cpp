@@ -0,0 +1,130 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "plugins/config/Config.h"
+#include "plugins/firewall/RuleFactory.h"
+#include "plugins/logger/Logger.h"
+#include "plugins/network/Network.h"
+#include "plugins/optimizer/Optimizer.h"
+#include "plugins/profiler/Profiler.h"
+#include "plugins/reorderer/Reorderer.h"
+#include "plugins/transaction/Transaction.h"
+
+#include "utils/command/executor/Executor.h"
+#include "utils/command/executor/osal/CountingOsal.h"
+#include "utils/command/executor/osal/Linux.h"
+
+#include "utils/file/reader/Reader.h"
+#include "utils/file/writer/Writer.h"
+
+#include "EmbeddedService.h"
+
+using namespace service;
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::logger;
+using namespace service::plugins::network;
+using namespace service::plugins::optimizer;
+using namespace service::plugins::profiler;
+using namespace service::plugins::reorderer;
+using namespace service::plugins::transaction;
+
+using namespace utils::command;
+using namespace utils::command::osal;
+using namespace utils::file;
+
+/* Default plugins are created even when replaced: they are cheap to build
+ * and this keeps their dependencies simple to wire */
+struct EmbeddedService::Internal {
+    Linux linuxOsal;
+    CountingOsal osal;
+    Executor executor;
+    Writer writer;
+    Reader reader;
+    Logger logger;
+    Config config;
+    Network network;
+    RuleFactory ruleFactory;
+    Profiler profiler;
+    Transaction transaction;
+    Optimizer optimizer;
+    Reorderer reorderer;
+    NetworkService::NetworkServiceParams params;
+    NetworkService networkService;
+
+    explicit Internal(const Options& options)
+        : osal(linuxOsal),
+          executor(osal,
+                   options.secure ? Executor::Flags::ALL
+                                  : Executor::Flags::WAIT_COMMAND),
+          logger(options.logLevel),
+          config(reader),
+          network(executor, writer),
+          ruleFactory(executor),
+          profiler(options.profile, &osal),
+          transaction(executor, writer, options.transactional),
+          optimizer(writer, static_cast<Optimizer::Passes>(options.optimizerPasses)),
+          reorderer(executor, writer, options.reorder),
+          params({pick(options.logger, logger),
+                  pick(options.config, config),
+                  pick(options.network, network),
+                  pick(options.ruleFactory, ruleFactory),
+                  pick(options.profiler, profiler),
+                  pick(options.transaction, transaction),
+                  pick(options.optimizer, optimizer),
+                  pick(options.reorderer, reorderer)}),
+          networkService(params)
+    {}
+
+    template<typename Plugin, typename DefaultPlugin>
+    static const Plugin& pick(const Plugin* custom, const DefaultPlugin& fallback)
+    {
+        return (custom != nullptr) ? *custom : fallback;
+    }
+};
+
+EmbeddedService::EmbeddedService(const Options& options)
+    : m_internal(std::make_unique<Internal>(options))
+{}
+
+EmbeddedService::~EmbeddedService() = default;
+
+NetworkService::Result EmbeddedService::apply(ConfigData configData) const
+{
+    return m_internal->networkService.apply(std::move(configData));
+}
+
+NetworkService::Result EmbeddedService::apply(const std::string& configFile) const
+{
+    return m_internal->networkService.apply(configFile);
+}
+
+const NetworkService& EmbeddedService::networkService() const
+{
+    return m_internal->networkService;
+}
@@ -0,0 +1,164 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __EMBEDDED_EMBEDDED_SERVICE_H__
+#define __EMBEDDED_EMBEDDED_SERVICE_H__
+
+#include <memory>
+#include <string>
+
+#include "service/Export.h"
+#include "service/NetworkService.h"
+
+namespace service {
+
+/**
+ * @class EmbeddedService EmbeddedService.h "embedded/EmbeddedService.h"
+ * @ingroup Core
+ *
+ * @brief Entry point of the networkservice library for programs that set
+ *        the network up in-process instead of running the executable
+ *
+ * It creates the same plugins as the executable does with its command line
+ * options. Any of them can be replaced by a custom implementation of its
+ * interface, which has to outlive this object.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NETWORKSERVICE_EXPORT EmbeddedService {
+
+public:
+    /**
+     * @struct Options
+     *
+     * @brief How to create the default plugins and which custom plugins to
+     *        use instead
+     */
+    struct Options {
+        /** Do not log below this level */
+        plugins::logger::ILogger::Level logLevel
+            = plugins::logger::ILogger::Level::INFO;
+
+        /** Sanitize files, drop privileges and reseed PRNG before executing
+         *  commands */
+        bool secure = true;
+
+        /** Measure each apply phase. Heap allocations are not counted: the
+         *  library leaves operator new alone */
+        bool profile = false;
+
+        /** Restore the previous state if applying a configuration fails */
+        bool transactional = false;
+
+        /** Move rules matching the most packets first when it is safe */
+        bool reorder = false;
+
+        /** Optimization passes to run on rules, a combination of the values
+         *  of Optimizer::Passes */
+        unsigned int optimizerPasses = 0;
+
+        /** Custom logger plugin or nullptr */
+        const plugins::logger::ILogger* logger = nullptr;
+
+        /** Custom config plugin or nullptr */
+        const plugins::config::IConfig* config = nullptr;
+
+        /** Custom network plugin or nullptr */
+        const plugins::network::INetwork* network = nullptr;
+
+        /** Custom firewall plugin or nullptr */
+        const plugins::firewall::IRuleFactory* ruleFactory = nullptr;
+
+        /** Custom profiler plugin or nullptr */
+        const plugins::profiler::IProfiler* profiler = nullptr;
+
+        /** Custom transaction plugin or nullptr */
+        const plugins::transaction::ITransaction* transaction = nullptr;
+
+        /** Custom optimizer plugin or nullptr */
+        const plugins::optimizer::IOptimizer* optimizer = nullptr;
+
+        /** Custom reorderer plugin or nullptr */
+        const plugins::reorderer::IReorderer* reorderer = nullptr;
+    };
+
+    /**
+     * Class constructor
+     *
+     * @param options A structure of type @ref Options
+     */
+    explicit EmbeddedService(const Options& options);
+
+    /** Class destructor */
+    ~EmbeddedService();
+
+    /** Class copy constructor */
+    EmbeddedService(const EmbeddedService&) = delete;
+
+    /** Class copy-assignment operator */
+    EmbeddedService& operator=(const EmbeddedService&) = delete;
+
+    /** Class move constructor */
+    EmbeddedService(EmbeddedService&&) = delete;
+
+    /** Class move-assignment operator */
+    EmbeddedService& operator=(EmbeddedService&&) = delete;
+
+    /**
+     * @brief Apply a network configuration built in memory
+     *
+     * @see NetworkService::apply
+     */
+    [[nodiscard]] NetworkService::Result
+        apply(plugins::config::ConfigData configData) const;
+
+    /**
+     * @brief Apply the network configuration given in provided file
+     *
+     * @see NetworkService::apply
+     */
+    [[nodiscard]] NetworkService::Result apply(const std::string& configFile) const;
+
+    /** The service, for the other ways of applying a configuration */
+    [[nodiscard]] const NetworkService& networkService() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
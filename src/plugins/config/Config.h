@@ -96,6 +96,23 @@ public:
     [[nodiscard]] std::unique_ptr<ConfigData>
         load(const std::string& configFile) const override;
 
+    /**
+     * @brief Read the configuration file and hand its network section then
+     *        each of its rules over as soon as they have been parsed
+     *
+     * The file is parsed from the stream itself instead of being read at
+     * once by the reader so that memory does not grow with its size.
+     *
+     * @param configFile Configuration file to read
+     * @param onNetwork  Called once with the network section
+     * @param onRule     Called with each rule
+     *
+     * @see IConfig::stream
+     */
+    void stream(const std::string& configFile,
+                const NetworkHandler& onNetwork,
+                const RuleHandler& onRule) const override;
+
 private:
     struct Internal;
     std::unique_ptr<Internal> m_internal;
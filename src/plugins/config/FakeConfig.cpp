@@ -78,3 +78,15 @@ std::unique_ptr<ConfigData> Config::load([
 
     return configData;
 }
+
+void Config::stream(const std::string& configFile,
+                    const NetworkHandler& onNetwork,
+                    const RuleHandler& onRule) const
+{
+    std::unique_ptr<ConfigData> configData = load(configFile);
+
+    onNetwork(std::move(configData->network));
+    for (ConfigData::Rule& rule : configData->rules) {
+        onRule(std::move(rule));
+    }
+}
@@ -28,6 +28,7 @@
 
 #include <fstream>
 #include <json.hpp>
+#include <stdexcept>
 
 #include "utils/file/reader/Reader.h"
 
@@ -42,6 +43,11 @@
 #define JSON_ALIAS_COMMANDS           "commands"
 #define JSON_ALIAS_RULES              "rules"
 #define JSON_ALIAS_NAME               "name"
+#define JSON_ALIAS_SETS               "sets"
+#define JSON_ALIAS_FILE               "file"
+#define JSON_ALIAS_FAMILY             "family"
+#define JSON_ALIAS_BACKEND            "backend"
+#define JSON_ALIAS_TABLE              "table"
 
 using json = nlohmann::json;
 
@@ -53,39 +59,67 @@ using namespace utils::file;
 // namespace
 namespace nlohmann {
 
-static void from_json(const json& jsonObject, ConfigData& config)
+static void from_json(const json& jsonObject, ConfigData::Rule& rule)
 {
-    const auto& network = jsonObject.at(JSON_ALIAS_NETWORK);
+    for (const auto& command : jsonObject.at(JSON_ALIAS_COMMANDS)) {
+        rule.commands.emplace_back(command);
+    }
+    jsonObject.at(JSON_ALIAS_NAME).get_to(rule.name);
 
+    // "sets" are optional and so are their family, backend and table
+    const auto sets = jsonObject.find(JSON_ALIAS_SETS);
+    if (sets != jsonObject.end()) {
+        for (const auto& set : *sets) {
+            ConfigData::Rule::AddressSet tempSet;
+            set.at(JSON_ALIAS_NAME).get_to(tempSet.name);
+            set.at(JSON_ALIAS_FILE).get_to(tempSet.file);
+            tempSet.family  = set.value(JSON_ALIAS_FAMILY, tempSet.family);
+            tempSet.backend = set.value(JSON_ALIAS_BACKEND, tempSet.backend);
+            tempSet.table   = set.value(JSON_ALIAS_TABLE, tempSet.table);
+            rule.sets.push_back(tempSet);
+        }
+    }
+}
+
+/* Return false if the "layerCommands" section is missing or invalid in which
+ * case the rules are ignored as well */
+static bool readNetwork(const json& network, ConfigData::Network& config)
+{
     // "interfaceNames" section
     for (const auto& interface : network.at(JSON_ALIAS_INTERFACE_NAMES)) {
-        config.network.interfaceNames.emplace_back(interface);
+        config.interfaceNames.emplace_back(interface);
     }
 
     // "interfaceCommands" section
     for (const auto& interfaceCommand : network.at(JSON_ALIAS_INTERFACE_COMMANDS)) {
-        config.network.interfaceCommands.emplace_back(interfaceCommand);
+        config.interfaceCommands.emplace_back(interfaceCommand);
     }
 
     try {
         // "layerCommands" section
         for (const auto& layerCommand : network.at(JSON_ALIAS_LAYER_COMMANDS)) {
-            config.network.layerCommands.emplace_back(
-                ConfigData::Network::LayerCommand {
-                    layerCommand.at(JSON_ALIAS_PATHNAME),
-                    layerCommand.at(JSON_ALIAS_VALUE)});
+            config.layerCommands.emplace_back(ConfigData::Network::LayerCommand {
+                layerCommand.at(JSON_ALIAS_PATHNAME),
+                layerCommand.at(JSON_ALIAS_VALUE)});
         }
+    }
+    catch (const json::out_of_range& e) {
+        return false;
+    }
 
+    return true;
+}
+
+static void from_json(const json& jsonObject, ConfigData& config)
+{
+    if (!readNetwork(jsonObject.at(JSON_ALIAS_NETWORK), config.network)) {
+        return;
+    }
+
+    try {
         // "rules" section
-        const auto& rules = jsonObject.at(JSON_ALIAS_RULES);
-
-        for (const auto& rule : rules) {
-            ConfigData::Rule tempRule;
-            for (const auto& command : rule.at(JSON_ALIAS_COMMANDS)) {
-                tempRule.commands.emplace_back(command);
-            }
-            rule.at(JSON_ALIAS_NAME).get_to(tempRule.name);
-            config.rules.emplace_back(tempRule);
+        for (const auto& rule : jsonObject.at(JSON_ALIAS_RULES)) {
+            config.rules.emplace_back(rule.get<ConfigData::Rule>());
         }
     }
     catch (const json::out_of_range& e) {
@@ -94,6 +128,96 @@ static void from_json(const json& jsonObject, ConfigData& config)
 
 }
 
+namespace {
+
+/* Parse a configuration file from its stream and hand each section over
+ * once complete. Sections handed over are discarded from the parsed json
+ * object so that it never holds more than one rule */
+class StreamParser {
+
+public:
+    StreamParser(const IConfig::NetworkHandler& onNetwork,
+                 const IConfig::RuleHandler& onRule)
+        : m_onNetwork(onNetwork),
+          m_onRule(onRule)
+    {}
+
+    void parse(std::istream& stream)
+    {
+        // Members of the root object are at depth 1 and the elements of
+        // their arrays at depth 2
+        static_cast<void>(json::parse(
+            stream, [this](int depth, json::parse_event_t event, json& parsed) {
+                if ((depth == 1) && (event == json::parse_event_t::key)) {
+                    parsed.get_to(m_section);
+                    if ((m_section == JSON_ALIAS_RULES) && !m_hasNetwork) {
+                        throw std::invalid_argument(
+                            "Config: rules must come after the network section");
+                    }
+                    return true;
+                }
+
+                if (event != json::parse_event_t::object_end) {
+                    return true;
+                }
+
+                if ((depth == 1) && (m_section == JSON_ALIAS_NETWORK)) {
+                    handleNetwork(parsed);
+                    return false;
+                }
+
+                if ((depth == 2) && (m_section == JSON_ALIAS_RULES)) {
+                    handleRule(parsed);
+                    return false;
+                }
+
+                return true;
+            }));
+
+        if (!m_hasNetwork) {
+            throw std::invalid_argument("Config: network section not found");
+        }
+    }
+
+private:
+    void handleNetwork(const json& parsed)
+    {
+        ConfigData::Network network;
+        m_ignoreRules = !nlohmann::readNetwork(parsed, network);
+        m_hasNetwork  = true;
+
+        m_onNetwork(std::move(network));
+    }
+
+    /* A rule that can't be read is ignored along with the next ones, exactly
+     * like when the whole configuration is loaded */
+    void handleRule(const json& parsed)
+    {
+        if (m_ignoreRules) {
+            return;
+        }
+
+        ConfigData::Rule rule;
+        try {
+            rule = parsed.get<ConfigData::Rule>();
+        }
+        catch (const json::out_of_range& e) {
+            m_ignoreRules = true;
+            return;
+        }
+
+        m_onRule(std::move(rule));
+    }
+
+    const IConfig::NetworkHandler& m_onNetwork;
+    const IConfig::RuleHandler& m_onRule;
+    std::string m_section;
+    bool m_hasNetwork  = false;
+    bool m_ignoreRules = false;
+};
+
+}
+
 struct Config::Internal {
     const IReader& reader;
 
@@ -109,6 +233,18 @@ struct Config::Internal {
         json jsonObject = json::parse(result);
         return std::make_unique<ConfigData>(jsonObject.get<ConfigData>());
     }
+
+    static void streamConfigDataFrom(const std::string& configFile,
+                                     const NetworkHandler& onNetwork,
+                                     const RuleHandler& onRule)
+    {
+        std::ifstream stream(configFile);
+        if (!stream.good()) {
+            throw std::runtime_error("Config: Invalid input stream: " + configFile);
+        }
+
+        StreamParser(onNetwork, onRule).parse(stream);
+    }
 };
 
 Config::Config(const IReader& reader)
@@ -121,3 +257,10 @@ std::unique_ptr<ConfigData> Config::load(const std::string& configFile) const
 {
     return m_internal->getConfigDataFrom(configFile);
 }
+
+void Config::stream(const std::string& configFile,
+                    const NetworkHandler& onNetwork,
+                    const RuleHandler& onRule) const
+{
+    Internal::streamConfigDataFrom(configFile, onNetwork, onRule);
+}
@@ -27,44 +27,66 @@
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
 #include "utils/command/executor/IExecutor.h"
-#include "utils/command/parser/Parser.h"
 
+#include "set/SetLoader.h"
 #include "Rule.h"
 
+using namespace service::plugins::config;
 using namespace service::plugins::firewall;
+using namespace service::plugins::firewall::set;
 using namespace utils::command;
 
 struct Rule::Internal {
     const IExecutor& executor;
+    const std::shared_ptr<const CommandTable> table;
 
     const std::string& name;
-    const std::vector<std::string>& commands;
+    std::vector<CommandTable::Id> commands;
+    const std::vector<ConfigData::Rule::AddressSet>& sets;
+
+    const SetLoader setLoader;
 
     explicit Internal(const IExecutor& providedExecutor,
+                      const std::shared_ptr<CommandTable>& providedTable,
                       const std::string& providedName,
-                      const std::vector<std::string>& providedCommands)
+                      const std::vector<std::string>& providedCommands,
+                      const std::vector<ConfigData::Rule::AddressSet>& providedSets)
         : executor(providedExecutor),
+          table(providedTable),
           name(providedName),
-          commands(providedCommands)
-    {}
+          sets(providedSets),
+          setLoader(providedExecutor)
+    {
+        commands.reserve(providedCommands.size());
+        for (const std::string& command : providedCommands) {
+            commands.push_back(providedTable->add(command));
+        }
+    }
 };
 
 Rule::Rule(const std::string& name,
            const std::vector<std::string>& commands,
-           const IExecutor& executor)
-    : m_internal(std::make_unique<Internal>(executor, name, commands))
+           const std::vector<ConfigData::Rule::AddressSet>& sets,
+           const IExecutor& executor,
+           std::shared_ptr<CommandTable> table)
+    : m_internal(std::make_unique<Internal>(executor, table, name, commands, sets))
 {}
 
 Rule::~Rule() = default;
 
 void Rule::applyCommands() const
 {
-    for (const std::string& command : m_internal->commands) {
-        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& parsedCommand
-            = Parser::parse(command);
+    // Commands may refer to the sets (E.g: "-m set --match-set <name> src")
+    for (const ConfigData::Rule::AddressSet& set : m_internal->sets) {
+        (void)m_internal->setLoader.load(set, m_internal->name);
+    }
 
-        const IExecutor::ProgramParams params
-            = {parsedCommand->pathname, parsedCommand->argv, nullptr};
+    const CommandTable& table = *m_internal->table;
+    for (const CommandTable::Id command : m_internal->commands) {
+        const IExecutor::ProgramParams params = {table.pathname(command),
+                                                 table.argv(command),
+                                                 nullptr,
+                                                 m_internal->name.c_str()};
         m_internal->executor.executeProgram(params);
     }
 }
@@ -32,7 +32,9 @@
 #include <memory>
 
 #include "utils/command/executor/IExecutor.h"
+#include "utils/command/table/CommandTable.h"
 
+#include "service/plugins/IConfigData.h"
 #include "service/plugins/IRule.h"
 
 namespace service::plugins::firewall {
@@ -45,6 +47,9 @@ namespace service::plugins::firewall {
  *
  * This class is the "low level class" that implements @ref IRule.h
  *
+ * Commands are split into a @ref CommandTable when the rule is created so
+ * that applying them neither parses nor copies them.
+ *
  * @note Copy contructor, copy-assignment operator, move constructor and
  *       move-assignment operator are defined to be compliant with the
  *       "Rule of five"
@@ -63,11 +68,17 @@ public:
      * @param name     A name for the rule mainly used in logs messages to
      *                 help identifying rules
      * @param commands The list of shell commands that compose the rule
+     * @param sets     The sets of addresses to load before the commands
      * @param executor Command executor to use
+     * @param table    Where the commands are stored. It may be shared by
+     *                 several rules and is released with the last of them.
+     *                 Once the rule is created, "commands" can be released
      */
     explicit Rule(const std::string& name,
                   const std::vector<std::string>& commands,
-                  const utils::command::IExecutor& executor);
+                  const std::vector<config::ConfigData::Rule::AddressSet>& sets,
+                  const utils::command::IExecutor& executor,
+                  std::shared_ptr<utils::command::CommandTable> table);
 
     /**
      * Class destructor
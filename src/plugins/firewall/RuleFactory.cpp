@@ -26,28 +26,47 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <mutex>
+
 #include "RuleFactory.h"
 #include "Rule.h"
 
+using namespace service::plugins::config;
 using namespace service::plugins::firewall;
+using namespace utils::command;
 
 struct RuleFactory::Internal {
-    const utils::command::IExecutor& executor;
+    const IExecutor& executor;
+
+    /* Shared by the rules alive at the same time so that tokens are stored
+     * only once. Not owned: it goes away with the last of them */
+    std::mutex mutex;
+    std::weak_ptr<CommandTable> table;
 
-    explicit Internal(const utils::command::IExecutor& providedExecutor)
+    explicit Internal(const IExecutor& providedExecutor)
         : executor(providedExecutor)
     {}
 };
 
-RuleFactory::RuleFactory(const utils::command::IExecutor& executor)
+RuleFactory::RuleFactory(const IExecutor& executor)
     : m_internal(std::make_unique<Internal>(executor))
 {}
 
 RuleFactory::~RuleFactory() = default;
 
-std::unique_ptr<IRule>
-    RuleFactory::createRule(const std::string& name,
-                            const std::vector<std::string>& commands) const
+std::unique_ptr<IRule> RuleFactory::createRule(
+    const std::string& name,
+    const std::vector<std::string>& commands,
+    const std::vector<ConfigData::Rule::AddressSet>& sets) const
 {
-    return std::make_unique<Rule>(name, commands, m_internal->executor);
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    std::shared_ptr<CommandTable> table = m_internal->table.lock();
+    if (!table) {
+        table             = std::make_shared<CommandTable>();
+        m_internal->table = table;
+    }
+
+    return std::make_unique<Rule>(
+        name, commands, sets, m_internal->executor, std::move(table));
 }
@@ -45,6 +45,11 @@ namespace service::plugins::firewall {
  *
  * This class is the "low level class" that implements @ref IRuleFactory.h
  *
+ * The commands of the rules of an apply are stored in a single
+ * utils::command::CommandTable shared by them: it is created with the first
+ * rule and released with the last one, so nothing is left once the apply is
+ * over. Rules must not be applied while others are being created.
+ *
  * @note Copy contructor, copy-assignment operator, move constructor and
  *       move-assignment operator are defined to be compliant with the
  *       "Rule of five"
@@ -92,12 +97,15 @@ public:
      *
      * @param name     The name of the rule (For internal usage: logging, ...)
      * @param commands The list of shell commands that compose the rule
+     * @param sets     The sets of addresses the commands rely on
      *
      * @return The created rule
      */
     [[nodiscard]] std::unique_ptr<IRule>
         createRule(const std::string& name,
-                   const std::vector<std::string>& commands) const override;
+                   const std::vector<std::string>& commands,
+                   const std::vector<config::ConfigData::Rule::AddressSet>& sets)
+            const override;
 
 private:
     struct Internal;
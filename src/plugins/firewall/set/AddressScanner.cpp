@@ -0,0 +1,144 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <arpa/inet.h>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "AddressScanner.h"
+
+using namespace service::plugins::firewall::set;
+
+namespace {
+
+constexpr const char* const WHITESPACES = " \t\r";
+
+/* "<address>[/<length>]" with length not greater than the address size. A
+ * zero length would match every address and hash:net sets reject it */
+bool isValid(std::string_view entry, int family)
+{
+    const unsigned int maxLength = family == AF_INET ? 32 : 128;
+
+    const std::size_t slash = entry.find('/');
+    if (slash != std::string_view::npos) {
+        const std::string_view length = entry.substr(slash + 1);
+        if (length.empty() || (length.size() > 3)) {
+            return false;
+        }
+
+        unsigned int value = 0;
+        for (const char digit : length) {
+            if ((digit < '0') || (digit > '9')) {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned int>(digit - '0');
+        }
+
+        if ((value == 0) || (value > maxLength)) {
+            return false;
+        }
+        entry = entry.substr(0, slash);
+    }
+
+    // inet_pton() needs a null-terminated string
+    std::array<char, INET6_ADDRSTRLEN> address {};
+    if (entry.size() >= address.size()) {
+        return false;
+    }
+    entry.copy(address.data(), entry.size());
+
+    std::array<unsigned char, sizeof(struct in6_addr)> binary {};
+    return inet_pton(family, address.data(), binary.data()) == 1;
+}
+
+}
+
+struct AddressScanner::Internal {
+    std::string_view content;
+    int family;
+
+    std::size_t position = 0;
+    std::size_t line     = 0;
+
+    explicit Internal(std::string_view providedContent, int providedFamily)
+        : content(providedContent), family(providedFamily)
+    {}
+};
+
+AddressScanner::AddressScanner(std::string_view content, int family)
+    : m_internal(std::make_unique<Internal>(content, family))
+{
+    if ((family != AF_INET) && (family != AF_INET6)) {
+        throw std::invalid_argument("AddressScanner: Unsupported family: "
+                                    + std::to_string(family));
+    }
+}
+
+AddressScanner::~AddressScanner() = default;
+
+bool AddressScanner::next(std::string_view& address)
+{
+    const std::string_view& content = m_internal->content;
+    std::size_t& position           = m_internal->position;
+
+    while (position < content.size()) {
+        const char* const begin = content.data() + position;
+        const std::size_t remaining = content.size() - position;
+
+        const auto* const newline
+            = static_cast<const char*>(std::memchr(begin, '\n', remaining));
+        const std::size_t length = newline == nullptr
+                                       ? remaining
+                                       : static_cast<std::size_t>(newline - begin);
+
+        position += length + 1;
+        ++m_internal->line;
+
+        std::string_view entry(begin, length);
+        entry = entry.substr(0, entry.find('#'));
+
+        const std::size_t first = entry.find_first_not_of(WHITESPACES);
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        entry = entry.substr(first, entry.find_last_not_of(WHITESPACES) - first + 1);
+
+        if (!isValid(entry, m_internal->family)) {
+            throw std::invalid_argument(
+                "AddressScanner: Invalid address at line "
+                + std::to_string(m_internal->line) + ": " + std::string(entry));
+        }
+
+        address = entry;
+        return true;
+    }
+
+    return false;
+}
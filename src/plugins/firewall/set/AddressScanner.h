@@ -0,0 +1,107 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_FIREWALL_SET_ADDRESS_SCANNER_H__
+#define __PLUGINS_FIREWALL_SET_ADDRESS_SCANNER_H__
+
+#include <memory>
+#include <string_view>
+
+namespace service::plugins::firewall::set {
+
+/**
+ * @class AddressScanner AddressScanner.h "plugins/firewall/set/AddressScanner.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to extract addresses, one per line, from a buffer
+ *
+ * Lines are split with memchr() which the C library vectorizes, and each
+ * address is validated in place: nothing is copied so that a mapped file of
+ * any size can be scanned with constant memory. Blank lines and everything
+ * after '#' are ignored as well as leading and trailing whitespace. An
+ * address is either a host or a network in CIDR notation (E.g: 10.0.0.0/8).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class AddressScanner {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param content The buffer to scan. It must outlive the object
+     * @param family  The family of the expected addresses: AF_INET or
+     *                AF_INET6
+     *
+     * @throw std::invalid_argument if the family is not supported
+     */
+    explicit AddressScanner(std::string_view content, int family);
+
+    /** Class destructor */
+    ~AddressScanner();
+
+    /** Class copy constructor */
+    AddressScanner(const AddressScanner&) = delete;
+
+    /** Class copy-assignment operator */
+    AddressScanner& operator=(const AddressScanner&) = delete;
+
+    /** Class move constructor */
+    AddressScanner(AddressScanner&&) = delete;
+
+    /** Class move-assignment operator */
+    AddressScanner& operator=(AddressScanner&&) = delete;
+
+    /**
+     * @brief Move to the next address of the buffer
+     *
+     * @param address The output variable into which store the address. It
+     *                points into the scanned buffer
+     *
+     * @return false if there are no more addresses
+     *
+     * @throw std::invalid_argument if a line does not contain a valid
+     *        address of the expected family
+     */
+    [[nodiscard]] bool next(std::string_view& address);
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
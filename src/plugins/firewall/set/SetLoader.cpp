@@ -0,0 +1,331 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <arpa/inet.h>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+#include "utils/command/parser/Parser.h"
+#include "utils/command/pathname/DefaultPathnames.h"
+#include "utils/file/mapped/MappedFile.h"
+#include "utils/file/temporary/TemporaryFile.h"
+
+#include "AddressScanner.h"
+#include "SetLoader.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::firewall::set;
+using namespace utils::command;
+using namespace utils::file;
+
+namespace {
+
+using AddressSet = ConfigData::Rule::AddressSet;
+
+/* ipset sets are filled under this suffix then swapped in */
+constexpr const char* const TEMPORARY_SUFFIX = ".tmp";
+constexpr std::size_t MAX_IPSET_NAME_LENGTH  = 31;
+
+/* Defaults of "ipset create" below which sets are never sized */
+constexpr std::size_t MIN_HASH_SIZE    = 1024;
+constexpr std::size_t MIN_MAX_ELEMENTS = 65536;
+
+/* Names end up in restore files so they must not contain separators */
+bool isIdentifier(const std::string& value, bool allowSpaces)
+{
+    if (value.empty()) {
+        return false;
+    }
+
+    for (const char character : value) {
+        const bool isAllowed
+            = ((character >= 'a') && (character <= 'z'))
+              || ((character >= 'A') && (character <= 'Z'))
+              || ((character >= '0') && (character <= '9')) || (character == '_')
+              || (character == '-') || (character == '.')
+              || (allowSpaces && (character == ' '));
+        if (!isAllowed) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int familyOf(const AddressSet& set)
+{
+    if (set.family == "inet") {
+        return AF_INET;
+    }
+
+    if (set.family == "inet6") {
+        return AF_INET6;
+    }
+
+    throw std::invalid_argument("SetLoader: Unsupported family for set " + set.name
+                                + ": " + set.family);
+}
+
+void checkSet(const AddressSet& set)
+{
+    if (!isIdentifier(set.name, false)) {
+        throw std::invalid_argument("SetLoader: Invalid set name: " + set.name);
+    }
+
+    if ((set.backend != "ipset") && (set.backend != "nft")) {
+        throw std::invalid_argument("SetLoader: Unsupported backend for set "
+                                    + set.name + ": " + set.backend);
+    }
+
+    if ((set.backend == "ipset")
+        && (set.name.size() + std::strlen(TEMPORARY_SUFFIX)
+            > MAX_IPSET_NAME_LENGTH)) {
+        throw std::invalid_argument("SetLoader: Set name too long: " + set.name);
+    }
+
+    if ((set.backend == "nft") && !isIdentifier(set.table, true)) {
+        throw std::invalid_argument("SetLoader: Invalid table for set " + set.name
+                                    + ": " + set.table);
+    }
+}
+
+/* Sizes are rounded to powers of two so that reloading a file whose number
+ * of entries barely changed recreates the temporary set identically */
+std::size_t sizeFor(std::size_t nbEntries, std::size_t minimum)
+{
+    std::size_t size = minimum;
+    while (size < nbEntries) {
+        size *= 2;
+    }
+    return size;
+}
+
+std::string temporaryName(const AddressSet& set)
+{
+    return set.name + TEMPORARY_SUFFIX;
+}
+
+/* Counting before anything is loaded also validates the whole file so that
+ * an invalid entry leaves the set untouched */
+std::size_t countEntries(std::string_view content, int family)
+{
+    AddressScanner scanner(content, family);
+    std::string_view address;
+    std::size_t nbEntries = 0;
+    while (scanner.next(address)) {
+        ++nbEntries;
+    }
+    return nbEntries;
+}
+
+/* Statements creating then emptying the set. ipset sets are sized from the
+ * number of entries so that large files don't overflow the default maxelem */
+void writeHeader(std::ostream& stream, const AddressSet& set, std::size_t nbEntries)
+{
+    if (set.backend == "ipset") {
+        const std::string name = temporaryName(set);
+        stream << "create " << name << " hash:net family " << set.family
+               << " hashsize " << sizeFor(nbEntries, MIN_HASH_SIZE) << " maxelem "
+               << sizeFor(nbEntries, MIN_MAX_ELEMENTS) << "\n"
+               << "flush " << name << "\n";
+        return;
+    }
+
+    const char* const type = set.family == "inet" ? "ipv4_addr" : "ipv6_addr";
+    stream << "add table " << set.table << "\n"
+           << "add set " << set.table << " " << set.name << " { type " << type
+           << "; flags interval; auto-merge; }\n"
+           << "flush set " << set.table << " " << set.name << "\n";
+}
+
+/* Statements adding up to batchSize addresses. Returns how many were added */
+std::size_t writeBatch(std::ostream& stream,
+                       const AddressSet& set,
+                       AddressScanner& scanner,
+                       std::size_t batchSize)
+{
+    const std::string name = temporaryName(set);
+    std::string_view address;
+    std::size_t count = 0;
+
+    while ((count < batchSize) && scanner.next(address)) {
+        if (set.backend == "ipset") {
+            stream << "add " << name << " " << address << "\n";
+        }
+        else if (count == 0) {
+            stream << "add element " << set.table << " " << set.name << " { "
+                   << address;
+        }
+        else {
+            stream << ",\n" << address;
+        }
+        ++count;
+    }
+
+    if ((set.backend == "nft") && (count > 0)) {
+        stream << " }\n";
+    }
+
+    return count;
+}
+
+void closeBatch(std::ofstream& stream,
+                const AddressSet& set,
+                const TemporaryFile& batch)
+{
+    stream.close();
+    if (stream.fail()) {
+        throw std::runtime_error("SetLoader: Could not write batch of set "
+                                 + set.name + " to " + batch.pathname());
+    }
+}
+
+}
+
+struct SetLoader::Internal {
+    const IExecutor& executor;
+    const std::size_t batchSize;
+
+    explicit Internal(const IExecutor& providedExecutor,
+                      std::size_t providedBatchSize)
+        : executor(providedExecutor), batchSize(providedBatchSize)
+    {}
+
+    void execute(const AddressSet& set,
+                 const std::string& batchFile,
+                 const std::string& label) const
+    {
+        const std::string command
+            = set.backend == "ipset"
+                  ? std::string(DefaultPathnames::IPSET) + " -exist -file "
+                        + batchFile + " restore"
+                  : std::string(DefaultPathnames::NFT) + " -f " + batchFile;
+
+        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& parsedCommand
+            = Parser::parse(command);
+
+        const IExecutor::ProgramParams params
+            = {parsedCommand->pathname, parsedCommand->argv, nullptr, label.c_str()};
+        executor.executeProgram(params);
+    }
+
+    /* A file is a single nft transaction so the set is never seen half
+     * loaded. Elements are still split into statements of batchSize */
+    void loadNft(const AddressSet& set,
+                 AddressScanner& scanner,
+                 std::size_t nbEntries,
+                 const std::string& label) const
+    {
+        const TemporaryFile batch;
+        std::ofstream stream(batch.pathname(), std::ios_base::trunc);
+
+        writeHeader(stream, set, nbEntries);
+        while (writeBatch(stream, set, scanner, batchSize) > 0) {
+        }
+        closeBatch(stream, set, batch);
+
+        execute(set, batch.pathname(), label);
+    }
+
+    /* The entries are loaded into a temporary set, in batches, which is then
+     * swapped with the live one so that the latter goes from its old content
+     * to its new one at once */
+    void loadIpset(const AddressSet& set,
+                   AddressScanner& scanner,
+                   std::size_t nbEntries,
+                   const std::string& label) const
+    {
+        const TemporaryFile batch;
+        const std::string name = temporaryName(set);
+        std::size_t total      = 0;
+        bool isLastBatch       = false;
+
+        while (!isLastBatch) {
+            std::ofstream stream(batch.pathname(), std::ios_base::trunc);
+            if (total == 0) {
+                writeHeader(stream, set, nbEntries);
+            }
+
+            total += writeBatch(stream, set, scanner, batchSize);
+            isLastBatch = (total == nbEntries);
+            if (isLastBatch) {
+                stream << "swap " << name << " " << set.name << "\n"
+                       << "destroy " << name << "\n";
+            }
+            closeBatch(stream, set, batch);
+
+            if (!isLastBatch) {
+                execute(set, batch.pathname(), label);
+                continue;
+            }
+
+            try {
+                execute(set, batch.pathname(), label);
+            }
+            catch (const std::runtime_error&) {
+                // Nothing to swap with the first time so it becomes the set
+                std::ofstream renameStream(batch.pathname(), std::ios_base::trunc);
+                renameStream << "rename " << name << " " << set.name << "\n";
+                closeBatch(renameStream, set, batch);
+
+                execute(set, batch.pathname(), label);
+            }
+        }
+    }
+};
+
+SetLoader::SetLoader(const IExecutor& executor, std::size_t batchSize)
+    : m_internal(std::make_unique<Internal>(executor, batchSize))
+{
+    if (batchSize == 0) {
+        throw std::invalid_argument("SetLoader: The batch size can't be 0");
+    }
+}
+
+SetLoader::~SetLoader() = default;
+
+std::size_t SetLoader::load(const AddressSet& set, const std::string& label) const
+{
+    checkSet(set);
+
+    const MappedFile file(set.file);
+    const int family            = familyOf(set);
+    const std::size_t nbEntries = countEntries(file.content(), family);
+
+    AddressScanner scanner(file.content(), family);
+    if (set.backend == "ipset") {
+        m_internal->loadIpset(set, scanner, nbEntries, label);
+    }
+    else {
+        m_internal->loadNft(set, scanner, nbEntries, label);
+    }
+
+    return nbEntries;
+}
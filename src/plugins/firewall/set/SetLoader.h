@@ -0,0 +1,126 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_FIREWALL_SET_SET_LOADER_H__
+#define __PLUGINS_FIREWALL_SET_SET_LOADER_H__
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "utils/command/executor/IExecutor.h"
+
+#include "service/plugins/IConfigData.h"
+
+namespace service::plugins::firewall::set {
+
+/**
+ * @class SetLoader SetLoader.h "plugins/firewall/set/SetLoader.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to fill an ipset or nft set from a file of addresses
+ *
+ * The file is mapped into memory and scanned with @ref AddressScanner.h.
+ * It is scanned twice: first to count, and so validate, its addresses then
+ * to write them to a temporary file.
+ *
+ * With ipset, the addresses are loaded into a "<name>.tmp" set, created
+ * with a hashsize and a maxelem matching their number, in batches executed
+ * by "ipset restore". The last batch swaps it with the set, or renames it
+ * when the set does not exist yet, so that rules matching the set never
+ * see it partially loaded. Memory and disk usage are bounded by the batch
+ * size whatever the size of the list.
+ *
+ * With nft, the whole file is a single "nft -f" transaction which creates
+ * the set if needed, flushes it and adds the addresses by batches.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class SetLoader {
+
+public:
+    /** Default number of addresses loaded by a single program execution */
+    static constexpr std::size_t BATCH_SIZE = 65536;
+
+    /**
+     * Class constructor
+     *
+     * @param executor  Command executor to use
+     * @param batchSize Maximum number of addresses per batch
+     */
+    explicit SetLoader(const utils::command::IExecutor& executor,
+                       std::size_t batchSize = BATCH_SIZE);
+
+    /** Class destructor */
+    ~SetLoader();
+
+    /** Class copy constructor */
+    SetLoader(const SetLoader&) = delete;
+
+    /** Class copy-assignment operator */
+    SetLoader& operator=(const SetLoader&) = delete;
+
+    /** Class move constructor */
+    SetLoader(SetLoader&&) = delete;
+
+    /** Class move-assignment operator */
+    SetLoader& operator=(SetLoader&&) = delete;
+
+    /**
+     * @brief Create the set if needed and atomically replace its content by
+     *        the addresses of its file
+     *
+     * @param set   The set to load
+     * @param label Name of the rule the set belongs to (See
+     *              IExecutor::ProgramParams)
+     *
+     * @return The number of addresses loaded
+     *
+     * @throw std::invalid_argument if the set is misconfigured or its file
+     *        contains an invalid address
+     * @throw std::runtime_error if the file can't be read or a batch can't
+     *        be written
+     */
+    std::size_t load(const config::ConfigData::Rule::AddressSet& set,
+                     const std::string& label) const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
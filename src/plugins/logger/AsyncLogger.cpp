@@ -0,0 +1,305 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <sys/uio.h>
+#include <thread>
+#include <unistd.h>
+
+#include "Logger.h"
+
+#define BLUE   "\033[0;34m"
+#define YELLOW "\033[1;33m"
+#define RED    "\033[5;31m"
+#define GREEN  "\033[0;32m"
+
+#define END "\033[0m"
+
+using namespace service::plugins::logger;
+
+/* Records are pushed by any thread into a bounded lock-free ring buffer
+ * (multiple producers, single consumer) and written by a background thread
+ * using writev() so that the callers never wait for stdout/stderr.
+ *
+ * Each slot carries a sequence number telling whether it is free for the
+ * producer owning the position or ready for the consumer. Slots keep their
+ * string's capacity so that, once warmed up, logging does not allocate. */
+struct Logger::Internal {
+    /* Must be a power of 2 */
+    static constexpr std::size_t NB_SLOTS = 4096;
+
+    /* Maximum number of records written by a single writev() call */
+    static constexpr std::size_t BATCH_SIZE = 64;
+    static_assert(BATCH_SIZE <= IOV_MAX);
+
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        int fd;
+        std::string text;
+    };
+
+    std::array<Slot, NB_SLOTS> ring;
+    alignas(64) std::atomic<std::size_t> enqueuePosition {0};
+    alignas(64) std::size_t dequeuePosition {0};
+    std::atomic<std::size_t> nbDroppedRecords {0};
+
+    std::atomic<bool> isStopping {false};
+    std::atomic<bool> isConsumerSleeping {false};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread consumer;
+
+    const Level minLevel;
+
+    explicit Internal(Level providedMinLevel) : minLevel(providedMinLevel)
+    {
+        for (std::size_t index = 0; index < NB_SLOTS; ++index) {
+            ring[index].sequence.store(index, std::memory_order_relaxed);
+        }
+
+        consumer = std::thread([this]() { consume(); });
+    }
+
+    ~Internal()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopping.store(true);
+        }
+        condition.notify_one();
+        consumer.join();
+    }
+
+    Internal(const Internal&) = delete;
+    Internal& operator=(const Internal&) = delete;
+    Internal(Internal&&)                 = delete;
+    Internal& operator=(Internal&&) = delete;
+
+    /* Return false if the ring buffer is full */
+    bool tryPush(int fd, const char* color, const std::string& message)
+    {
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot           = nullptr;
+
+        for (;;) {
+            slot = &ring[position & (NB_SLOTS - 1)];
+            const std::size_t sequence
+                = slot->sequence.load(std::memory_order_acquire);
+
+            if (sequence == position) {
+                if (enqueuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (sequence < position) {
+                return false;
+            }
+            else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->fd = fd;
+        slot->text.assign(color).append(message).append(END "\n");
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        /* Pairs with the fence in consume() so that either the consumer sees
+         * the record or the producer sees it sleeping */
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (isConsumerSleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            condition.notify_one();
+        }
+
+        return true;
+    }
+
+    void push(int fd, const char* color, const std::string& message, bool canDrop)
+    {
+        while (!tryPush(fd, color, message)) {
+            if (canDrop) {
+                nbDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Errors are never dropped; wait for the consumer instead
+            std::this_thread::yield();
+        }
+    }
+
+    [[nodiscard]] bool isReady(std::size_t position) const
+    {
+        const Slot& slot = ring[position & (NB_SLOTS - 1)];
+        return slot.sequence.load(std::memory_order_acquire) == position + 1;
+    }
+
+    static void writeAll(int fd, iovec* iov, int iovcnt)
+    {
+        while (iovcnt > 0) {
+            ssize_t written = writev(fd, iov, iovcnt);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return; // Nowhere to report the error
+            }
+
+            auto remaining = static_cast<std::size_t>(written);
+            while ((iovcnt > 0) && (remaining >= iov->iov_len)) {
+                remaining -= iov->iov_len;
+                ++iov;
+                --iovcnt;
+            }
+
+            if (iovcnt > 0) {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + remaining;
+                iov->iov_len -= remaining;
+            }
+        }
+    }
+
+    /* Write consecutive ready records sharing the same fd at once.
+     * Return false if no record was ready */
+    bool writeBatch()
+    {
+        if (!isReady(dequeuePosition)) {
+            return false;
+        }
+
+        std::array<iovec, BATCH_SIZE> iov {};
+        const int fd      = ring[dequeuePosition & (NB_SLOTS - 1)].fd;
+        std::size_t count = 0;
+
+        while ((count < BATCH_SIZE) && isReady(dequeuePosition + count)) {
+            Slot& slot = ring[(dequeuePosition + count) & (NB_SLOTS - 1)];
+            if (slot.fd != fd) {
+                break;
+            }
+
+            iov[count].iov_base = slot.text.data();
+            iov[count].iov_len  = slot.text.size();
+            ++count;
+        }
+
+        writeAll(fd, iov.data(), static_cast<int>(count));
+
+        for (std::size_t index = 0; index < count; ++index) {
+            ring[dequeuePosition & (NB_SLOTS - 1)].sequence.store(
+                dequeuePosition + NB_SLOTS, std::memory_order_release);
+            ++dequeuePosition;
+        }
+
+        return true;
+    }
+
+    void reportDroppedRecords()
+    {
+        std::size_t nbDropped
+            = nbDroppedRecords.exchange(0, std::memory_order_relaxed);
+        if (nbDropped > 0) {
+            const std::string text = YELLOW "Logger: " + std::to_string(nbDropped)
+                                     + " record(s) dropped" END "\n";
+            iovec iov {const_cast<char*>(text.data()), text.size()};
+            writeAll(STDERR_FILENO, &iov, 1);
+        }
+    }
+
+    void consume()
+    {
+        /* Do not stop before everything has been written */
+        for (;;) {
+            while (writeBatch()) {
+            }
+            reportDroppedRecords();
+
+            std::unique_lock<std::mutex> lock(mutex);
+            if (isStopping.load() && !isReady(dequeuePosition)) {
+                break;
+            }
+
+            isConsumerSleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            condition.wait(lock, [this]() {
+                return isStopping.load() || isReady(dequeuePosition);
+            });
+            isConsumerSleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+};
+
+Logger::Logger(Level minLevel) : m_internal(std::make_unique<Internal>(minLevel)) {}
+
+Logger::~Logger() = default;
+
+void Logger::debug([[maybe_unused]] const std::string& message) const
+{
+#ifndef NDEBUG
+    if (isEnabled(Level::DEBUG)) {
+        m_internal->push(STDOUT_FILENO, BLUE, message, true);
+    }
+#endif
+}
+
+void Logger::info(const std::string& message) const
+{
+    if (isEnabled(Level::INFO)) {
+        m_internal->push(STDOUT_FILENO, GREEN, message, true);
+    }
+}
+
+void Logger::warn(const std::string& message) const
+{
+    if (isEnabled(Level::WARN)) {
+        m_internal->push(STDOUT_FILENO, YELLOW, message, true);
+    }
+}
+
+void Logger::error(const std::string& message) const
+{
+    if (isEnabled(Level::ERROR)) {
+        m_internal->push(STDERR_FILENO, RED, message, false);
+    }
+}
+
+bool Logger::isEnabled(Level level) const
+{
+#ifdef NDEBUG
+    if (level == Level::DEBUG) {
+        return false;
+    }
+#endif
+
+    return level >= m_internal->minLevel;
+}
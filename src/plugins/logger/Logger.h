@@ -55,8 +55,12 @@ namespace service::plugins::logger {
 class Logger : public ILogger {
 
 public:
-    /** Class constructor */
-    explicit Logger();
+    /**
+     * Class constructor
+     *
+     * @param minLevel Logs whose level is lower than this one are not printed
+     */
+    explicit Logger(Level minLevel = Level::DEBUG);
 
     /**
      * Class destructor
@@ -78,6 +82,12 @@ public:
     /** Class move-assignment operator */
     Logger& operator=(Logger&&) = delete;
 
+    /* Make lazy overloads from ILogger visible next to the overridden ones */
+    using ILogger::debug;
+    using ILogger::error;
+    using ILogger::info;
+    using ILogger::warn;
+
     /**
      * @brief Print debug-level logs
      *
@@ -106,6 +116,17 @@ public:
      */
     void error(const std::string& message) const override;
 
+    /**
+     * @brief Tell whether logs of a given level are printed
+     *
+     * @param level The level to check
+     *
+     * @return true if level is not lower than the one given to the
+     *         constructor (debug-level logs are never printed when NDEBUG
+     *         is defined), false otherwise
+     */
+    [[nodiscard]] bool isEnabled(Level level) const override;
+
 private:
     struct Internal;
     std::unique_ptr<Internal> m_internal;
@@ -40,6 +40,10 @@
 using namespace service::plugins::logger;
 
 struct Logger::Internal {
+    const Level minLevel;
+
+    explicit Internal(Level providedMinLevel) : minLevel(providedMinLevel) {}
+
     static inline void debug(const std::string& message,
                              const char* const color = BLUE)
     {
@@ -53,28 +57,47 @@ struct Logger::Internal {
     }
 };
 
-Logger::Logger() : m_internal(std::make_unique<Internal>()) {}
+Logger::Logger(Level minLevel) : m_internal(std::make_unique<Internal>(minLevel)) {}
 
 Logger::~Logger() = default;
 
 void Logger::debug([[maybe_unused]] const std::string& message) const
 {
 #ifndef NDEBUG
-    Internal::debug(message);
+    if (isEnabled(Level::DEBUG)) {
+        Internal::debug(message);
+    }
 #endif
 }
 
 void Logger::info(const std::string& message) const
 {
-    Internal::debug(message, GREEN);
+    if (isEnabled(Level::INFO)) {
+        Internal::debug(message, GREEN);
+    }
 }
 
 void Logger::warn(const std::string& message) const
 {
-    Internal::debug(message, YELLOW);
+    if (isEnabled(Level::WARN)) {
+        Internal::debug(message, YELLOW);
+    }
 }
 
 void Logger::error(const std::string& message) const
 {
-    Internal::error(message);
+    if (isEnabled(Level::ERROR)) {
+        Internal::error(message);
+    }
+}
+
+bool Logger::isEnabled(Level level) const
+{
+#ifdef NDEBUG
+    if (level == Level::DEBUG) {
+        return false;
+    }
+#endif
+
+    return level >= m_internal->minLevel;
 }
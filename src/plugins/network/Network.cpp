@@ -26,9 +26,12 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <fcntl.h>
 #include <ifaddrs.h>
+#include <sched.h>
 #include <stdexcept>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include "utils/helper/Errno.h"
 
@@ -102,3 +105,22 @@ void Network::applyLayerCommands(
         m_internal->layer.applyCommand(layerCommand.pathname, layerCommand.value);
     }
 }
+
+void Network::joinNamespace(const std::string& namespacePath) const
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    const int fd = open(namespacePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        throw std::runtime_error(
+            Errno::toString("open(" + namespacePath + ")", errno));
+    }
+
+    const int ret     = setns(fd, CLONE_NEWNET);
+    const int errnum  = errno;
+    (void)close(fd);
+
+    if (ret == -1) {
+        throw std::runtime_error(
+            Errno::toString("setns(" + namespacePath + ")", errnum));
+    }
+}
@@ -109,6 +109,13 @@ public:
             service::plugins::config::ConfigData::Network::LayerCommand>&
             layerCommands) const override;
 
+    /**
+     * @brief Move the calling thread into a network namespace
+     *
+     * @param namespacePath Path to the network namespace file
+     */
+    void joinNamespace(const std::string& namespacePath) const override;
+
 private:
     struct Internal;
     std::unique_ptr<Internal> m_internal;
@@ -26,11 +26,20 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <array>
+
 #include "Layer.h"
 
 using namespace service::plugins::network::layer;
 using namespace utils::file;
 
+namespace {
+
+/* Layer values are short (E.g: "1" written to a sysctl) */
+constexpr std::size_t BUFFER_SIZE = 256;
+
+}
+
 struct Layer::Internal {
     const IWriter& writer;
 
@@ -44,6 +53,11 @@ Layer::~Layer() = default;
 
 void Layer::applyCommand(const std::string& pathname, const std::string& value) const
 {
-    std::ofstream stream(pathname);
+    /* A buffer on the stack spares opening the file from allocating one.
+     * Longer values are written to the file without being copied into it */
+    std::array<char, BUFFER_SIZE> buffer {};
+    std::ofstream stream;
+    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    stream.open(pathname);
     m_internal->writer.writeToStream(stream, value);
 }
@@ -0,0 +1,105 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <sstream>
+#include <vector>
+
+#include "pass/CidrPass.h"
+#include "pass/IpsetPass.h"
+#include "pass/IptablesPass.h"
+#include "pass/NftVmapPass.h"
+
+#include "Optimizer.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer;
+using namespace service::plugins::optimizer::pass;
+using namespace utils::file;
+
+struct Optimizer::Internal {
+    std::vector<std::unique_ptr<IPass>> passes;
+    std::vector<std::string> changes;
+
+    explicit Internal(const IWriter& writer, Passes enabledPasses)
+    {
+        if ((enabledPasses & Passes::IPTABLES) != 0) {
+            passes.push_back(std::make_unique<IptablesPass>());
+        }
+
+        if ((enabledPasses & Passes::CIDR) != 0) {
+            passes.push_back(std::make_unique<CidrPass>());
+        }
+
+        if ((enabledPasses & Passes::IPSET) != 0) {
+            passes.push_back(std::make_unique<IpsetPass>(writer));
+        }
+
+        if ((enabledPasses & Passes::NFT_VMAP) != 0) {
+            passes.push_back(std::make_unique<NftVmapPass>());
+        }
+    }
+};
+
+Optimizer::Optimizer(const IWriter& writer, Passes passes)
+    : m_internal(std::make_unique<Internal>(writer, passes))
+{}
+
+Optimizer::~Optimizer() = default;
+
+void Optimizer::optimize(ConfigData& configData) const
+{
+    // Only what was done to this configuration is reported
+    m_internal->changes.clear();
+    for (const std::unique_ptr<IPass>& pass : m_internal->passes) {
+        pass->reset();
+    }
+
+    for (const std::unique_ptr<IPass>& pass : m_internal->passes) {
+        for (ConfigData::Rule& rule : configData.rules) {
+            for (const std::string& change : pass->run(rule)) {
+                m_internal->changes.push_back(std::string(pass->name()) + ": "
+                                              + rule.name + ": " + change);
+            }
+        }
+    }
+}
+
+std::string Optimizer::toString() const
+{
+    std::ostringstream stream;
+    if (m_internal->changes.empty()) {
+        return stream.str();
+    }
+
+    stream << "Optimizations:\n";
+    for (const std::string& change : m_internal->changes) {
+        stream << "  " << change << "\n";
+    }
+
+    return stream.str();
+}
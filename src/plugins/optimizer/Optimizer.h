@@ -0,0 +1,128 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_OPTIMIZER_H__
+#define __PLUGINS_OPTIMIZER_OPTIMIZER_H__
+
+#include <memory>
+#include <string>
+
+#include "utils/file/writer/IWriter.h"
+
+#include "service/plugins/IOptimizer.h"
+
+namespace service::plugins::optimizer {
+
+/**
+ * @class Optimizer Optimizer.h "plugins/optimizer/Optimizer.h"
+ * @ingroup Implementation
+ *
+ * @brief Rewrite a loaded configuration into an equivalent but cheaper one
+ *
+ * This class is the "low level class" that implements @ref IOptimizer.h
+ *
+ * The optimizer runs the enabled passes (see @ref Passes) on each rule, in
+ * the order of the enumeration, and keeps track of what they changed so
+ * that it can be reported. Only the changes made to the last configuration
+ * optimized are kept.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Optimizer : public IOptimizer {
+
+public:
+    /**
+     * @enum Passes
+     *
+     * @brief Bitmasks to select the passes to run
+     */
+    enum Passes : unsigned int {
+        NONE     = 0,          /**< Leave the configuration untouched */
+        IPTABLES = (1u << 0u), /**< Drop redundant rules, merge port lists */
+        CIDR     = (1u << 1u), /**< Aggregate address lists into prefixes */
+        IPSET    = (1u << 2u), /**< Fold address lists into ipsets */
+        NFT_VMAP = (1u << 3u)  /**< Compile nft dispatches into verdict maps */
+    };
+
+    /**
+     * Class constructor
+     *
+     * @param writer Writer object to write the files some passes generate
+     * @param passes A set of masks of type @ref Passes
+     */
+    explicit Optimizer(const utils::file::IWriter& writer, Passes passes = NONE);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~Optimizer() override;
+
+    /** Class copy constructor */
+    Optimizer(const Optimizer&) = delete;
+
+    /** Class copy-assignment operator */
+    Optimizer& operator=(const Optimizer&) = delete;
+
+    /** Class move constructor */
+    Optimizer(Optimizer&&) = delete;
+
+    /** Class move-assignment operator */
+    Optimizer& operator=(Optimizer&&) = delete;
+
+    /**
+     * @brief Run the enabled passes on each rule
+     *
+     * @param configData The configuration to optimize
+     */
+    void optimize(config::ConfigData& configData) const override;
+
+    /**
+     * @brief Describe what each pass changed in the last configuration
+     *
+     * @return One line per change or an empty string if nothing changed
+     */
+    [[nodiscard]] std::string toString() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,225 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <arpa/inet.h>
+#include <optional>
+
+#include "CidrPass.h"
+#include "PrefixTrie.h"
+#include "Tokens.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+using CommandTokens = std::vector<std::string>;
+using Prefix        = PrefixTrie::Prefix;
+
+bool isAddressOption(const std::string& token)
+{
+    return (token == "-s") || (token == "--source") || (token == "-d")
+           || (token == "--destination");
+}
+
+unsigned int nbBitsOf(int family)
+{
+    return family == AF_INET6 ? 128 : 32;
+}
+
+int familyOf(const CommandTokens& tokens)
+{
+    return Tokens::program(tokens) == "ip6tables" ? AF_INET6 : AF_INET;
+}
+
+/* Prefixes of a comma separated list of addresses */
+std::optional<std::vector<Prefix>> toPrefixes(const std::string& value, int family)
+{
+    std::vector<Prefix> prefixes;
+
+    std::size_t start = 0;
+    while (true) {
+        const std::size_t comma = value.find(',', start);
+        const std::string item  = value.substr(start, comma - start);
+        const std::size_t slash = item.find('/');
+
+        Prefix prefix;
+        if (inet_pton(family, item.substr(0, slash).c_str(), prefix.bytes.data())
+            != 1) {
+            return std::nullopt;
+        }
+
+        prefix.length = nbBitsOf(family);
+        if (slash != std::string::npos) {
+            const std::string length = item.substr(slash + 1);
+            if (length.empty() || (length.size() > 3)
+                || (length.find_first_not_of("0123456789") != std::string::npos)
+                || (std::stoul(length) > prefix.length)) {
+                return std::nullopt;
+            }
+
+            // Like iptables, bits after the length are ignored
+            prefix.length = static_cast<unsigned int>(std::stoul(length));
+        }
+
+        prefixes.push_back(prefix);
+
+        if (comma == std::string::npos) {
+            return prefixes;
+        }
+        start = comma + 1;
+    }
+}
+
+std::string toString(const Prefix& prefix, int family)
+{
+    char address[INET6_ADDRSTRLEN] = {};
+    (void)inet_ntop(family, prefix.bytes.data(), address, sizeof(address));
+
+    return prefix.length == nbBitsOf(family)
+               ? std::string(address)
+               : std::string(address) + "/" + std::to_string(prefix.length);
+}
+
+/* Position of each address option whose value is a list of prefixes */
+std::vector<std::size_t> addressOptions(const CommandTokens& tokens)
+{
+    std::vector<std::size_t> options;
+    if (!Tokens::isIptables(tokens) || !Tokens::isAppend(tokens)) {
+        return options;
+    }
+
+    for (std::size_t index = 1; index + 1 < tokens.size(); ++index) {
+        if (isAddressOption(tokens[index]) && (tokens[index - 1] != "!")
+            && toPrefixes(tokens[index + 1], familyOf(tokens))) {
+            options.push_back(index);
+        }
+    }
+
+    return options;
+}
+
+/* Whether both commands only differ by a list of prefixes at "position" */
+bool differOnlyByAddress(const CommandTokens& first,
+                         const CommandTokens& second,
+                         std::size_t position)
+{
+    if ((first.size() != second.size())
+        || !toPrefixes(second[position], familyOf(second))) {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < first.size(); ++index) {
+        if ((index != position) && (first[index] != second[index])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+const char* CidrPass::name() const
+{
+    return "cidr";
+}
+
+std::vector<std::string> CidrPass::run(ConfigData::Rule& rule) const
+{
+    std::vector<CommandTokens> commands;
+    commands.reserve(rule.commands.size());
+    for (const std::string& command : rule.commands) {
+        commands.push_back(Tokens::split(command));
+    }
+
+    std::vector<std::string> changes;
+    std::vector<std::string> result;
+    std::size_t first = 0;
+
+    while (first < commands.size()) {
+        const std::vector<std::size_t> options = addressOptions(commands[first]);
+        if (options.empty()) {
+            result.push_back(rule.commands[first]);
+            ++first;
+            continue;
+        }
+
+        std::size_t value = options[0] + 1;
+        std::size_t last  = first + 1;
+        for (const std::size_t option : options) {
+            std::size_t optionLast = first + 1;
+            while ((optionLast < commands.size())
+                   && differOnlyByAddress(
+                       commands[first], commands[optionLast], option + 1)) {
+                ++optionLast;
+            }
+
+            if (optionLast > last) {
+                value = option + 1;
+                last  = optionLast;
+            }
+        }
+
+        const int family = familyOf(commands[first]);
+        PrefixTrie trie(nbBitsOf(family));
+        bool overlaps           = false;
+        std::size_t nbAddresses = 0;
+        for (std::size_t index = first; index < last; ++index) {
+            const auto list = toPrefixes(commands[index][value], family);
+            for (const Prefix& prefix : *list) {
+                overlaps = trie.insert(prefix) || overlaps;
+                ++nbAddresses;
+            }
+        }
+
+        const std::vector<Prefix> prefixes = trie.prefixes();
+        if ((prefixes.size() >= nbAddresses)
+            || (overlaps && !Tokens::isTerminal(commands[first]))) {
+            result.insert(result.end(),
+                          rule.commands.begin() + static_cast<std::ptrdiff_t>(first),
+                          rule.commands.begin() + static_cast<std::ptrdiff_t>(last));
+            first = last;
+            continue;
+        }
+
+        CommandTokens command = commands[first];
+        for (const Prefix& prefix : prefixes) {
+            command[value] = toString(prefix, family);
+            result.push_back(Tokens::join(command));
+        }
+
+        changes.push_back(std::to_string(nbAddresses) + " addresses aggregated into "
+                          + std::to_string(prefixes.size()) + " prefixes");
+        first = last;
+    }
+
+    rule.commands = std::move(result);
+
+    return changes;
+}
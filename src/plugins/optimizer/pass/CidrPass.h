@@ -0,0 +1,78 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_CIDR_PASS_H__
+#define __PLUGINS_OPTIMIZER_PASS_CIDR_PASS_H__
+
+#include "IPass.h"
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class CidrPass CidrPass.h "plugins/optimizer/pass/CidrPass.h"
+ * @ingroup Implementation
+ *
+ * @brief Aggregate the addresses of iptables commands into the smallest
+ *        list of prefixes
+ *
+ * Consecutive "iptables -A" (or ip6tables) commands of a rule that only
+ * differ by the value of one -s/--source or -d/--destination option are
+ * seen as a single address list. Addresses (comma separated lists too)
+ * are inserted into a @ref PrefixTrie so that covered prefixes are dropped
+ * and adjacent ones are merged (two /24 into a /23, ...). The commands are
+ * then emitted again, one per remaining prefix, in the order of addresses.
+ *
+ * Packets matching several overlapping prefixes would go through a
+ * non-terminal command (LOG, MARK, ...) once instead of several times, so
+ * overlapping lists are only aggregated for terminal commands (ACCEPT,
+ * DROP, ...). Lists containing a value that is not an address of the
+ * family of the program (host names, non-CIDR masks, negations) are left
+ * untouched.
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class CidrPass : public IPass {
+
+public:
+    /** Short name of the pass */
+    [[nodiscard]] const char* name() const override;
+
+    /**
+     * @brief Aggregate the address lists of a rule
+     *
+     * @param rule The rule to rewrite
+     *
+     * @return One line per list aggregated
+     */
+    std::vector<std::string> run(config::ConfigData::Rule& rule) const override;
+};
+
+}
+
+#endif
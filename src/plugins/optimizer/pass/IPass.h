@@ -0,0 +1,98 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_IPASS_H__
+#define __PLUGINS_OPTIMIZER_PASS_IPASS_H__
+
+#include <string>
+#include <vector>
+
+#include "service/plugins/IConfigData.h"
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @interface IPass IPass.h "plugins/optimizer/pass/IPass.h"
+ * @ingroup Implementation
+ *
+ * @brief A single rewriting step run by the optimizer on each rule
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class IPass {
+
+public:
+    /** Class constructor */
+    IPass() = default;
+
+    /** Class destructor made virtual because it is used as base class */
+    virtual ~IPass() = default;
+
+    /** Class copy constructor */
+    IPass(const IPass&) = delete;
+
+    /** Class copy-assignment operator */
+    IPass& operator=(const IPass&) = delete;
+
+    /** Class move constructor */
+    IPass(IPass&&) = delete;
+
+    /** Class move-assignment operator */
+    IPass& operator=(IPass&&) = delete;
+
+    /** Short name of the pass used in reports (E.g: "ipset") */
+    [[nodiscard]] virtual const char* name() const = 0;
+
+    /**
+     * @brief Rewrite the commands of a rule in place
+     *
+     * @param rule The rule to rewrite
+     *
+     * @return A human readable description of each change made
+     */
+    virtual std::vector<std::string> run(config::ConfigData::Rule& rule) const = 0;
+
+    /**
+     * @brief Forget what the previous runs kept, e.g. the files they generated
+     *
+     * Called before the rules of a new configuration are run. Nothing to do by
+     * default.
+     */
+    virtual void reset() const {}
+};
+
+}
+
+#endif
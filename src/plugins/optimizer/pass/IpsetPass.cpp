@@ -0,0 +1,276 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "utils/file/temporary/TemporaryFile.h"
+
+#include "IpsetPass.h"
+#include "Tokens.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+using namespace utils::file;
+
+namespace {
+
+using CommandTokens = std::vector<std::string>;
+
+/* Sets are filled under this suffix then swapped in */
+constexpr const char* const TEMPORARY_SUFFIX = ".tmp";
+
+/* Defaults of "ipset create" below which sets are never sized */
+constexpr std::size_t MIN_HASH_SIZE    = 1024;
+constexpr std::size_t MIN_MAX_ELEMENTS = 65536;
+
+bool isAddressOption(const std::string& token)
+{
+    return (token == "-s") || (token == "--source") || (token == "-d")
+           || (token == "--destination");
+}
+
+bool isSourceOption(const std::string& token)
+{
+    return (token == "-s") || (token == "--source");
+}
+
+/* A single IPv4/IPv6 address or network. hash:net sets reject "/0" */
+bool isAddress(const std::string& value)
+{
+    const std::size_t length = value.size();
+    if ((length == 0)
+        || ((length >= 2) && (value.compare(length - 2, 2, "/0") == 0))) {
+        return false;
+    }
+
+    return value.find_first_not_of("0123456789abcdefABCDEF.:/") == std::string::npos;
+}
+
+/* Position of each address option whose value may go into a set */
+std::vector<std::size_t> foldableOptions(const CommandTokens& tokens)
+{
+    std::vector<std::size_t> options;
+    if (!Tokens::isIptables(tokens) || !Tokens::isAppend(tokens)) {
+        return options;
+    }
+
+    for (std::size_t index = 1; index + 1 < tokens.size(); ++index) {
+        if (isAddressOption(tokens[index]) && (tokens[index - 1] != "!")
+            && isAddress(tokens[index + 1])) {
+            options.push_back(index);
+        }
+    }
+
+    return options;
+}
+
+/* Whether both commands only differ by the value of the option at "option" */
+bool differOnlyByAddress(const CommandTokens& first,
+                         const CommandTokens& second,
+                         std::size_t option)
+{
+    if ((first.size() != second.size()) || !isAddress(second[option + 1])) {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < first.size(); ++index) {
+        if ((index != option + 1) && (first[index] != second[index])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Rounded to powers of two so that the size of a set rarely changes */
+std::size_t sizeFor(std::size_t nbEntries, std::size_t minimum)
+{
+    std::size_t size = minimum;
+    while (size < nbEntries) {
+        size *= 2;
+    }
+    return size;
+}
+
+/* FNV-1a so that names are stable from one run to the other */
+std::string setName(const std::string& key)
+{
+    constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    constexpr std::uint64_t FNV_PRIME        = 1099511628211ULL;
+
+    std::uint64_t hash = FNV_OFFSET_BASIS;
+    for (const char character : key) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= FNV_PRIME;
+    }
+
+    std::ostringstream name;
+    name << "ns" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return name.str();
+}
+
+}
+
+struct IpsetPass::Internal {
+    const IWriter& writer;
+
+    /* Files must exist until ipset reads them i.e when rules are applied so
+     * they are only removed when the next configuration is optimized */
+    std::vector<std::unique_ptr<TemporaryFile>> files;
+
+    explicit Internal(const IWriter& providedWriter) : writer(providedWriter) {}
+
+    /* Replace commands [first, last) by a set and a single command */
+    std::string fold(const std::string& ruleName,
+                     const std::vector<CommandTokens>& commands,
+                     std::size_t first,
+                     std::size_t last,
+                     std::size_t option,
+                     std::vector<std::string>& result)
+    {
+        CommandTokens folded = commands[first];
+        folded[option + 1]   = "*";
+
+        // The size is part of the name: "create -exist" of the live set
+        // below only succeeds if it was created with the same maxelem
+        const std::size_t nbEntries   = last - first;
+        const std::size_t maxElements = sizeFor(nbEntries, MIN_MAX_ELEMENTS);
+        std::string key
+            = ruleName + '\n' + Tokens::join(folded) + '\n' + std::to_string(first);
+        if (maxElements > MIN_MAX_ELEMENTS) {
+            key += '\n' + std::to_string(maxElements);
+        }
+
+        const std::string name      = setName(key);
+        const std::string temporary = name + TEMPORARY_SUFFIX;
+        const char* const family
+            = Tokens::program(folded) == "ip6tables" ? "inet6" : "inet";
+        const std::string type = std::string(" hash:net family ") + family
+                                 + " hashsize "
+                                 + std::to_string(sizeFor(nbEntries, MIN_HASH_SIZE))
+                                 + " maxelem " + std::to_string(maxElements) + "\n";
+
+        // Filled aside then swapped so that the live set is never seen empty.
+        // It is created empty first when it doesn't exist yet
+        std::string content = "create " + temporary + type + "flush " + temporary
+                              + "\n";
+        for (std::size_t index = first; index < last; ++index) {
+            content += "add " + temporary + " " + commands[index][option + 1] + "\n";
+        }
+        content += "create " + name + type + "swap " + temporary + " " + name + "\n"
+                   + "destroy " + temporary + "\n";
+
+        auto file = std::make_unique<TemporaryFile>();
+        {
+            std::ofstream stream(file->pathname());
+            writer.writeToStream(stream, content);
+        }
+
+        const std::size_t slash = folded[0].rfind('/');
+        const std::string ipset
+            = (slash == std::string::npos ? "" : folded[0].substr(0, slash + 1))
+              + "ipset";
+        result.push_back(ipset + " -exist -file " + file->pathname() + " restore");
+        files.push_back(std::move(file));
+
+        const char* const direction = isSourceOption(folded[option]) ? "src" : "dst";
+        folded[option]              = "-m";
+        folded[option + 1]          = "set";
+        folded.insert(folded.begin() + static_cast<std::ptrdiff_t>(option) + 2,
+                      {"--match-set", name, direction});
+        result.push_back(Tokens::join(folded));
+
+        return name;
+    }
+};
+
+IpsetPass::IpsetPass(const IWriter& writer)
+    : m_internal(std::make_unique<Internal>(writer))
+{}
+
+IpsetPass::~IpsetPass() = default;
+
+const char* IpsetPass::name() const
+{
+    return "ipset";
+}
+
+void IpsetPass::reset() const
+{
+    m_internal->files.clear();
+}
+
+std::vector<std::string> IpsetPass::run(ConfigData::Rule& rule) const
+{
+    std::vector<CommandTokens> commands;
+    commands.reserve(rule.commands.size());
+    for (const std::string& command : rule.commands) {
+        commands.push_back(Tokens::split(command));
+    }
+
+    std::vector<std::string> changes;
+    std::vector<std::string> result;
+    std::size_t first = 0;
+
+    while (first < commands.size()) {
+        std::size_t bestOption = 0;
+        std::size_t bestLast   = first + 1;
+
+        for (const std::size_t option : foldableOptions(commands[first])) {
+            std::size_t last = first + 1;
+            while ((last < commands.size())
+                   && differOnlyByAddress(commands[first], commands[last], option)) {
+                ++last;
+            }
+
+            if (last > bestLast) {
+                bestOption = option;
+                bestLast   = last;
+            }
+        }
+
+        if (bestLast - first < MIN_ADDRESSES) {
+            result.push_back(rule.commands[first]);
+            ++first;
+            continue;
+        }
+
+        const std::string name = m_internal->fold(
+            rule.name, commands, first, bestLast, bestOption, result);
+        changes.push_back(std::to_string(bestLast - first)
+                          + " commands folded into set " + name);
+        first = bestLast;
+    }
+
+    rule.commands = std::move(result);
+
+    return changes;
+}
@@ -0,0 +1,129 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_IPSET_PASS_H__
+#define __PLUGINS_OPTIMIZER_PASS_IPSET_PASS_H__
+
+#include <memory>
+
+#include "utils/file/writer/IWriter.h"
+
+#include "IPass.h"
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class IpsetPass IpsetPass.h "plugins/optimizer/pass/IpsetPass.h"
+ * @ingroup Implementation
+ *
+ * @brief Fold iptables commands that only differ by their address into a
+ *        single command matching an ipset
+ *
+ * A chain of "iptables -A ... -s <address> -j DROP" commands is evaluated
+ * linearly by the kernel for each packet. When at least @ref MIN_ADDRESSES
+ * consecutive commands of a rule are identical except for the value of
+ * one -s/--source or -d/--destination option, they are replaced by:
+ * - "ipset -exist -file <file> restore" which, in a single process, adds
+ *   all addresses to a temporary hash:net set sized for them then swaps
+ *   it with the set (created empty if needed) so that the latter goes from
+ *   its old addresses to its new ones at once,
+ * - one iptables command with "-m set --match-set <set> src|dst" instead
+ *   of the address option so that the lookup costs O(1) per packet.
+ *
+ * Only consecutive commands are folded so that the order in which the
+ * kernel evaluates rules with different verdicts is preserved. Negated
+ * addresses ("! -s") and lists of addresses are left untouched. Set names
+ * are derived from the rule so that applying the same configuration again
+ * reuses the same sets, unless their maxelem changes. Files read by ipset
+ * live until the next configuration is optimized (see @ref reset).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class IpsetPass : public IPass {
+
+public:
+    /** Minimum number of commands worth a set */
+    static constexpr std::size_t MIN_ADDRESSES = 4;
+
+    /**
+     * Class constructor
+     *
+     * @param writer Writer object to write the files read by ipset
+     */
+    explicit IpsetPass(const utils::file::IWriter& writer);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~IpsetPass() override;
+
+    /** Class copy constructor */
+    IpsetPass(const IpsetPass&) = delete;
+
+    /** Class copy-assignment operator */
+    IpsetPass& operator=(const IpsetPass&) = delete;
+
+    /** Class move constructor */
+    IpsetPass(IpsetPass&&) = delete;
+
+    /** Class move-assignment operator */
+    IpsetPass& operator=(IpsetPass&&) = delete;
+
+    /** Short name of the pass */
+    [[nodiscard]] const char* name() const override;
+
+    /**
+     * @brief Fold address lists of a rule into sets
+     *
+     * @param rule The rule to rewrite
+     *
+     * @return One line per set created
+     */
+    std::vector<std::string> run(config::ConfigData::Rule& rule) const override;
+
+    /** Remove the files of the sets created by the previous runs */
+    void reset() const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
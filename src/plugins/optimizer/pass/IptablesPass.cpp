@@ -0,0 +1,432 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <set>
+
+#include "IptablesPass.h"
+#include "Tokens.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+using CommandTokens = std::vector<std::string>;
+
+/* An iptables command seen as a chain, a conjunction of conditions and an action */
+struct Command {
+    char operation = 0; /* Short form of the command option: 'A', 'I', ... */
+    std::string chain;  /* "<program> <table> <chain>" */
+    std::string table;  /* "<program> <table>" */
+    std::set<std::string> conditions;
+    std::string action; /* "-j <target> <target options>" */
+    bool isStateful = false;
+};
+
+std::string canonical(const std::string& option)
+{
+    static const std::map<std::string, std::string> longOptions {
+        {"--append", "-A"},       {"--insert", "-I"},
+        {"--delete", "-D"},       {"--replace", "-R"},
+        {"--flush", "-F"},        {"--delete-chain", "-X"},
+        {"--rename-chain", "-E"}, {"--new-chain", "-N"},
+        {"--policy", "-P"},       {"--zero", "-Z"},
+        {"--list", "-L"},         {"--list-rules", "-S"},
+        {"--check", "-C"},        {"--table", "-t"},
+        {"--protocol", "-p"},     {"--source", "-s"},
+        {"--destination", "-d"},  {"--in-interface", "-i"},
+        {"--out-interface", "-o"}, {"--fragment", "-f"},
+        {"--match", "-m"},        {"--jump", "-j"},
+        {"--goto", "-g"},         {"--destination-port", "--dport"},
+        {"--source-port", "--sport"}, {"--wait", "-w"},
+        {"--wait-interval", "-W"}, {"--verbose", "-v"},
+        {"--numeric", "-n"},      {"--exact", "-x"}};
+
+    const auto it = longOptions.find(option);
+    return it == longOptions.end() ? option : it->second;
+}
+
+bool isOption(const std::string& token)
+{
+    return (token.size() > 1) && (token[0] == '-')
+           && ((token[1] < '0') || (token[1] > '9'));
+}
+
+bool isCommandOption(const std::string& option)
+{
+    return (option.size() == 2) && (option[0] == '-')
+           && (std::string("AIDRFXENPZLSC").find(option[1]) != std::string::npos);
+}
+
+bool isGlobalOption(const std::string& option)
+{
+    return (option == "-w") || (option == "-W") || (option == "-v")
+           || (option == "-n") || (option == "-x") || (option == "--line-numbers");
+}
+
+/* Options that do not belong to the module loaded before them */
+bool isGenericMatch(const std::string& option)
+{
+    return (option == "-p") || (option == "-s") || (option == "-d")
+           || (option == "-i") || (option == "-o") || (option == "-f");
+}
+
+/* Modules whose result for a packet depends on the previous evaluations */
+bool isStatefulModule(const std::string& module)
+{
+    static const std::set<std::string> modules {
+        "limit", "hashlimit", "recent", "statistic", "quota", "connlimit"};
+    return modules.count(module) != 0;
+}
+
+std::string targetOf(const Command& command)
+{
+    const CommandTokens tokens = Tokens::split(command.action);
+    return (tokens.size() >= 2) && (tokens[0] == "-j") ? tokens[1] : "";
+}
+
+bool isTerminal(const Command& command)
+{
+    return Tokens::isTerminal(Tokens::split(command.action));
+}
+
+/* Packets go on unmodified after a passive command */
+bool isPassive(const Command& command)
+{
+    const std::string target = targetOf(command);
+    return command.action.empty() || isTerminal(command) || (target == "LOG")
+           || (target == "NFLOG");
+}
+
+std::optional<Command> parse(const CommandTokens& tokens)
+{
+    if (!Tokens::isIptables(tokens)) {
+        return std::nullopt;
+    }
+
+    Command command;
+    std::string table = "filter";
+    std::string module;
+    bool isNegated = false;
+
+    std::size_t index = 1;
+    while (index < tokens.size()) {
+        if (tokens[index] == "!") {
+            // The old "--option ! value" syntax is not supported
+            if (isNegated || (index + 1 == tokens.size())
+                || !isOption(tokens[index + 1])) {
+                return std::nullopt;
+            }
+
+            isNegated = true;
+            ++index;
+            continue;
+        }
+
+        if (!isOption(tokens[index])) {
+            return std::nullopt;
+        }
+
+        const std::size_t optionIndex = index;
+        const std::string option      = canonical(tokens[index]);
+        ++index;
+        while ((index < tokens.size()) && (tokens[index] != "!")
+               && !isOption(tokens[index])) {
+            ++index;
+        }
+
+        const CommandTokens values(
+            tokens.begin() + static_cast<std::ptrdiff_t>(optionIndex) + 1,
+            tokens.begin() + static_cast<std::ptrdiff_t>(index));
+
+        if ((option == "-j") || (option == "-g")) {
+            if (isNegated || values.size() != 1) {
+                return std::nullopt;
+            }
+
+            // Whatever follows the target are options of the target
+            const auto target
+                = tokens.begin() + static_cast<std::ptrdiff_t>(optionIndex);
+            command.action = option + ' ' + Tokens::join({target + 1, tokens.end()});
+            break;
+        }
+
+        if (isCommandOption(option)) {
+            if (isNegated || (command.operation != 0)) {
+                return std::nullopt;
+            }
+
+            command.operation = option[1];
+            // A renamed chain is seen as a change to the whole table
+            command.chain = values.empty() || (command.operation == 'E')
+                                ? std::string()
+                                : values[0];
+        }
+        else if (option == "-t") {
+            if (values.size() != 1) {
+                return std::nullopt;
+            }
+            table = values[0];
+        }
+        else if (option == "-m") {
+            if (isNegated || values.size() != 1) {
+                return std::nullopt;
+            }
+
+            module             = values[0];
+            command.isStateful = command.isStateful || isStatefulModule(module);
+            command.conditions.insert("-m " + module);
+        }
+        else if (!isGlobalOption(option)) {
+            const std::string owner
+                = isGenericMatch(option) || module.empty() ? "" : module + ' ';
+            command.conditions.insert((isNegated ? "! " : "") + owner + option + ' '
+                                      + Tokens::join(values));
+        }
+
+        isNegated = false;
+    }
+
+    if ((command.operation == 0)
+        || ((command.operation == 'A') && command.chain.empty())) {
+        return std::nullopt;
+    }
+
+    command.table = Tokens::program(tokens) + ' ' + table;
+    command.chain = command.table + ' ' + command.chain;
+
+    return command;
+}
+
+bool isPortOption(const std::string& token)
+{
+    return (token == "--dport") || (token == "--destination-port")
+           || (token == "--sport") || (token == "--source-port");
+}
+
+/* A port or a "first:last" range of ports */
+bool isPort(const std::string& value)
+{
+    const std::size_t colon = value.find(':');
+    return !value.empty() && (value.front() != ':') && (value.back() != ':')
+           && (value.find_first_not_of("0123456789:") == std::string::npos)
+           && ((colon == std::string::npos)
+               || (value.find(':', colon + 1) == std::string::npos));
+}
+
+/* Number of ports a value uses among the ones "-m multiport" accepts */
+std::size_t portCount(const std::string& value)
+{
+    return value.find(':') == std::string::npos ? 1 : 2;
+}
+
+/* Position of the --dport/--sport option whose value may go into a list */
+std::optional<std::size_t> portOption(const CommandTokens& tokens)
+{
+    static const std::set<std::string> protocols {
+        "tcp", "udp", "udplite", "sctp", "dccp"};
+
+    if (!Tokens::isIptables(tokens) || !Tokens::isAppend(tokens)
+        || (std::find(tokens.begin(), tokens.end(), "multiport") != tokens.end())) {
+        return std::nullopt;
+    }
+
+    bool hasProtocol = false;
+    for (std::size_t index = 1; index + 1 < tokens.size(); ++index) {
+        if (canonical(tokens[index]) == "-p") {
+            hasProtocol = (tokens[index - 1] != "!")
+                          && (protocols.count(tokens[index + 1]) != 0);
+        }
+        else if (hasProtocol && isPortOption(tokens[index])
+                 && (tokens[index - 1] != "!") && isPort(tokens[index + 1])) {
+            return index;
+        }
+    }
+
+    return std::nullopt;
+}
+
+/* Whether both commands only differ by the value at "position" */
+bool differOnlyAt(const CommandTokens& first,
+                  const CommandTokens& second,
+                  std::size_t position)
+{
+    if (first.size() != second.size()) {
+        return false;
+    }
+
+    for (std::size_t index = 0; index < first.size(); ++index) {
+        if ((index != position) && (first[index] != second[index])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+const char* IptablesPass::name() const
+{
+    return "iptables";
+}
+
+std::vector<std::string> IptablesPass::run(ConfigData::Rule& rule) const
+{
+    std::vector<CommandTokens> tokens;
+    std::vector<std::optional<Command>> commands;
+    tokens.reserve(rule.commands.size());
+    commands.reserve(rule.commands.size());
+
+    bool isUnderstood = true;
+    std::set<std::string> reorderedChains;
+    for (const std::string& command : rule.commands) {
+        tokens.push_back(Tokens::split(command));
+        commands.push_back(parse(tokens.back()));
+
+        // A command that can't be read could modify packets or reorder rules
+        if (!commands.back()) {
+            isUnderstood = isUnderstood && !Tokens::isIptables(tokens.back());
+        }
+        else if (std::string("IDRFXE").find(commands.back()->operation)
+                 != std::string::npos) {
+            reorderedChains.insert(commands.back()->chain);
+        }
+    }
+
+    std::vector<std::string> changes;
+    std::vector<std::size_t> kept;
+
+    // Earlier commands of each chain that every next packet goes through
+    std::map<std::string, std::vector<std::size_t>> shadowing;
+
+    for (std::size_t index = 0; index < commands.size(); ++index) {
+        const std::optional<Command>& command = commands[index];
+        if (!isUnderstood || !command || (command->operation != 'A')
+            || (reorderedChains.count(command->chain) != 0)
+            || (reorderedChains.count(command->table + ' ') != 0)) {
+            kept.push_back(index);
+            continue;
+        }
+
+        std::vector<std::size_t>& earlier = shadowing[command->chain];
+        const auto shadow
+            = std::find_if(earlier.begin(), earlier.end(), [&](std::size_t other) {
+                  return std::includes(command->conditions.begin(),
+                                       command->conditions.end(),
+                                       commands[other]->conditions.begin(),
+                                       commands[other]->conditions.end());
+              });
+
+        if (shadow != earlier.end()) {
+            const Command& other   = *commands[*shadow];
+            const bool isDuplicate = (other.conditions == command->conditions)
+                                     && (other.action == command->action);
+            changes.push_back("command " + std::to_string(index + 1)
+                              + (isDuplicate ? " duplicates" : " is shadowed by")
+                              + " command " + std::to_string(*shadow + 1)
+                              + ", dropped");
+            continue;
+        }
+
+        kept.push_back(index);
+        if (isTerminal(*command)) {
+            if (!command->isStateful) {
+                earlier.push_back(index);
+            }
+        }
+        else if (!isPassive(*command)) {
+            earlier.clear();
+        }
+    }
+
+    std::vector<std::string> result;
+    std::size_t position = 0;
+
+    while (position < kept.size()) {
+        const std::size_t first                 = kept[position];
+        const std::optional<std::size_t> option = portOption(tokens[first]);
+        std::size_t last                        = position + 1;
+
+        if (option) {
+            const std::size_t value = *option + 1;
+            // Overlapping ranges would evaluate non-terminal commands once
+            const bool canOverlap = commands[first] && isTerminal(*commands[first]);
+            const bool canMerge
+                = canOverlap || (portCount(tokens[first][value]) == 1);
+            std::set<std::string> ports {tokens[first][value]};
+            std::size_t nbPorts = portCount(tokens[first][value]);
+
+            while (canMerge && (last < kept.size())) {
+                const CommandTokens& next = tokens[kept[last]];
+                if (!differOnlyAt(tokens[first], next, value) || !isPort(next[value])
+                    || (nbPorts + portCount(next[value]) > MAX_PORTS)
+                    || (!canOverlap
+                        && ((portCount(next[value]) != 1)
+                            || !ports.insert(next[value]).second))) {
+                    break;
+                }
+
+                nbPorts += portCount(next[value]);
+                ++last;
+            }
+        }
+
+        if (last - position < 2) {
+            result.push_back(rule.commands[first]);
+            ++position;
+            continue;
+        }
+
+        CommandTokens merged = tokens[first];
+        std::string ports;
+        for (std::size_t index = position; index < last; ++index) {
+            ports += (ports.empty() ? "" : ",") + tokens[kept[index]][*option + 1];
+        }
+
+        const std::string list
+            = canonical(merged[*option]) == "--sport" ? "--sports" : "--dports";
+        merged[*option]     = list;
+        merged[*option + 1] = ports;
+        merged.insert(merged.begin() + static_cast<std::ptrdiff_t>(*option),
+                      {"-m", "multiport"});
+        result.push_back(Tokens::join(merged));
+
+        changes.push_back(std::to_string(last - position)
+                          + " commands merged into -m multiport " + list + " "
+                          + ports);
+        position = last;
+    }
+
+    rule.commands = std::move(result);
+
+    return changes;
+}
@@ -0,0 +1,85 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_IPTABLES_PASS_H__
+#define __PLUGINS_OPTIMIZER_PASS_IPTABLES_PASS_H__
+
+#include "IPass.h"
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class IptablesPass IptablesPass.h "plugins/optimizer/pass/IptablesPass.h"
+ * @ingroup Implementation
+ *
+ * @brief Remove redundant iptables commands and merge port lists
+ *
+ * Each "iptables -A" command is read as a chain (program, table, chain),
+ * a set of conditions (option and values, attached to the "-m" module that
+ * defines them) and an action (-j/-g and the options after it). Then:
+ * - A command is dropped when an earlier command of the same chain has a
+ *   terminal verdict (ACCEPT, DROP, REJECT, RETURN, DNAT, ...) and a
+ *   subset of its conditions: every packet it could match has already
+ *   left the chain. It is reported as a duplicate when both commands
+ *   have the same conditions and action, as shadowed otherwise.
+ * - At most @ref MAX_PORTS consecutive commands that only differ by their
+ *   --dport (or --sport) value are merged into one "-m multiport" command.
+ *
+ * To stay equivalent, a command can't shadow others when it depends on a
+ * state updated by each evaluation (limit, recent, statistic, ...) nor
+ * beyond a command that may modify packets or marks (MARK, jump to a user
+ * chain, ...). Chains also touched by -I, -D, -R, -F, -X or -E are left
+ * untouched because the final order of their rules can't be known here.
+ * Duplicates of non-terminal commands (LOG, MARK, ...) are kept since each
+ * evaluation has an effect. Only commands of the same rule are compared.
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class IptablesPass : public IPass {
+
+public:
+    /** Maximum number of ports a "-m multiport" match accepts */
+    static constexpr std::size_t MAX_PORTS = 15;
+
+    /** Short name of the pass */
+    [[nodiscard]] const char* name() const override;
+
+    /**
+     * @brief Drop duplicated and shadowed commands then merge port lists
+     *
+     * @param rule The rule to rewrite
+     *
+     * @return One line per command dropped and per merge
+     */
+    std::vector<std::string> run(config::ConfigData::Rule& rule) const override;
+};
+
+}
+
+#endif
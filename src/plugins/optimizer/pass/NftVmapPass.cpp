@@ -0,0 +1,211 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <set>
+
+#include "NftVmapPass.h"
+#include "Tokens.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+using CommandTokens = std::vector<std::string>;
+
+/* A command that matches "selector value" and then applies "verdict" */
+struct Branch {
+    std::string head; /* nft add rule ... <selector> */
+    std::string selector;
+    std::string value;
+    std::string verdict;
+};
+
+bool isFamily(const std::string& token)
+{
+    static const std::set<std::string> families {
+        "ip", "ip6", "inet", "arp", "bridge", "netdev"};
+    return families.count(token) != 0;
+}
+
+/* Selectors whose values have a type maps can be keyed by */
+bool isSelector(const std::string& selector)
+{
+    static const std::set<std::string> selectors {
+        "tcp dport",    "tcp sport",    "udp dport",    "udp sport",
+        "ip saddr",     "ip daddr",     "ip6 saddr",    "ip6 daddr",
+        "iifname",      "oifname",      "meta iifname", "meta oifname",
+        "meta l4proto", "meta mark",    "ct state"};
+    return selectors.count(selector) != 0;
+}
+
+/* A single value: no set, prefix, range, negation or comparison */
+bool isSingleValue(const std::string& value)
+{
+    if (value.empty() || (value.find_first_of("{}/,!<>*\"") != std::string::npos)) {
+        return false;
+    }
+
+    // Ranges only make sense for numbers (ports, addresses, marks)
+    const bool isNumeric = (value[0] >= '0') && (value[0] <= '9');
+    return !isNumeric || (value.find('-') == std::string::npos);
+}
+
+std::size_t verdictSize(const CommandTokens& tokens)
+{
+    const std::string& last = tokens.back();
+    if ((last == "accept") || (last == "drop") || (last == "return")
+        || (last == "continue")) {
+        return 1;
+    }
+
+    const std::string& beforeLast = tokens[tokens.size() - 2];
+    return (beforeLast == "jump") || (beforeLast == "goto") ? 2 : 0;
+}
+
+/* Verdicts after which the linear form never evaluates the next rules */
+bool isTerminal(const std::string& verdict)
+{
+    return (verdict == "accept") || (verdict == "drop");
+}
+
+std::optional<Branch> toBranch(const CommandTokens& tokens)
+{
+    // nft add rule [<family>] <table> <chain> <selector> <value> <verdict>
+    if ((tokens.size() < 8) || (Tokens::program(tokens) != "nft")
+        || (tokens[1] != "add") || (tokens[2] != "rule")) {
+        return std::nullopt;
+    }
+
+    const std::size_t selectorStart = isFamily(tokens[3]) ? 6 : 5;
+    const std::size_t nbVerdictTokens = verdictSize(tokens);
+    if ((nbVerdictTokens == 0)
+        || (tokens.size() < selectorStart + nbVerdictTokens + 2)) {
+        return std::nullopt;
+    }
+
+    const std::size_t valueIndex = tokens.size() - nbVerdictTokens - 1;
+    const auto first             = tokens.begin();
+    const auto value             = first + static_cast<std::ptrdiff_t>(valueIndex);
+
+    Branch branch {
+        Tokens::join({first, value}),
+        Tokens::join({first + static_cast<std::ptrdiff_t>(selectorStart), value}),
+        *value,
+        Tokens::join({value + 1, tokens.end()})};
+
+    if (!isSelector(branch.selector) || !isSingleValue(branch.value)) {
+        return std::nullopt;
+    }
+
+    return branch;
+}
+
+}
+
+const char* NftVmapPass::name() const
+{
+    return "nft-vmap";
+}
+
+std::vector<std::string> NftVmapPass::run(ConfigData::Rule& rule) const
+{
+    std::vector<std::optional<Branch>> branches;
+    branches.reserve(rule.commands.size());
+    for (const std::string& command : rule.commands) {
+        branches.push_back(toBranch(Tokens::split(command)));
+    }
+
+    std::vector<std::string> changes;
+    std::vector<std::string> result;
+    std::size_t first = 0;
+
+    while (first < branches.size()) {
+        /* Verdict of the first branch matching each value. A value matched
+         * again is shadowed after a terminal verdict but may still be
+         * reached otherwise, so the group ends there */
+        std::map<std::string, std::string> verdicts;
+        std::size_t nbShadowed = 0;
+        std::size_t last       = first + 1;
+        if (branches[first]) {
+            verdicts.emplace(branches[first]->value, branches[first]->verdict);
+            for (; (last < branches.size()) && branches[last]
+                   && (branches[last]->head == branches[first]->head);
+                 ++last) {
+                const auto it = verdicts.find(branches[last]->value);
+                if (it == verdicts.end()) {
+                    verdicts.emplace(branches[last]->value, branches[last]->verdict);
+                }
+                else if (isTerminal(it->second)) {
+                    ++nbShadowed;
+                }
+                else {
+                    break;
+                }
+            }
+        }
+
+        if (last - first - nbShadowed < MIN_BRANCHES) {
+            result.push_back(rule.commands[first]);
+            ++first;
+            continue;
+        }
+
+        // Elements keep the order of the linear form
+        std::set<std::string> values;
+        std::string elements;
+        for (std::size_t index = first; index < last; ++index) {
+            if (!values.insert(branches[index]->value).second) {
+                continue;
+            }
+
+            elements += std::string(elements.empty() ? "" : ", ")
+                        + branches[index]->value + " : " + branches[index]->verdict;
+        }
+
+        result.push_back(branches[first]->head + " vmap { " + elements + " }");
+
+        std::string change = std::to_string(last - first)
+                             + " commands compiled into one vmap lookup on "
+                             + branches[first]->selector;
+        if (nbShadowed != 0) {
+            change += " (" + std::to_string(nbShadowed)
+                      + " unreachable branch(es) dropped)";
+        }
+        changes.push_back(change);
+
+        first = last;
+    }
+
+    rule.commands = std::move(result);
+
+    return changes;
+}
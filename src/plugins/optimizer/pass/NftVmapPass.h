@@ -0,0 +1,88 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_NFT_VMAP_PASS_H__
+#define __PLUGINS_OPTIMIZER_PASS_NFT_VMAP_PASS_H__
+
+#include "IPass.h"
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class NftVmapPass NftVmapPass.h "plugins/optimizer/pass/NftVmapPass.h"
+ * @ingroup Implementation
+ *
+ * @brief Compile nftables rules dispatching on a single key into one
+ *        verdict map lookup
+ *
+ * A chain like:
+ *     nft add rule inet filter input tcp dport 22 accept
+ *     nft add rule inet filter input tcp dport 80 jump web
+ *     nft add rule inet filter input tcp dport 443 jump web
+ *     ...
+ * is evaluated linearly by the kernel. When at least @ref MIN_BRANCHES
+ * consecutive commands of a rule only differ by the value they match and
+ * by their verdict, they are replaced by:
+ *     nft add rule inet filter input tcp dport vmap { 22 : accept, ... }
+ * which costs a single hashed lookup per packet.
+ *
+ * Both forms are equivalent: a packet matching none of the values goes on
+ * to the next rule in both cases. A value matched again after an accept
+ * or a drop can never be reached so its branch is dropped. After any other
+ * verdict (E.g: a jump to a chain that returns), the linear form may
+ * still evaluate the later branch while the map would go on after the
+ * lookup, so the group ends before it. Only single values are compiled
+ * (no prefix, range, set or negation) to avoid overlapping intervals in
+ * the map, and only verdicts a map can hold (accept, drop, return,
+ * continue, jump, goto).
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NftVmapPass : public IPass {
+
+public:
+    /** Minimum number of commands worth a map */
+    static constexpr std::size_t MIN_BRANCHES = 4;
+
+    /** Short name of the pass */
+    [[nodiscard]] const char* name() const override;
+
+    /**
+     * @brief Compile groups of dispatching commands into verdict maps
+     *
+     * @param rule The rule to rewrite
+     *
+     * @return One line per map created
+     */
+    std::vector<std::string> run(config::ConfigData::Rule& rule) const override;
+};
+
+}
+
+#endif
@@ -0,0 +1,154 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <stdexcept>
+
+#include "PrefixTrie.h"
+
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+constexpr std::size_t NONE = 0; /* The root is never a child */
+
+struct Node {
+    std::array<std::size_t, 2> children {NONE, NONE};
+    bool isFull = false;
+};
+
+unsigned int bitAt(const PrefixTrie::Prefix& prefix, unsigned int position)
+{
+    return (prefix.bytes[position / 8] >> (7 - position % 8)) & 1u;
+}
+
+}
+
+struct PrefixTrie::Internal {
+    const unsigned int nbBits;
+
+    /* nodes[0] is the root i.e. the prefix of length 0 */
+    std::vector<Node> nodes;
+
+    explicit Internal(unsigned int providedNbBits)
+        : nbBits(providedNbBits),
+          nodes(1)
+    {}
+
+    bool isFull(std::size_t index) const
+    {
+        return (index != NONE) && nodes[index].isFull;
+    }
+
+    void collect(std::size_t index,
+                 Prefix& prefix,
+                 std::vector<Prefix>& prefixes) const
+    {
+        if (nodes[index].isFull) {
+            prefixes.push_back(prefix);
+            return;
+        }
+
+        for (unsigned int side = 0; side < 2; ++side) {
+            const std::size_t child = nodes[index].children[side];
+            if (child == NONE) {
+                continue;
+            }
+
+            const unsigned int position = prefix.length;
+            const auto mask = static_cast<unsigned char>(0x80u >> (position % 8));
+            if (side == 1) {
+                prefix.bytes[position / 8] |= mask;
+            }
+
+            ++prefix.length;
+            collect(child, prefix, prefixes);
+            --prefix.length;
+
+            prefix.bytes[position / 8] &= static_cast<unsigned char>(~mask);
+        }
+    }
+};
+
+PrefixTrie::PrefixTrie(unsigned int nbBits)
+    : m_internal(std::make_unique<Internal>(nbBits))
+{}
+
+PrefixTrie::~PrefixTrie() = default;
+
+bool PrefixTrie::insert(const Prefix& prefix)
+{
+    std::vector<Node>& nodes = m_internal->nodes;
+    if (prefix.length > m_internal->nbBits) {
+        throw std::invalid_argument("PrefixTrie: Prefix longer than addresses");
+    }
+
+    std::vector<std::size_t> path {0};
+    for (unsigned int position = 0; position < prefix.length; ++position) {
+        if (nodes[path.back()].isFull) {
+            return true;
+        }
+
+        const unsigned int side = bitAt(prefix, position);
+        if (nodes[path.back()].children[side] == NONE) {
+            nodes.emplace_back();
+            nodes[path.back()].children[side] = nodes.size() - 1;
+        }
+        path.push_back(nodes[path.back()].children[side]);
+    }
+
+    Node& node          = nodes[path.back()];
+    const bool overlaps = node.isFull || (node.children[0] != NONE)
+                          || (node.children[1] != NONE);
+    node.isFull   = true;
+    node.children = {NONE, NONE};
+
+    // Two full halves make a full parent
+    path.pop_back();
+    while (!path.empty()) {
+        Node& parent = nodes[path.back()];
+        if (!m_internal->isFull(parent.children[0])
+            || !m_internal->isFull(parent.children[1])) {
+            break;
+        }
+
+        parent.isFull   = true;
+        parent.children = {NONE, NONE};
+        path.pop_back();
+    }
+
+    return overlaps;
+}
+
+std::vector<PrefixTrie::Prefix> PrefixTrie::prefixes() const
+{
+    std::vector<Prefix> prefixes;
+    Prefix prefix;
+    m_internal->collect(0, prefix, prefixes);
+
+    return prefixes;
+}
@@ -0,0 +1,122 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_PREFIX_TRIE_H__
+#define __PLUGINS_OPTIMIZER_PASS_PREFIX_TRIE_H__
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class PrefixTrie PrefixTrie.h "plugins/optimizer/pass/PrefixTrie.h"
+ * @ingroup Helper
+ *
+ * @brief Binary trie keeping the smallest set of prefixes covering the
+ *        same addresses as the ones inserted
+ *
+ * Each node is a prefix and its children are its two halves. A node is
+ * full when all its addresses have been inserted. Inserting a prefix that
+ * is already covered by a full node changes nothing, inserting a larger one
+ * drops the prefixes it covers, and two full halves are merged into their
+ * parent (e.g. 10.0.0.0/24 and 10.0.1.0/24 into 10.0.0.0/23), up to the
+ * root if needed.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class PrefixTrie {
+
+public:
+    /**
+     * @struct Prefix
+     *
+     * @brief An address in network byte order and the number of leading
+     *        bits that matter
+     */
+    struct Prefix {
+        /** Address bytes, enough for an IPv6 address */
+        std::array<unsigned char, 16> bytes {};
+
+        /** Number of leading bits of the prefix */
+        unsigned int length = 0;
+    };
+
+    /**
+     * Class constructor
+     *
+     * @param nbBits Number of bits of the addresses (32 for IPv4, 128 for
+     *               IPv6)
+     */
+    explicit PrefixTrie(unsigned int nbBits);
+
+    /** Class destructor */
+    ~PrefixTrie();
+
+    /** Class copy constructor */
+    PrefixTrie(const PrefixTrie&) = delete;
+
+    /** Class copy-assignment operator */
+    PrefixTrie& operator=(const PrefixTrie&) = delete;
+
+    /** Class move constructor */
+    PrefixTrie(PrefixTrie&&) = delete;
+
+    /** Class move-assignment operator */
+    PrefixTrie& operator=(PrefixTrie&&) = delete;
+
+    /**
+     * @brief Add a prefix
+     *
+     * @param prefix The prefix to add. Its length must not be greater than
+     *               the number of bits given to the constructor
+     *
+     * @return true if the prefix overlaps one added before (same prefix,
+     *         covered by or covering it), false otherwise
+     */
+    bool insert(const Prefix& prefix);
+
+    /** The aggregated prefixes sorted by address */
+    [[nodiscard]] std::vector<Prefix> prefixes() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <set>
+
+#include "Tokens.h"
+
+using namespace service::plugins::optimizer::pass;
+
+std::vector<std::string> Tokens::split(const std::string& command)
+{
+    std::vector<std::string> tokens;
+
+    std::size_t start = command.find_first_not_of(' ');
+    while (start != std::string::npos) {
+        const std::size_t end = command.find(' ', start);
+        tokens.push_back(command.substr(start, end - start));
+        start = command.find_first_not_of(' ', end);
+    }
+
+    return tokens;
+}
+
+std::string Tokens::join(const std::vector<std::string>& tokens)
+{
+    std::string command;
+    for (const std::string& token : tokens) {
+        if (!command.empty()) {
+            command += ' ';
+        }
+        command += token;
+    }
+
+    return command;
+}
+
+std::string Tokens::program(const std::vector<std::string>& tokens)
+{
+    if (tokens.empty()) {
+        return {};
+    }
+
+    const std::size_t slash = tokens[0].rfind('/');
+    return slash == std::string::npos ? tokens[0] : tokens[0].substr(slash + 1);
+}
+
+bool Tokens::isIptables(const std::vector<std::string>& tokens)
+{
+    const std::string name = program(tokens);
+    return (name == "iptables") || (name == "ip6tables");
+}
+
+bool Tokens::isAppend(const std::vector<std::string>& tokens)
+{
+    return std::any_of(tokens.begin(), tokens.end(), [](const std::string& token) {
+        return (token == "-A") || (token == "--append");
+    });
+}
+
+bool Tokens::isTerminal(const std::vector<std::string>& tokens)
+{
+    static const std::set<std::string> targets {
+        "ACCEPT", "DROP", "REJECT", "RETURN", "DNAT", "SNAT", "MASQUERADE",
+        "REDIRECT"};
+
+    const auto jump
+        = std::find_if(tokens.begin(), tokens.end(), [](const std::string& token) {
+              return (token == "-j") || (token == "--jump");
+          });
+
+    return (jump != tokens.end()) && (jump + 1 != tokens.end())
+           && (targets.count(*(jump + 1)) != 0);
+}
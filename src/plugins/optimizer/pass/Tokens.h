@@ -0,0 +1,71 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_OPTIMIZER_PASS_TOKENS_H__
+#define __PLUGINS_OPTIMIZER_PASS_TOKENS_H__
+
+#include <string>
+#include <vector>
+
+namespace service::plugins::optimizer::pass {
+
+/**
+ * @class Tokens Tokens.h "plugins/optimizer/pass/Tokens.h"
+ * @ingroup Implementation
+ *
+ * @brief Helper class to look into commands the way @ref Parser splits them
+ *        i.e on spaces without any quoting
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Tokens {
+
+public:
+    /** Split a command into its program and arguments */
+    [[nodiscard]] static std::vector<std::string> split(const std::string& command);
+
+    /** Build a command back from its program and arguments */
+    [[nodiscard]] static std::string join(const std::vector<std::string>& tokens);
+
+    /** Name of the program without its directory */
+    [[nodiscard]] static std::string program(const std::vector<std::string>& tokens);
+
+    /** Whether the command is run by iptables or ip6tables */
+    [[nodiscard]] static bool isIptables(const std::vector<std::string>& tokens);
+
+    /** Whether the command appends to a chain (-A/--append) */
+    [[nodiscard]] static bool isAppend(const std::vector<std::string>& tokens);
+
+    /** Whether packets matched by the command leave the chain (-j DROP, ...) */
+    [[nodiscard]] static bool isTerminal(const std::vector<std::string>& tokens);
+};
+
+}
+
+#endif
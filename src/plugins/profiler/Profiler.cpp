@@ -0,0 +1,179 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <chrono>
+#include <sstream>
+#include <vector>
+
+#include "utils/helper/PerfCounters.h"
+
+#include "Profiler.h"
+
+using namespace service::plugins::profiler;
+using namespace utils::command::osal;
+using namespace utils::helper;
+
+struct Profiler::Internal {
+    struct Phase {
+        std::string name;
+        std::size_t nbRuns;
+        std::chrono::nanoseconds wallTime;
+        PerfCounters::Sample counters;
+        std::size_t allocations;
+        CountingOsal::Counters syscalls;
+    };
+
+    std::unique_ptr<PerfCounters> perfCounters;
+    const CountingOsal* const osal;
+    const CountAllocations countAllocations;
+    std::vector<Phase> phases;
+
+    /* Phase being measured or nullptr */
+    Phase* currentPhase = nullptr;
+    std::chrono::steady_clock::time_point startTime;
+    std::size_t startAllocations = 0;
+    CountingOsal::Counters startSyscalls {};
+
+    explicit Internal(bool enabled,
+                      const CountingOsal* providedOsal,
+                      CountAllocations providedCountAllocations)
+        : perfCounters(enabled ? std::make_unique<PerfCounters>() : nullptr),
+          osal(providedOsal),
+          countAllocations(providedCountAllocations)
+    {}
+
+    [[nodiscard]] CountingOsal::Counters syscalls() const
+    {
+        return (osal != nullptr) ? osal->counters() : CountingOsal::Counters {};
+    }
+
+    [[nodiscard]] std::size_t allocations() const
+    {
+        return (countAllocations != nullptr) ? countAllocations() : 0;
+    }
+
+    Phase& findOrAddPhase(const std::string& phaseName)
+    {
+        for (Phase& phase : phases) {
+            if (phase.name == phaseName) {
+                return phase;
+            }
+        }
+
+        return phases.emplace_back(
+            Phase {phaseName, 0, std::chrono::nanoseconds::zero(), {}, 0, {}});
+    }
+};
+
+Profiler::Profiler(bool enabled,
+                   const CountingOsal* osal,
+                   CountAllocations countAllocations)
+    : m_internal(std::make_unique<Internal>(enabled, osal, countAllocations))
+{}
+
+Profiler::~Profiler() = default;
+
+void Profiler::startPhase(const std::string& phaseName) const
+{
+    if (!m_internal->perfCounters) {
+        return;
+    }
+
+    m_internal->currentPhase = &m_internal->findOrAddPhase(phaseName);
+
+    // Last so that the profiler's own work is not measured
+    m_internal->startSyscalls    = m_internal->syscalls();
+    m_internal->startAllocations = m_internal->allocations();
+    m_internal->startTime        = std::chrono::steady_clock::now();
+    m_internal->perfCounters->start();
+}
+
+void Profiler::stopPhase(const std::string& phaseName) const
+{
+    if ((m_internal->currentPhase == nullptr)
+        || (m_internal->currentPhase->name != phaseName)) {
+        return;
+    }
+
+    const PerfCounters::Sample counters = m_internal->perfCounters->stop();
+    const auto wallTime = std::chrono::steady_clock::now() - m_internal->startTime;
+    const std::size_t allocations
+        = m_internal->allocations() - m_internal->startAllocations;
+    const CountingOsal::Counters syscalls
+        = m_internal->syscalls() - m_internal->startSyscalls;
+
+    Internal::Phase& phase = *m_internal->currentPhase;
+    ++phase.nbRuns;
+    phase.wallTime += wallTime;
+    phase.counters += counters;
+    phase.allocations += allocations;
+    phase.syscalls += syscalls;
+
+    m_internal->currentPhase = nullptr;
+}
+
+std::string Profiler::toString() const
+{
+    std::ostringstream stream;
+    if (m_internal->phases.empty()) {
+        return stream.str();
+    }
+
+    stream << "Cost per phase";
+    if (!m_internal->perfCounters->isAvailable()) {
+        stream << " (perf events not allowed on this host: wall time only)";
+    }
+    stream << ":\n";
+
+    for (const Internal::Phase& phase : m_internal->phases) {
+        stream << "  " << phase.name << ": " << phase.nbRuns << " run(s)"
+               << ", wall "
+               << std::chrono::duration_cast<std::chrono::microseconds>(
+                      phase.wallTime)
+                      .count()
+               << " us";
+
+        if (m_internal->countAllocations != nullptr) {
+            stream << ", " << phase.allocations << " allocation(s)";
+        }
+
+        if (m_internal->osal != nullptr) {
+            const CountingOsal::Counters& syscalls = phase.syscalls;
+            stream << ", " << syscalls.forks << " fork(s), " << syscalls.execs
+                   << " exec(s), " << syscalls.waits << " wait(s), "
+                   << syscalls.closes << " close(s)";
+        }
+
+        if (phase.counters.isAvailable()) {
+            stream << ", " << phase.counters.toString();
+        }
+        stream << "\n";
+    }
+
+    return stream.str();
+}
@@ -0,0 +1,138 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_PROFILER_PROFILER_H__
+#define __PLUGINS_PROFILER_PROFILER_H__
+
+#include <memory>
+
+#include "utils/command/executor/osal/CountingOsal.h"
+
+#include "service/plugins/IProfiler.h"
+
+namespace service::plugins::profiler {
+
+/**
+ * @class Profiler Profiler.h "plugins/profiler/Profiler.h"
+ * @ingroup Implementation
+ *
+ * @brief Measure what each phase of the service costs
+ *
+ * This class is the "low level class" that implements @ref IProfiler.h
+ *
+ * Besides wall time, hardware and software events (cycles, instructions,
+ * context switches, page faults and CPU migrations) are counted with
+ * perf_event_open() including those of the programs spawned during the
+ * phase. When perf events are not allowed on the host, only wall time
+ * is measured.
+ *
+ * When a way to count them is given, heap allocations (see @ref
+ * AllocationCounter.h) are also counted per phase and, when a @ref
+ * CountingOsal.h is given, forks, execs, waits and closes too.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Profiler : public IProfiler {
+
+public:
+    /** Return the number of heap allocations made so far */
+    using CountAllocations = std::size_t (*)();
+
+    /**
+     * Class constructor
+     *
+     * @param enabled          Whether phases are measured. A disabled
+     *                         profiler does nothing and does not open any
+     *                         perf event
+     * @param osal             Where to read the system calls made by the
+     *                         executor or nullptr
+     * @param countAllocations E.g. AllocationCounter::count, or nullptr
+     *                         when operator new is not replaced (library)
+     */
+    explicit Profiler(bool enabled                                 = true,
+                      const utils::command::osal::CountingOsal* osal = nullptr,
+                      CountAllocations countAllocations              = nullptr);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~Profiler() override;
+
+    /** Class copy constructor */
+    Profiler(const Profiler&) = delete;
+
+    /** Class copy-assignment operator */
+    Profiler& operator=(const Profiler&) = delete;
+
+    /** Class move constructor */
+    Profiler(Profiler&&) = delete;
+
+    /** Class move-assignment operator */
+    Profiler& operator=(Profiler&&) = delete;
+
+    /**
+     * @brief Start measuring a phase
+     *
+     * @param phaseName A name identifying the phase
+     */
+    void startPhase(const std::string& phaseName) const override;
+
+    /**
+     * @brief Stop measuring a phase. Nothing is done if phaseName is not
+     *        the phase currently measured
+     *
+     * @param phaseName The name given to startPhase()
+     */
+    void stopPhase(const std::string& phaseName) const override;
+
+    /**
+     * @brief Generate a human-readable report of the measured phases in
+     *        the order they were first started
+     *
+     * @return The report or an empty string if nothing has been measured
+     */
+    [[nodiscard]] std::string toString() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
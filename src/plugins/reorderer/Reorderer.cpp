@@ -0,0 +1,564 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "utils/command/parser/Parser.h"
+#include "utils/file/temporary/TemporaryFile.h"
+
+#include "Reorderer.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::reorderer;
+using namespace utils::command;
+using namespace utils::file;
+
+namespace {
+
+/* The value of a match and whether it is negated ("! -s ...") */
+struct Match {
+    bool isNegated = false;
+    std::string value;
+};
+
+/* A rule line of iptables-save output: "[packets:bytes] -A <chain> ..." */
+struct Rule {
+    std::string line;
+    std::string chain;
+    unsigned long long packets = 0;
+
+    /* Matches that tell whether two rules can match the same packet */
+    std::map<std::string, Match> matches;
+
+    /* "-j <target> <target options>" */
+    std::string action;
+
+    /* Whether the rule must stay where it is */
+    bool isPinned = false;
+};
+
+/* A "*<table>" section of iptables-save output */
+struct Table {
+    std::string name;
+    std::vector<std::string> chains; /* ":<chain> <policy> [packets:bytes]" */
+    std::vector<Rule> rules;
+};
+
+/* An IPv4 or IPv6 network */
+struct Network {
+    std::array<unsigned char, 16> bytes {};
+    std::size_t size    = 0;
+    unsigned int length = 0;
+};
+
+bool isDigits(const std::string& value)
+{
+    return !value.empty()
+           && (value.find_first_not_of("0123456789") == std::string::npos);
+}
+
+/* Modules whose result for a packet depends on the previous evaluations */
+bool isStatefulModule(const std::string& module)
+{
+    static const std::set<std::string> modules {
+        "limit", "hashlimit", "recent", "statistic", "quota", "connlimit"};
+    return modules.count(module) != 0;
+}
+
+bool isPortModule(const std::string& module)
+{
+    return (module == "tcp") || (module == "udp") || (module == "udplite")
+           || (module == "sctp") || (module == "dccp");
+}
+
+bool isTerminal(const std::string& action)
+{
+    static const std::set<std::string> targets {
+        "ACCEPT", "DROP", "REJECT", "RETURN", "DNAT", "SNAT", "MASQUERADE",
+        "REDIRECT"};
+
+    std::istringstream stream(action);
+    std::string option;
+    std::string target;
+    stream >> option >> target;
+    return (option == "-j") && (targets.count(target) != 0);
+}
+
+Rule parseRule(const std::string& line)
+{
+    using TokenIterator = std::istream_iterator<std::string>;
+    std::istringstream stream(line);
+    const std::vector<std::string> tokens {TokenIterator(stream), TokenIterator()};
+
+    Rule rule;
+    rule.line = line;
+    // Quoted values (comments, log prefixes, ...) may contain spaces
+    rule.isPinned = line.find('"') != std::string::npos;
+
+    std::size_t index = 0;
+    if (!tokens.empty() && (tokens[0].size() > 2) && (tokens[0].front() == '[')) {
+        const std::string packets = tokens[0].substr(1, tokens[0].find(':') - 1);
+        if (!isDigits(packets)) {
+            throw std::runtime_error("Reorderer: Invalid counters: " + line);
+        }
+        rule.packets = std::stoull(packets);
+        ++index;
+    }
+
+    if ((index + 1 >= tokens.size()) || (tokens[index] != "-A")) {
+        throw std::runtime_error("Reorderer: Unexpected line: " + line);
+    }
+    rule.chain = tokens[index + 1];
+
+    std::string module;
+    bool isNegated = false;
+    for (index += 2; index < tokens.size(); ++index) {
+        const std::string& token = tokens[index];
+        if (token == "!") {
+            isNegated = true;
+            continue;
+        }
+
+        if ((token == "-j") || (token == "-g")) {
+            std::string action;
+            for (; index < tokens.size(); ++index) {
+                action += (action.empty() ? "" : " ") + tokens[index];
+            }
+            rule.action = action;
+            break;
+        }
+
+        const bool hasValue = index + 1 < tokens.size();
+        if ((token == "-m") && hasValue) {
+            module        = tokens[++index];
+            rule.isPinned = rule.isPinned || isStatefulModule(module);
+        }
+        else if (((token == "-p") || (token == "-s") || (token == "-d")
+                  || (token == "-i") || (token == "-o")
+                  || (((token == "--dport") || (token == "--sport"))
+                      && isPortModule(module)))
+                 && hasValue) {
+            rule.matches[token] = {isNegated, tokens[++index]};
+        }
+
+        isNegated = false;
+    }
+
+    return rule;
+}
+
+std::vector<Table> parseTables(const std::string& pathname)
+{
+    std::ifstream stream(pathname);
+    if (!stream.good()) {
+        throw std::runtime_error("Reorderer: Could not read " + pathname);
+    }
+
+    std::vector<Table> tables;
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || (line[0] == '#') || (line == "COMMIT")) {
+            continue;
+        }
+
+        if (line[0] == '*') {
+            tables.push_back({line.substr(1), {}, {}});
+        }
+        else if (tables.empty()) {
+            throw std::runtime_error("Reorderer: Unexpected line: " + line);
+        }
+        else if (line[0] == ':') {
+            tables.back().chains.push_back(line);
+        }
+        else {
+            tables.back().rules.push_back(parseRule(line));
+        }
+    }
+
+    return tables;
+}
+
+std::optional<Network> toNetwork(const std::string& value)
+{
+    const std::size_t slash   = value.find('/');
+    const std::string address = value.substr(0, slash);
+
+    Network network;
+    if (inet_pton(AF_INET, address.c_str(), network.bytes.data()) == 1) {
+        network.size = 4;
+    }
+    else if (inet_pton(AF_INET6, address.c_str(), network.bytes.data()) == 1) {
+        network.size = 16;
+    }
+    else {
+        return std::nullopt;
+    }
+
+    network.length = static_cast<unsigned int>(network.size * 8);
+    if (slash != std::string::npos) {
+        // Non-CIDR masks (E.g: /255.0.255.0) are not handled
+        const std::string length = value.substr(slash + 1);
+        if (!isDigits(length) || (length.size() > 3)
+            || (std::stoul(length) > network.length)) {
+            return std::nullopt;
+        }
+        network.length = static_cast<unsigned int>(std::stoul(length));
+    }
+
+    return network;
+}
+
+bool areDisjointNetworks(const std::string& first, const std::string& second)
+{
+    const std::optional<Network> firstNetwork  = toNetwork(first);
+    const std::optional<Network> secondNetwork = toNetwork(second);
+    if (!firstNetwork || !secondNetwork
+        || (firstNetwork->size != secondNetwork->size)) {
+        return false;
+    }
+
+    const unsigned int length
+        = std::min(firstNetwork->length, secondNetwork->length);
+    for (unsigned int bit = 0; bit < length; ++bit) {
+        const unsigned int mask = 0x80u >> (bit % 8);
+        if ((firstNetwork->bytes[bit / 8] & mask)
+            != (secondNetwork->bytes[bit / 8] & mask)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* "eth+" matches every interface whose name starts with "eth" */
+bool areDisjointInterfaces(const std::string& first, const std::string& second)
+{
+    const bool isFirstWildcard  = !first.empty() && (first.back() == '+');
+    const bool isSecondWildcard = !second.empty() && (second.back() == '+');
+    const std::string firstPrefix
+        = isFirstWildcard ? first.substr(0, first.size() - 1) : first;
+    const std::string secondPrefix
+        = isSecondWildcard ? second.substr(0, second.size() - 1) : second;
+
+    if (isFirstWildcard
+        && (second.compare(0, firstPrefix.size(), firstPrefix) == 0)) {
+        return false;
+    }
+
+    if (isSecondWildcard
+        && (first.compare(0, secondPrefix.size(), secondPrefix) == 0)) {
+        return false;
+    }
+
+    return isFirstWildcard || isSecondWildcard || (first != second);
+}
+
+using Ports = std::pair<unsigned long, unsigned long>;
+
+/* A port or a "first:last" range of ports */
+std::optional<Ports> toPorts(const std::string& value)
+{
+    const std::size_t colon = value.find(':');
+    const std::string first = value.substr(0, colon);
+    const std::string last
+        = colon == std::string::npos ? first : value.substr(colon + 1);
+    if (!isDigits(first) || !isDigits(last) || (first.size() > 5)
+        || (last.size() > 5)) {
+        return std::nullopt;
+    }
+
+    return std::make_pair(std::stoul(first), std::stoul(last));
+}
+
+bool areDisjointPorts(const std::string& first, const std::string& second)
+{
+    const auto firstPorts  = toPorts(first);
+    const auto secondPorts = toPorts(second);
+    return firstPorts && secondPorts
+           && ((firstPorts->second < secondPorts->first)
+               || (secondPorts->second < firstPorts->first));
+}
+
+/* Whether no packet can match both values of a match */
+bool areDisjoint(const std::string& option,
+                 const std::string& first,
+                 const std::string& second)
+{
+    static const std::set<std::string> protocols {
+        "tcp", "udp", "udplite", "icmp", "icmpv6", "ipv6-icmp", "esp", "ah",
+        "sctp", "gre", "dccp"};
+
+    if (option == "-p") {
+        // Protocols may also be given by number: only compare known names
+        return (protocols.count(first) != 0) && (protocols.count(second) != 0)
+               && (first != second);
+    }
+
+    if ((option == "-s") || (option == "-d")) {
+        return areDisjointNetworks(first, second);
+    }
+
+    if ((option == "-i") || (option == "-o")) {
+        return areDisjointInterfaces(first, second);
+    }
+
+    return areDisjointPorts(first, second);
+}
+
+/* Whether the verdict of a packet doesn't depend on the order of both rules */
+bool commute(const Rule& first, const Rule& second)
+{
+    if (first.isPinned || second.isPinned) {
+        return false;
+    }
+
+    if ((first.action == second.action) && isTerminal(first.action)) {
+        return true;
+    }
+
+    for (const auto& [option, match] : first.matches) {
+        const auto other = second.matches.find(option);
+        if (other == second.matches.end()) {
+            continue;
+        }
+
+        if (match.isNegated != other->second.isNegated) {
+            if (match.value == other->second.value) {
+                return true;
+            }
+        }
+        else if (!match.isNegated
+                 && areDisjoint(option, match.value, other->second.value)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* Number of rules matched packets went through until their match */
+unsigned long long evaluations(const std::vector<Rule>& rules,
+                               std::size_t first,
+                               std::size_t last)
+{
+    unsigned long long count = 0;
+    for (std::size_t index = first; index < last; ++index) {
+        count += rules[index].packets * (index - first + 1);
+    }
+
+    return count;
+}
+
+}
+
+struct Reorderer::Internal {
+    const IExecutor& executor;
+    const IWriter& writer;
+    const bool enabled;
+
+    /* Pathname of the programs ("iptables", "ip6tables") of the configuration
+     * to apply, by program. Their tools are next to them (E.g:
+     * "/usr/sbin/iptables-save" for "/usr/sbin/iptables") */
+    std::map<std::string, std::string> families;
+
+    /* One line per chain whose rules have been moved */
+    std::vector<std::string> changes;
+
+    explicit Internal(const IExecutor& providedExecutor,
+                      const IWriter& providedWriter,
+                      bool providedEnabled)
+        : executor(providedExecutor),
+          writer(providedWriter),
+          enabled(providedEnabled)
+    {}
+
+    void execute(const std::string& command) const
+    {
+        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& parsedCommand
+            = Parser::parse(command);
+
+        const IExecutor::ProgramParams params
+            = {parsedCommand->pathname, parsedCommand->argv, nullptr, "reorderer"};
+        executor.executeProgram(params);
+    }
+
+    /* Let rules with more packets go up past the ones they commute with */
+    static bool sortChains(const std::string& family,
+                           Table& table,
+                           std::vector<std::string>& tableChanges)
+    {
+        std::vector<Rule>& rules = table.rules;
+        bool hasChanged          = false;
+        std::size_t first        = 0;
+
+        while (first < rules.size()) {
+            std::size_t last = first + 1;
+            while ((last < rules.size())
+                   && (rules[last].chain == rules[first].chain)) {
+                ++last;
+            }
+
+            const unsigned long long before = evaluations(rules, first, last);
+            std::vector<std::size_t> positions(last - first);
+            for (std::size_t index = 0; index < positions.size(); ++index) {
+                positions[index] = index;
+            }
+
+            bool hasSwapped = true;
+            while (hasSwapped) {
+                hasSwapped = false;
+                for (std::size_t index = first; index + 1 < last; ++index) {
+                    if ((rules[index + 1].packets > rules[index].packets)
+                        && commute(rules[index], rules[index + 1])) {
+                        std::swap(rules[index], rules[index + 1]);
+                        std::swap(positions[index - first],
+                                  positions[index - first + 1]);
+                        hasSwapped = true;
+                    }
+                }
+            }
+
+            std::size_t nbMoved = 0;
+            for (std::size_t index = 0; index < positions.size(); ++index) {
+                if (positions[index] != index) {
+                    ++nbMoved;
+                }
+            }
+
+            if (nbMoved != 0) {
+                const unsigned long long after = evaluations(rules, first, last);
+                const unsigned long long gain = (before - after) * 100 / before;
+                tableChanges.push_back(
+                    family + " " + table.name + " " + rules[first].chain + ": "
+                    + std::to_string(nbMoved) + " rules moved, "
+                    + std::to_string(before) + " -> " + std::to_string(after)
+                    + " rule evaluations (-" + std::to_string(gain) + "%)");
+                hasChanged = true;
+            }
+
+            first = last;
+        }
+
+        return hasChanged;
+    }
+
+    void reorder(const std::string& family, const std::string& pathname)
+    {
+        const TemporaryFile saved;
+        execute(pathname + "-save -c -f " + saved.pathname());
+
+        std::vector<std::string> familyChanges;
+        std::string content;
+        for (Table& table : parseTables(saved.pathname())) {
+            if (!sortChains(family, table, familyChanges)) {
+                continue;
+            }
+
+            content += "*" + table.name + "\n";
+            for (const std::string& chain : table.chains) {
+                content += chain + "\n";
+            }
+            for (const Rule& rule : table.rules) {
+                content += rule.line + "\n";
+            }
+            content += "COMMIT\n";
+        }
+
+        if (content.empty()) {
+            return;
+        }
+
+        // Each table is replaced at once, counters included
+        const TemporaryFile sorted;
+        {
+            std::ofstream stream(sorted.pathname());
+            writer.writeToStream(stream, content);
+        }
+        execute(pathname + "-restore -c " + sorted.pathname());
+
+        changes.insert(changes.end(), familyChanges.begin(), familyChanges.end());
+    }
+};
+
+Reorderer::Reorderer(const IExecutor& executor, const IWriter& writer, bool enabled)
+    : m_internal(std::make_unique<Internal>(executor, writer, enabled))
+{}
+
+Reorderer::~Reorderer() = default;
+
+void Reorderer::prepare(const ConfigData& configData) const
+{
+    std::map<std::string, std::string>& families = m_internal->families;
+    families.clear();
+    m_internal->changes.clear();
+    if (!m_internal->enabled) {
+        return;
+    }
+
+    for (const ConfigData::Rule& rule : configData.rules) {
+        for (const std::string& command : rule.commands) {
+            const std::string pathname = command.substr(0, command.find(' '));
+            const std::string program  = pathname.substr(pathname.rfind('/') + 1);
+            if ((program == "iptables") || (program == "ip6tables")) {
+                families.emplace(program, pathname);
+            }
+        }
+    }
+}
+
+void Reorderer::reorder() const
+{
+    for (const auto& [family, pathname] : m_internal->families) {
+        m_internal->reorder(family, pathname);
+    }
+}
+
+std::string Reorderer::toString() const
+{
+    std::ostringstream stream;
+    if (m_internal->changes.empty()) {
+        return stream.str();
+    }
+
+    stream << "Reordering:\n";
+    for (const std::string& change : m_internal->changes) {
+        stream << "  " << change << "\n";
+    }
+
+    return stream.str();
+}
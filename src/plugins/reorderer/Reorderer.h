@@ -0,0 +1,138 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_REORDERER_REORDERER_H__
+#define __PLUGINS_REORDERER_REORDERER_H__
+
+#include <memory>
+#include <string>
+
+#include "utils/command/executor/IExecutor.h"
+#include "utils/file/writer/IWriter.h"
+
+#include "service/plugins/IReorderer.h"
+
+namespace service::plugins::reorderer {
+
+/**
+ * @class Reorderer Reorderer.h "plugins/reorderer/Reorderer.h"
+ * @ingroup Implementation
+ *
+ * @brief Sort chains by packet counters without changing what they do
+ *
+ * This class is the "low level class" that implements @ref IReorderer.h
+ *
+ * The tables of each family used by the rules (iptables, ip6tables) are
+ * saved with their counters ("iptables-save -c"). In each chain, a rule
+ * goes up past the previous one as long as it matched more packets and
+ * both rules commute i.e. no packet can be matched by both (different
+ * protocols, non-overlapping addresses or ports, different interfaces,
+ * a value and its negation) or both have the same terminal verdict. Rules
+ * with a stateful match (limit, recent, ...) never move. A sequence of
+ * swaps of adjacent commuting rules leaves the verdict of every packet
+ * unchanged.
+ *
+ * Tables with a new order are loaded back in a single "iptables-restore
+ * -c" which replaces each of them atomically and keeps the counters. The
+ * expected gain is the number of rules a packet goes through until its
+ * match, weighted by the counters, before and after.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Reorderer : public IReorderer {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param executor Command executor to use
+     * @param writer   Writer object to write the file to restore
+     * @param enabled  Whether rules are reordered. A disabled reorderer does
+     *                 nothing
+     */
+    explicit Reorderer(const utils::command::IExecutor& executor,
+                       const utils::file::IWriter& writer,
+                       bool enabled = true);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~Reorderer() override;
+
+    /** Class copy constructor */
+    Reorderer(const Reorderer&) = delete;
+
+    /** Class copy-assignment operator */
+    Reorderer& operator=(const Reorderer&) = delete;
+
+    /** Class move constructor */
+    Reorderer(Reorderer&&) = delete;
+
+    /** Class move-assignment operator */
+    Reorderer& operator=(Reorderer&&) = delete;
+
+    /**
+     * @brief Record the families used by "configData" rules and the pathname
+     *        of their program, next to which their "-save" and "-restore"
+     *        tools are expected
+     *
+     * @param configData The configuration about to be applied
+     */
+    void prepare(const config::ConfigData& configData) const override;
+
+    /** @brief Sort the chains of the families recorded by @ref prepare */
+    void reorder() const override;
+
+    /**
+     * @brief Describe each chain whose rules have been moved since the last
+     *        call to @ref prepare
+     *
+     * @return The number of rules moved and the rules packets went through
+     *         before and after, in a human readable format. An empty string
+     *         if nothing changed
+     */
+    [[nodiscard]] std::string toString() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
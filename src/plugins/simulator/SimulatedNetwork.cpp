@@ -0,0 +1,75 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "utils/command/parser/Parser.h"
+
+#include "SimulatedNetwork.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+using namespace utils::command;
+
+struct SimulatedNetwork::Internal {
+    const Kernel& kernel;
+
+    explicit Internal(const Kernel& providedKernel) : kernel(providedKernel) {}
+};
+
+SimulatedNetwork::SimulatedNetwork(const Kernel& kernel)
+    : m_internal(std::make_unique<Internal>(kernel))
+{}
+
+SimulatedNetwork::~SimulatedNetwork() = default;
+
+bool SimulatedNetwork::hasInterface(const std::string& interfaceName) const
+{
+    return m_internal->kernel.hasInterface(interfaceName);
+}
+
+void SimulatedNetwork::applyInterfaceCommands(
+    const std::vector<std::string>& interfaceCommands) const
+{
+    for (const std::string& interfaceCommand : interfaceCommands) {
+        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& command
+            = Parser::parse(interfaceCommand);
+
+        m_internal->kernel.execute(command->argc, command->argv);
+    }
+}
+
+void SimulatedNetwork::applyLayerCommands(
+    const std::vector<ConfigData::Network::LayerCommand>& layerCommands) const
+{
+    for (const auto& layerCommand : layerCommands) {
+        m_internal->kernel.writeSysctl(layerCommand.pathname, layerCommand.value);
+    }
+}
+
+void SimulatedNetwork::joinNamespace(const std::string& /* namespacePath */) const
+{}
@@ -0,0 +1,125 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_SIMULATED_NETWORK_H__
+#define __PLUGINS_SIMULATOR_SIMULATED_NETWORK_H__
+
+#include <memory>
+
+#include "service/plugins/INetwork.h"
+
+#include "kernel/Kernel.h"
+
+namespace service::plugins::simulator {
+
+/**
+ * @class SimulatedNetwork SimulatedNetwork.h "plugins/simulator/SimulatedNetwork.h"
+ * @ingroup Implementation
+ *
+ * @brief An implementation of @ref INetwork.h that configures a simulated
+ *        kernel instead of the host
+ *
+ * Interface commands are parsed as usual then interpreted by the @ref Kernel.h
+ * and layer commands set sysctls of the model instead of writing to /proc/sys.
+ * Neither root privileges nor a dedicated host are therefore needed.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class SimulatedNetwork : public network::INetwork {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param kernel Simulated kernel to configure
+     */
+    explicit SimulatedNetwork(const kernel::Kernel& kernel);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~SimulatedNetwork() override;
+
+    /** Class copy constructor */
+    SimulatedNetwork(const SimulatedNetwork&) = delete;
+
+    /** Class copy-assignment operator */
+    SimulatedNetwork& operator=(const SimulatedNetwork&) = delete;
+
+    /** Class move constructor */
+    SimulatedNetwork(SimulatedNetwork&&) = delete;
+
+    /** Class move-assignment operator */
+    SimulatedNetwork& operator=(SimulatedNetwork&&) = delete;
+
+    /** Check if the simulated interface whose name is "interfaceName" exists */
+    [[nodiscard]] bool hasInterface(const std::string& interfaceName) const override;
+
+    /**
+     * @brief Apply "interface commands" to the simulated kernel
+     *
+     * @param interfaceCommands The list of interface commands to apply
+     */
+    void applyInterfaceCommands(
+        const std::vector<std::string>& interfaceCommands) const override;
+
+    /**
+     * @brief Set the sysctls targeted by "layer commands"
+     *
+     * @param layerCommands The list of layer commands to apply
+     */
+    void applyLayerCommands(
+        const std::vector<
+            service::plugins::config::ConfigData::Network::LayerCommand>&
+            layerCommands) const override;
+
+    /**
+     * @brief Do nothing: namespaces are not simulated
+     *
+     * @param namespacePath Path to the network namespace file
+     */
+    void joinNamespace(const std::string& namespacePath) const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
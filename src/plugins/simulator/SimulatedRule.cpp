@@ -0,0 +1,101 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <string_view>
+
+#include "utils/command/parser/Parser.h"
+#include "utils/file/mapped/MappedFile.h"
+
+#include "SimulatedRule.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+using namespace utils::command;
+using namespace utils::file;
+
+namespace {
+
+/* Number of lines that are neither empty nor comments */
+std::size_t countEntries(std::string_view content)
+{
+    std::size_t nbEntries = 0;
+
+    while (!content.empty()) {
+        const std::size_t end = content.find('\n');
+        std::string_view line = content.substr(0, end);
+        content.remove_prefix(end == std::string_view::npos ? content.size()
+                                                            : end + 1);
+
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if ((first != std::string_view::npos) && (line[first] != '#')) {
+            ++nbEntries;
+        }
+    }
+
+    return nbEntries;
+}
+
+}
+
+struct SimulatedRule::Internal {
+    /* Copied: the configuration releases them once rules are created */
+    const std::vector<std::string> commands;
+    const std::vector<ConfigData::Rule::AddressSet>& sets;
+
+    const Kernel& kernel;
+
+    explicit Internal(const std::vector<std::string>& providedCommands,
+                      const std::vector<ConfigData::Rule::AddressSet>& providedSets,
+                      const Kernel& providedKernel)
+        : commands(providedCommands), sets(providedSets), kernel(providedKernel)
+    {}
+};
+
+SimulatedRule::SimulatedRule(const std::vector<std::string>& commands,
+                             const std::vector<ConfigData::Rule::AddressSet>& sets,
+                             const Kernel& kernel)
+    : m_internal(std::make_unique<Internal>(commands, sets, kernel))
+{}
+
+SimulatedRule::~SimulatedRule() = default;
+
+void SimulatedRule::applyCommands() const
+{
+    for (const ConfigData::Rule::AddressSet& set : m_internal->sets) {
+        const MappedFile file(set.file);
+        m_internal->kernel.loadSet(set.name, countEntries(file.content()));
+    }
+
+    for (const std::string& command : m_internal->commands) {
+        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& parsedCommand
+            = Parser::parse(command);
+
+        m_internal->kernel.execute(parsedCommand->argc, parsedCommand->argv);
+    }
+}
@@ -0,0 +1,107 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_SIMULATED_RULE_H__
+#define __PLUGINS_SIMULATOR_SIMULATED_RULE_H__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "service/plugins/IConfigData.h"
+#include "service/plugins/IRule.h"
+
+#include "kernel/Kernel.h"
+
+namespace service::plugins::simulator {
+
+/**
+ * @class SimulatedRule SimulatedRule.h "plugins/simulator/SimulatedRule.h"
+ * @ingroup Implementation
+ *
+ * @brief An implementation of @ref IRule.h whose commands are interpreted by
+ *        a simulated kernel
+ *
+ * Address sets are loaded with one element per non-empty, non-comment line
+ * of their file, without validating the addresses.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class SimulatedRule : public firewall::IRule {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param commands Commands to interpret, copied
+     * @param sets     Address sets to load before interpreting the commands
+     * @param kernel   Simulated kernel to configure
+     */
+    explicit SimulatedRule(
+        const std::vector<std::string>& commands,
+        const std::vector<config::ConfigData::Rule::AddressSet>& sets,
+        const kernel::Kernel& kernel);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~SimulatedRule() override;
+
+    /** Class copy constructor */
+    SimulatedRule(const SimulatedRule&) = delete;
+
+    /** Class copy-assignment operator */
+    SimulatedRule& operator=(const SimulatedRule&) = delete;
+
+    /** Class move constructor */
+    SimulatedRule(SimulatedRule&&) = delete;
+
+    /** Class move-assignment operator */
+    SimulatedRule& operator=(SimulatedRule&&) = delete;
+
+    /** Load the address sets then interpret the commands of the rule */
+    void applyCommands() const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,55 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "SimulatedRule.h"
+#include "SimulatedRuleFactory.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+
+struct SimulatedRuleFactory::Internal {
+    const Kernel& kernel;
+
+    explicit Internal(const Kernel& providedKernel) : kernel(providedKernel) {}
+};
+
+SimulatedRuleFactory::SimulatedRuleFactory(const Kernel& kernel)
+    : m_internal(std::make_unique<Internal>(kernel))
+{}
+
+SimulatedRuleFactory::~SimulatedRuleFactory() = default;
+
+std::unique_ptr<IRule> SimulatedRuleFactory::createRule(
+    const std::string& /* name */,
+    const std::vector<std::string>& commands,
+    const std::vector<ConfigData::Rule::AddressSet>& sets) const
+{
+    return std::make_unique<SimulatedRule>(commands, sets, m_internal->kernel);
+}
@@ -0,0 +1,109 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_SIMULATED_RULE_FACTORY_H__
+#define __PLUGINS_SIMULATOR_SIMULATED_RULE_FACTORY_H__
+
+#include <memory>
+
+#include "service/plugins/IRuleFactory.h"
+
+#include "kernel/Kernel.h"
+
+namespace service::plugins::simulator {
+
+/**
+ * @class SimulatedRuleFactory SimulatedRuleFactory.h
+ *        "plugins/simulator/SimulatedRuleFactory.h"
+ * @ingroup Implementation
+ *
+ * @brief An implementation of @ref IRuleFactory.h creating rules that
+ *        configure a simulated kernel (see @ref SimulatedRule.h)
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class SimulatedRuleFactory : public firewall::IRuleFactory {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param kernel Simulated kernel configured by the created rules
+     */
+    explicit SimulatedRuleFactory(const kernel::Kernel& kernel);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~SimulatedRuleFactory() override;
+
+    /** Class copy constructor */
+    SimulatedRuleFactory(const SimulatedRuleFactory&) = delete;
+
+    /** Class copy-assignment operator */
+    SimulatedRuleFactory& operator=(const SimulatedRuleFactory&) = delete;
+
+    /** Class move constructor */
+    SimulatedRuleFactory(SimulatedRuleFactory&&) = delete;
+
+    /** Class move-assignment operator */
+    SimulatedRuleFactory& operator=(SimulatedRuleFactory&&) = delete;
+
+    /**
+     * @brief Create a simulated rule
+     *
+     * @param name     The name of the rule (unused)
+     * @param commands Commands of the rule
+     * @param sets     Address sets used by the commands
+     *
+     * @return A unique_ptr to the created rule
+     */
+    [[nodiscard]] std::unique_ptr<firewall::IRule>
+        createRule(const std::string& name,
+                   const std::vector<std::string>& commands,
+                   const std::vector<config::ConfigData::Rule::AddressSet>& sets)
+            const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
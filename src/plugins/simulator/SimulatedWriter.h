@@ -0,0 +1,108 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_SIMULATED_WRITER_H__
+#define __PLUGINS_SIMULATOR_SIMULATED_WRITER_H__
+
+#include <memory>
+
+#include "utils/file/writer/IWriter.h"
+
+#include "kernel/Kernel.h"
+
+namespace service::plugins::simulator {
+
+/**
+ * @class SimulatedWriter SimulatedWriter.h "plugins/simulator/SimulatedWriter.h"
+ * @ingroup Implementation
+ *
+ * @brief An implementation of @ref IWriter.h that charges the simulated
+ *        kernel for every byte written
+ *
+ * Values are still written to the given stream: this writer is used for the
+ * temporary files of the optimizer, the transaction and the reorderer, which
+ * are read back. Sysctls never go through it (see @ref SimulatedNetwork.h).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class SimulatedWriter : public utils::file::IWriter {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param kernel Simulated kernel to charge
+     */
+    explicit SimulatedWriter(const kernel::Kernel& kernel);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~SimulatedWriter() override;
+
+    /** Class copy constructor */
+    SimulatedWriter(const SimulatedWriter&) = delete;
+
+    /** Class copy-assignment operator */
+    SimulatedWriter& operator=(const SimulatedWriter&) = delete;
+
+    /** Class move constructor */
+    SimulatedWriter(SimulatedWriter&&) = delete;
+
+    /** Class move-assignment operator */
+    SimulatedWriter& operator=(SimulatedWriter&&) = delete;
+
+    /**
+     * @brief Write a value to a stream
+     *
+     * @param stream The stream to write to
+     * @param value  The value to write
+     *
+     * @throw std::runtime_error if writing fails
+     */
+    void writeToStream(std::ostream& stream,
+                       const std::string& value) const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
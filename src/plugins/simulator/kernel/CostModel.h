@@ -0,0 +1,78 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_KERNEL_COST_MODEL_H__
+#define __PLUGINS_SIMULATOR_KERNEL_COST_MODEL_H__
+
+#include <chrono>
+
+namespace service::plugins::simulator::kernel {
+
+/**
+ * @struct CostModel
+ *
+ * @brief What each operation on the simulated kernel costs
+ *
+ * Default values are in the range of what a mid-range x86 host shows with
+ * legacy iptables. The most important one is @ref ruleRewrite: legacy
+ * iptables reads, modifies and writes back the whole table on every
+ * invocation, so adding rules one program at a time is quadratic while
+ * batching them (iptables-restore, ipset, nft sets...) is linear.
+ */
+struct CostModel {
+    /** fork() + execve() + waitpid() of any program */
+    std::chrono::nanoseconds spawn = std::chrono::microseconds(500);
+
+    /** One netlink request (E.g: "ip link add") */
+    std::chrono::nanoseconds netlink = std::chrono::microseconds(20);
+
+    /** One write into /proc/sys */
+    std::chrono::nanoseconds sysctl = std::chrono::microseconds(10);
+
+    /** Paid for every rule of a table each time iptables modifies it */
+    std::chrono::nanoseconds ruleRewrite = std::chrono::microseconds(1);
+
+    /** One rule loaded by a batch (iptables-restore) or by nft, on top of
+     *  the rewrite of the table paid by iptables-restore */
+    std::chrono::nanoseconds restoreRule = std::chrono::nanoseconds(200);
+
+    /** One element added to an ipset or nft set */
+    std::chrono::nanoseconds setEntry = std::chrono::nanoseconds(500);
+
+    /** One byte written to a file (E.g: restore files) */
+    std::chrono::nanoseconds writeByte = std::chrono::nanoseconds(1);
+
+    /** Whether the calling thread sleeps for the cost of each operation, so
+     *  that wall-clock measurements (E.g: of concurrent strategies) see it.
+     *  Otherwise the cost is only accumulated (see Kernel::elapsed()) */
+    bool realtime = false;
+};
+
+}
+
+#endif
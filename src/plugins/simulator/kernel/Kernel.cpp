@@ -0,0 +1,1128 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+#include "Kernel.h"
+
+using namespace service::plugins::simulator::kernel;
+
+namespace {
+
+using Arguments = std::vector<std::string_view>;
+
+/* Rule specifications of a chain */
+using Chain = std::vector<std::string>;
+
+struct Table {
+    std::map<std::string, Chain, std::less<>> chains;
+    std::size_t nbRules = 0;
+};
+
+/* Elements added one by one are known while loadSet() only gives a count */
+struct Set {
+    std::set<std::string, std::less<>> entries;
+    std::size_t nbLoaded = 0;
+
+    [[nodiscard]] std::size_t size() const { return entries.size() + nbLoaded; }
+};
+
+/* Chains and sets of an nftables table */
+struct NftTable {
+    std::map<std::string, Chain, std::less<>> chains;
+    std::map<std::string, std::size_t, std::less<>> sets;
+};
+
+using NftTables = std::map<std::string, NftTable, std::less<>>;
+
+/* What a batch of statements (E.g: a restore file) contains */
+struct Batch {
+    std::size_t nbRules   = 0;
+    std::size_t nbEntries = 0;
+};
+
+/* An iptables command line, without the program */
+struct IptablesCommand {
+    std::string_view table = "filter";
+    std::string_view command;
+    std::string_view chain;
+    Arguments specification;
+};
+
+/* Built-in chains created with each table */
+const std::map<std::string_view, std::vector<const char*>> BUILTIN_CHAINS = {
+    {"filter", {"INPUT", "FORWARD", "OUTPUT"}},
+    {"nat", {"PREROUTING", "INPUT", "OUTPUT", "POSTROUTING"}},
+    {"mangle", {"PREROUTING", "INPUT", "FORWARD", "OUTPUT", "POSTROUTING"}},
+    {"raw", {"PREROUTING", "OUTPUT"}},
+    {"security", {"INPUT", "FORWARD", "OUTPUT"}}};
+
+/* Like "ip", accept any abbreviation of a keyword (E.g: "a" for "address") */
+bool abbreviates(std::string_view argument, std::string_view keyword)
+{
+    return !argument.empty() && (keyword.substr(0, argument.size()) == argument);
+}
+
+bool isNumber(std::string_view argument)
+{
+    return !argument.empty()
+           && std::all_of(argument.begin(), argument.end(), [](char c) {
+                  return (c >= '0') && (c <= '9');
+              });
+}
+
+bool isNftFamily(std::string_view argument)
+{
+    return (argument == "ip") || (argument == "ip6") || (argument == "inet")
+           || (argument == "arp") || (argument == "bridge")
+           || (argument == "netdev");
+}
+
+std::string join(Arguments::const_iterator first, Arguments::const_iterator last)
+{
+    std::string result;
+    for (auto argument = first; argument != last; ++argument) {
+        if (!result.empty()) {
+            result += ' ';
+        }
+        result += *argument;
+    }
+
+    return result;
+}
+
+/* Words of a line of a restore file */
+Arguments split(std::string_view text)
+{
+    Arguments words;
+
+    std::size_t start = text.find_first_not_of(" \t\r\n");
+    while (start != std::string_view::npos) {
+        const std::size_t end = text.find_first_of(" \t\r\n", start);
+        words.push_back(text.substr(start, end - start));
+        start = text.find_first_not_of(" \t\r\n", end);
+    }
+
+    return words;
+}
+
+/* The value following "keyword" or an empty view */
+std::string_view valueOf(const Arguments& arguments, std::string_view keyword)
+{
+    const auto found = std::find(arguments.begin(), arguments.end(), keyword);
+
+    return ((found == arguments.end()) || (found + 1 == arguments.end()))
+               ? std::string_view()
+               : *(found + 1);
+}
+
+[[noreturn]] void fail(std::string_view program, const std::string& reason)
+{
+    throw std::runtime_error("Kernel: " + std::string(program) + ": " + reason);
+}
+
+std::string readFile(std::string_view program, std::string_view pathname)
+{
+    std::ifstream stream {std::string(pathname)};
+    if (!stream) {
+        fail(program, "Can't open " + std::string(pathname));
+    }
+
+    std::ostringstream content;
+    content << stream.rdbuf();
+    return content.str();
+}
+
+/* Lines that are neither empty nor comments */
+std::vector<std::string_view> linesOf(std::string_view content)
+{
+    std::vector<std::string_view> lines;
+
+    while (!content.empty()) {
+        const std::size_t end = content.find('\n');
+        std::string_view line = content.substr(0, end);
+        content.remove_prefix(end == std::string_view::npos ? content.size()
+                                                            : end + 1);
+
+        const std::size_t first = line.find_first_not_of(" \t\r");
+        if ((first != std::string_view::npos) && (line[first] != '#')) {
+            lines.push_back(line.substr(first));
+        }
+    }
+
+    return lines;
+}
+
+/* Statements of an nft script: they end with a new line or a ';' unless they
+ * are inside braces (E.g: elements of a set spread over several lines) */
+std::vector<std::string_view> statementsOf(std::string_view content)
+{
+    std::vector<std::string_view> statements;
+    std::size_t start = 0;
+    int depth         = 0;
+
+    for (std::size_t index = 0; index <= content.size(); ++index) {
+        const char character = (index < content.size()) ? content[index] : '\n';
+        if (character == '{') {
+            ++depth;
+        }
+        else if (character == '}') {
+            --depth;
+        }
+        else if ((depth == 0) && ((character == '\n') || (character == ';'))) {
+            std::string_view statement = content.substr(start, index - start);
+            statement = statement.substr(0, statement.find('#'));
+            if (!split(statement).empty()) {
+                statements.push_back(statement);
+            }
+            start = index + 1;
+        }
+    }
+
+    return statements;
+}
+
+/* Number of elements between the braces of "{ a, b, c }" */
+std::size_t countElements(const Arguments& words)
+{
+    std::size_t nbElements = 0;
+    bool hasElement        = false;
+
+    for (const std::string_view word : words) {
+        for (const char character : word) {
+            if ((character == ',') && hasElement) {
+                ++nbElements;
+                hasElement = false;
+            }
+            else if ((character != '{') && (character != '}')
+                     && (character != ',')) {
+                hasElement = true;
+            }
+        }
+    }
+
+    return nbElements + (hasElement ? 1 : 0);
+}
+
+IptablesCommand parseIptables(Arguments::const_iterator first,
+                              Arguments::const_iterator last)
+{
+    IptablesCommand parsed;
+
+    for (auto argument = first; argument != last; ++argument) {
+        const bool hasValue = (argument + 1 != last);
+        if (hasValue && ((*argument == "-t") || (*argument == "--table"))) {
+            parsed.table = *++argument;
+        }
+        else if ((*argument == "-w") || (*argument == "--wait")) {
+            continue;
+        }
+        else if (parsed.command.empty() && (argument->size() == 2)
+                 && ((*argument)[0] == '-')
+                 && (std::string_view("AIDNXFP").find((*argument)[1])
+                     != std::string_view::npos)) {
+            parsed.command = *argument;
+            parsed.chain   = hasValue ? *++argument : std::string_view();
+        }
+        else {
+            parsed.specification.push_back(*argument);
+        }
+    }
+
+    return parsed;
+}
+
+}
+
+struct Kernel::Internal {
+    const CostModel costModel;
+
+    mutable std::mutex mutex;
+
+    std::chrono::nanoseconds elapsed {0};
+    std::size_t nbPrograms = 0;
+
+    std::map<std::string, std::vector<std::string>, std::less<>> interfaces
+        = {{"lo", {"127.0.0.1/8"}}};
+    std::map<std::string, std::string> sysctls;
+    std::map<std::string, Table, std::less<>> tables;
+    std::map<std::string, Set, std::less<>> sets;
+    NftTables nftTables;
+
+    explicit Internal(const CostModel& providedCostModel)
+        : costModel(providedCostModel)
+    {}
+
+    /* Add "cost" to the virtual clock and sleep once the lock is released if
+     * the model is realtime */
+    template <typename Operation>
+    void perform(std::chrono::nanoseconds cost, Operation operation)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+
+            // Like a program that fails, an invalid operation is still paid
+            elapsed += cost;
+
+            const std::chrono::nanoseconds extraCost = operation();
+            elapsed += extraCost;
+            cost += extraCost;
+        }
+
+        if (costModel.realtime) {
+            std::this_thread::sleep_for(cost);
+        }
+    }
+
+    /* Cost of loading a batch of rules and set elements */
+    [[nodiscard]] std::chrono::nanoseconds cost(const Batch& batch) const
+    {
+        return costModel.restoreRule * static_cast<long>(batch.nbRules)
+               + costModel.setEntry * static_cast<long>(batch.nbEntries);
+    }
+
+    std::vector<std::string>& interface(std::string_view program,
+                                        std::string_view name)
+    {
+        const auto found = interfaces.find(name);
+        if (found == interfaces.end()) {
+            fail(program, "Cannot find device \"" + std::string(name) + "\"");
+        }
+
+        return found->second;
+    }
+
+    /* A table as the kernel creates it: built-in chains only */
+    static Table builtinTable(const std::string& key, std::string_view name)
+    {
+        const auto builtinChains = BUILTIN_CHAINS.find(name);
+        if (builtinChains == BUILTIN_CHAINS.end()) {
+            fail(key, "Table does not exist");
+        }
+
+        Table created;
+        for (const char* const chain : builtinChains->second) {
+            created.chains[chain];
+        }
+
+        return created;
+    }
+
+    Table& findTable(const std::string& key, std::string_view name)
+    {
+        const auto found = tables.find(key);
+        if (found != tables.end()) {
+            return found->second;
+        }
+
+        return tables.emplace(key, builtinTable(key, name)).first->second;
+    }
+
+    /* "ip [options] link|address <command> ..." */
+    std::chrono::nanoseconds ip(const Arguments& arguments)
+    {
+        const auto isOption = [](auto argument) {
+            return argument.empty() || (argument[0] == '-');
+        };
+
+        const auto object
+            = std::find_if_not(arguments.begin() + 1, arguments.end(), isOption);
+        if ((object == arguments.end()) || (object + 1 == arguments.end())) {
+            return costModel.netlink;
+        }
+
+        const std::string_view command = *(object + 1);
+        const Arguments parameters(object + 2, arguments.end());
+        if (abbreviates(*object, "link")) {
+            link(arguments[0], command, parameters);
+        }
+        else if (abbreviates(*object, "address")) {
+            address(arguments[0], command, parameters);
+        }
+
+        return costModel.netlink;
+    }
+
+    void link(std::string_view program,
+              std::string_view command,
+              const Arguments& parameters)
+    {
+        std::string_view name = valueOf(parameters, "name");
+        if (name.empty()) {
+            name = (!parameters.empty() && (parameters[0] == "dev"))
+                       ? valueOf(parameters, "dev")
+                       : (parameters.empty() ? name : parameters[0]);
+        }
+
+        if (name.empty()) {
+            fail(program, "Not enough information: \"dev\" argument is required");
+        }
+
+        if (abbreviates(command, "add")) {
+            if (!interfaces.emplace(name, std::vector<std::string>()).second) {
+                fail(program, "RTNETLINK answers: File exists");
+            }
+        }
+        else if (abbreviates(command, "delete")) {
+            (void)interface(program, name);
+            interfaces.erase(interfaces.find(name));
+        }
+        else if (abbreviates(command, "set")) {
+            (void)interface(program, name);
+        }
+    }
+
+    void address(std::string_view program,
+                 std::string_view command,
+                 const Arguments& parameters)
+    {
+        if (abbreviates(command, "show")) {
+            return;
+        }
+
+        std::vector<std::string>& addresses
+            = interface(program, valueOf(parameters, "dev"));
+        if (abbreviates(command, "flush")) {
+            addresses.clear();
+            return;
+        }
+
+        const std::string address(parameters[0]);
+        const auto found = std::find(addresses.begin(), addresses.end(), address);
+        if (abbreviates(command, "add")) {
+            if (found != addresses.end()) {
+                fail(program, "RTNETLINK answers: File exists");
+            }
+            addresses.push_back(address);
+        }
+        else if (abbreviates(command, "delete")) {
+            if (found == addresses.end()) {
+                fail(program, "RTNETLINK answers: Cannot assign requested address");
+            }
+            addresses.erase(found);
+        }
+    }
+
+    /* "iptables [-t table] -A|-I|-D|-N|-X|-F|-P chain [rule-specification]".
+     * The whole table is rewritten whatever the command */
+    std::chrono::nanoseconds iptables(const Arguments& arguments)
+    {
+        const IptablesCommand parsed
+            = parseIptables(arguments.begin() + 1, arguments.end());
+
+        const std::string program(arguments[0]);
+        Table& table = findTable(program + " " + std::string(parsed.table),
+                                 parsed.table);
+        const std::chrono::nanoseconds cost = costModel.ruleRewrite
+                                              * static_cast<long>(table.nbRules);
+
+        apply(program, table, parsed);
+
+        return cost;
+    }
+
+    static void apply(std::string_view program,
+                      Table& table,
+                      const IptablesCommand& parsed)
+    {
+        if (parsed.command == "-N") {
+            if (!table.chains.emplace(std::string(parsed.chain), Chain()).second) {
+                fail(program, "Chain already exists");
+            }
+            return;
+        }
+
+        if (parsed.chain.empty()
+            && ((parsed.command == "-F") || (parsed.command == "-X"))) {
+            flushOrDelete(
+                table, parsed.command, table.chains.begin(), table.chains.end());
+            return;
+        }
+
+        const auto chain = table.chains.find(parsed.chain);
+        if (chain == table.chains.end()) {
+            fail(program, "No chain/target/match by that name");
+        }
+
+        if ((parsed.command == "-F") || (parsed.command == "-X")) {
+            flushOrDelete(table, parsed.command, chain, std::next(chain));
+        }
+        else if ((parsed.command == "-A") || (parsed.command == "-I")) {
+            insert(program, table, chain->second, parsed);
+        }
+        else if (parsed.command == "-D") {
+            remove(program, table, chain->second, parsed.specification);
+        }
+    }
+
+    /* "iptables-restore [-c] [-n] [-w] <file>". Each table of the file is
+     * built aside then replaces the current one on COMMIT (or is applied on
+     * top of it with --noflush), which costs a single rewrite of the table
+     * plus the parsing of its rules */
+    std::chrono::nanoseconds iptablesRestore(const Arguments& arguments)
+    {
+        const std::string_view restore = arguments[0];
+        const std::string program(restore.substr(0, restore.rfind("-restore")));
+
+        bool noFlush = false;
+        std::string_view file;
+        for (auto argument = arguments.begin() + 1; argument != arguments.end();
+             ++argument) {
+            if ((*argument == "-n") || (*argument == "--noflush")) {
+                noFlush = true;
+            }
+            else if (!argument->empty() && ((*argument)[0] != '-')) {
+                file = *argument;
+            }
+        }
+
+        if (file.empty()) {
+            fail(restore, "Reading the standard input is not supported");
+        }
+
+        const std::string content = readFile(restore, file);
+        std::chrono::nanoseconds rewrites(0);
+        Batch batch;
+        std::string key;
+        std::optional<Table> pending;
+
+        for (const std::string_view line : linesOf(content)) {
+            Arguments words = split(line);
+            if (line[0] == '*') {
+                const std::string_view name = line.substr(1, line.find(' ') - 1);
+                key     = program + " " + std::string(name);
+                pending = noFlush ? findTable(key, name) : builtinTable(key, name);
+            }
+            else if (!pending) {
+                fail(restore, "No table specified before \"" + std::string(line)
+                                  + "\"");
+            }
+            else if (line[0] == ':') {
+                (void)pending->chains.emplace(std::string(words[0].substr(1)),
+                                              Chain());
+            }
+            else if (words[0] == "COMMIT") {
+                rewrites
+                    += costModel.ruleRewrite * static_cast<long>(pending->nbRules);
+                tables[key] = std::move(*pending);
+                pending.reset();
+            }
+            else {
+                // Counters restored with -c come first (E.g: "[12:3456] -A ...")
+                if (words[0][0] == '[') {
+                    words.erase(words.begin());
+                }
+                apply(restore, *pending, parseIptables(words.begin(), words.end()));
+                ++batch.nbRules;
+            }
+        }
+
+        if (pending) {
+            fail(restore, "COMMIT expected at the end of the file");
+        }
+
+        return rewrites + cost(batch);
+    }
+
+    template <typename Iterator>
+    static void flushOrDelete(Table& table,
+                              std::string_view command,
+                              Iterator first,
+                              Iterator last)
+    {
+        for (auto chain = first; chain != last;) {
+            table.nbRules -= chain->second.size();
+            chain->second.clear();
+
+            const bool isBuiltin = (chain->first == "INPUT")
+                                   || (chain->first == "FORWARD")
+                                   || (chain->first == "OUTPUT")
+                                   || (chain->first == "PREROUTING")
+                                   || (chain->first == "POSTROUTING");
+            chain = ((command == "-X") && !isBuiltin) ? table.chains.erase(chain)
+                                                      : std::next(chain);
+        }
+    }
+
+    static void insert(std::string_view program,
+                       Table& table,
+                       Chain& chain,
+                       const IptablesCommand& parsed)
+    {
+        const Arguments& specification = parsed.specification;
+        std::size_t position           = chain.size();
+        auto first                     = specification.begin();
+        if (parsed.command == "-I") {
+            position = 0;
+            if ((first != specification.end()) && isNumber(*first)) {
+                // Rule numbers start at 1 and can be one past the last rule
+                const std::size_t number = std::stoul(std::string(*first));
+                if (number == 0) {
+                    fail(program, "Invalid rule number `0'");
+                }
+                if (number > chain.size() + 1) {
+                    fail(program, "Index of insertion too big");
+                }
+                position = number - 1;
+                ++first;
+            }
+        }
+
+        chain.insert(chain.begin() + static_cast<long>(position),
+                     join(first, specification.end()));
+        ++table.nbRules;
+    }
+
+    static void remove(std::string_view program,
+                       Table& table,
+                       Chain& chain,
+                       const Arguments& specification)
+    {
+        auto found = chain.end();
+        if ((specification.size() == 1) && isNumber(specification[0])) {
+            const std::size_t number = std::stoul(std::string(specification[0]));
+            if ((number >= 1) && (number <= chain.size())) {
+                found = chain.begin() + static_cast<long>(number - 1);
+            }
+        }
+        else {
+            found = std::find(chain.begin(),
+                              chain.end(),
+                              join(specification.begin(), specification.end()));
+        }
+
+        if (found == chain.end()) {
+            fail(program, "Bad rule (does a matching rule exist in that chain?)");
+        }
+
+        chain.erase(found);
+        --table.nbRules;
+    }
+
+    /* "ipset [options] create|add|del|flush|destroy|swap|rename|restore ...".
+     * Options (E.g: "-exist", "-file <file>") may come anywhere */
+    std::chrono::nanoseconds ipset(const Arguments& arguments)
+    {
+        const std::string_view program = arguments[0];
+        bool exist                     = false;
+        std::string_view file;
+        Arguments command;
+
+        for (auto argument = arguments.begin() + 1; argument != arguments.end();
+             ++argument) {
+            const bool hasValue = (argument + 1 != arguments.end());
+            if ((*argument == "-exist") || (*argument == "-!")) {
+                exist = true;
+            }
+            else if (hasValue && ((*argument == "-file") || (*argument == "-f"))) {
+                file = *++argument;
+            }
+            else if (hasValue && ((*argument == "-output") || (*argument == "-o"))) {
+                ++argument;
+            }
+            else if (!argument->empty() && ((*argument)[0] == '-')) {
+                continue;
+            }
+            else {
+                command.push_back(*argument);
+            }
+        }
+
+        if (command.empty()) {
+            return std::chrono::nanoseconds(0);
+        }
+
+        Batch batch;
+        if (command[0] != "restore") {
+            ipsetCommand(program, command, exist, batch);
+            return cost(batch);
+        }
+
+        if (file.empty()) {
+            fail(program, "Reading the standard input is not supported");
+        }
+
+        /* Lines are commands without the program */
+        const std::string content = readFile(program, file);
+        for (const std::string_view line : linesOf(content)) {
+            const Arguments words = split(line);
+            if (words[0] != "COMMIT") {
+                ipsetCommand(program, words, exist, batch);
+            }
+        }
+
+        return cost(batch);
+    }
+
+    void ipsetCommand(std::string_view program,
+                      const Arguments& command,
+                      bool exist,
+                      Batch& batch)
+    {
+        const std::string_view name
+            = (command.size() > 1) ? command[1] : std::string_view();
+
+        if ((command[0] == "create") || (command[0] == "n")) {
+            if (!sets.emplace(std::string(name), Set()).second && !exist) {
+                fail(program, "Set cannot be created: set with the same name "
+                              "already exists");
+            }
+            return;
+        }
+
+        // Without a name, all the sets are flushed or destroyed
+        if (name.empty() && ((command[0] == "flush") || (command[0] == "destroy"))) {
+            for (auto& set : sets) {
+                set.second = Set();
+            }
+            if (command[0] == "destroy") {
+                sets.clear();
+            }
+            return;
+        }
+
+        const auto set = sets.find(name);
+        if (set == sets.end()) {
+            fail(program, "The set with the given name does not exist");
+        }
+
+        const std::string_view entry
+            = (command.size() > 2) ? command[2] : std::string_view();
+        if ((command[0] == "add") || (command[0] == "a")) {
+            if (!set->second.entries.emplace(entry).second && !exist) {
+                fail(program, "Element cannot be added to the set: it's already "
+                              "added");
+            }
+            ++batch.nbEntries;
+        }
+        else if ((command[0] == "del") || (command[0] == "d")) {
+            const auto found = set->second.entries.find(entry);
+            if (found != set->second.entries.end()) {
+                set->second.entries.erase(found);
+            }
+            else if (set->second.nbLoaded > 0) {
+                --set->second.nbLoaded;
+            }
+            else if (!exist) {
+                fail(program, "Element cannot be deleted from the set: it's not "
+                              "added");
+            }
+        }
+        else if (command[0] == "flush") {
+            set->second = Set();
+        }
+        else if (command[0] == "destroy") {
+            sets.erase(set);
+        }
+        else if ((command[0] == "swap") || (command[0] == "w")) {
+            const auto other = sets.find(entry);
+            if (other == sets.end()) {
+                fail(program, "The set with the given name does not exist");
+            }
+            std::swap(set->second, other->second);
+        }
+        else if ((command[0] == "rename") || (command[0] == "e")) {
+            if (sets.count(entry) != 0) {
+                fail(program, "Set cannot be renamed: a set with the new name "
+                              "already exists");
+            }
+            Set renamed = std::move(set->second);
+            sets.erase(set);
+            sets.emplace(std::string(entry), std::move(renamed));
+        }
+    }
+
+    /* "nft [options] <statement>" or "nft [options] -f <file>". A file is
+     * a single transaction: it is applied to a copy of the tables which
+     * replaces them once all its statements succeeded. The kernel receives
+     * a single netlink batch either way */
+    std::chrono::nanoseconds nft(const Arguments& arguments)
+    {
+        const std::string_view program = arguments[0];
+        std::string_view file;
+        Arguments statement;
+
+        for (auto argument = arguments.begin() + 1; argument != arguments.end();
+             ++argument) {
+            const bool hasValue = (argument + 1 != arguments.end());
+            if (statement.empty() && hasValue
+                && ((*argument == "-f") || (*argument == "--file"))) {
+                file = *++argument;
+            }
+            else if (statement.empty() && !argument->empty()
+                     && ((*argument)[0] == '-')) {
+                continue;
+            }
+            else {
+                statement.push_back(*argument);
+            }
+        }
+
+        Batch batch;
+        if (file.empty()) {
+            if (!statement.empty()) {
+                nftStatement(program, nftTables, statement, batch);
+            }
+            return costModel.netlink + cost(batch);
+        }
+
+        const std::string content = readFile(program, file);
+        NftTables transaction     = nftTables;
+        for (const std::string_view line : statementsOf(content)) {
+            nftStatement(program, transaction, split(line), batch);
+        }
+        nftTables = std::move(transaction);
+
+        return costModel.netlink + cost(batch);
+    }
+
+    /* "<verb> <object> [family] <table> [name] ...", the family being "ip"
+     * when omitted */
+    static void nftStatement(std::string_view program,
+                             NftTables& nftTables,
+                             const Arguments& words,
+                             Batch& batch)
+    {
+        if (words.size() < 2) {
+            return;
+        }
+
+        const std::string_view verb   = words[0];
+        const std::string_view object = words[1];
+        if (object == "ruleset") {
+            if ((verb == "flush") || (verb == "delete")) {
+                nftTables.clear();
+            }
+            return;
+        }
+
+        std::size_t index       = 2;
+        std::string_view family = "ip";
+        if ((index < words.size()) && isNftFamily(words[index])) {
+            family = words[index++];
+        }
+        if (index >= words.size()) {
+            fail(program, "syntax error, unexpected end of statement");
+        }
+
+        const std::string key
+            = std::string(family) + " " + std::string(words[index]);
+        const std::string_view name
+            = (index + 1 < words.size()) ? words[index + 1] : std::string_view();
+        const Arguments rest(words.begin() + static_cast<long>(std::min(
+                                 index + 2, words.size())),
+                             words.end());
+
+        if (object == "table") {
+            nftTable(program, nftTables, verb, key);
+            return;
+        }
+
+        const auto table = nftTables.find(key);
+        if (table == nftTables.end()) {
+            fail(program, "No such file or directory: table " + key);
+        }
+
+        if (object == "chain") {
+            const bool exists = table->second.chains.count(name) != 0;
+            if ((verb == "add") || (verb == "create")) {
+                if (exists && (verb == "create")) {
+                    fail(program, "File exists: chain " + std::string(name));
+                }
+                (void)table->second.chains.emplace(std::string(name), Chain());
+                return;
+            }
+            if (!exists) {
+                fail(program,
+                     "No such file or directory: chain " + std::string(name));
+            }
+            if (verb == "flush") {
+                table->second.chains.find(name)->second.clear();
+            }
+            else if (verb == "delete") {
+                table->second.chains.erase(table->second.chains.find(name));
+            }
+        }
+        else if (object == "rule") {
+            const auto chain = table->second.chains.find(name);
+            if (chain == table->second.chains.end()) {
+                fail(program,
+                     "No such file or directory: chain " + std::string(name));
+            }
+            if (verb == "add") {
+                chain->second.push_back(join(rest.begin(), rest.end()));
+                ++batch.nbRules;
+            }
+            else if (verb == "insert") {
+                chain->second.insert(chain->second.begin(),
+                                     join(rest.begin(), rest.end()));
+                ++batch.nbRules;
+            }
+        }
+        else if ((object == "set") || (object == "map")) {
+            nftSet(program, table->second, verb, name);
+        }
+        else if (object == "element") {
+            const auto set = table->second.sets.find(name);
+            if (set == table->second.sets.end()) {
+                fail(program,
+                     "No such file or directory: set " + std::string(name));
+            }
+            const std::size_t nbElements = countElements(rest);
+            if (verb == "add") {
+                set->second += nbElements;
+                batch.nbEntries += nbElements;
+            }
+            else if (verb == "delete") {
+                set->second -= std::min(set->second, nbElements);
+            }
+        }
+    }
+
+    static void nftTable(std::string_view program,
+                         NftTables& nftTables,
+                         std::string_view verb,
+                         const std::string& key)
+    {
+        const auto table = nftTables.find(key);
+        if ((verb == "add") || (verb == "create")) {
+            if ((table != nftTables.end()) && (verb == "create")) {
+                fail(program, "File exists: table " + key);
+            }
+            (void)nftTables.emplace(key, NftTable());
+            return;
+        }
+
+        if (table == nftTables.end()) {
+            fail(program, "No such file or directory: table " + key);
+        }
+
+        if (verb == "delete") {
+            nftTables.erase(table);
+        }
+        else if (verb == "flush") {
+            for (auto& chain : table->second.chains) {
+                chain.second.clear();
+            }
+        }
+    }
+
+    static void nftSet(std::string_view program,
+                       NftTable& table,
+                       std::string_view verb,
+                       std::string_view name)
+    {
+        const auto set = table.sets.find(name);
+        if ((verb == "add") || (verb == "create")) {
+            if ((set != table.sets.end()) && (verb == "create")) {
+                fail(program, "File exists: set " + std::string(name));
+            }
+            (void)table.sets.emplace(std::string(name), 0);
+            return;
+        }
+
+        if (set == table.sets.end()) {
+            fail(program, "No such file or directory: set " + std::string(name));
+        }
+
+        if (verb == "flush") {
+            set->second = 0;
+        }
+        else if (verb == "delete") {
+            table.sets.erase(set);
+        }
+    }
+};
+
+Kernel::Kernel(const CostModel& costModel)
+    : m_internal(std::make_unique<Internal>(costModel))
+{}
+
+Kernel::~Kernel() = default;
+
+void Kernel::execute(int argc, const char* const* argv) const
+{
+    Arguments arguments(argv, argv + argc);
+    if (arguments.empty()) {
+        throw std::invalid_argument("Kernel: No program to execute");
+    }
+
+    // Programs are recognized by their name whatever their directory
+    const std::size_t slash = arguments[0].rfind('/');
+    if (slash != std::string_view::npos) {
+        arguments[0].remove_prefix(slash + 1);
+    }
+
+    m_internal->perform(m_internal->costModel.spawn, [this, &arguments]() {
+        ++m_internal->nbPrograms;
+
+        const std::string_view program = arguments[0];
+        if (program == "ip") {
+            return m_internal->ip(arguments);
+        }
+        if ((program == "iptables") || (program == "ip6tables")) {
+            return m_internal->iptables(arguments);
+        }
+        if ((program == "iptables-restore") || (program == "ip6tables-restore")) {
+            return m_internal->iptablesRestore(arguments);
+        }
+        if (program == "ipset") {
+            return m_internal->ipset(arguments);
+        }
+        if (program == "nft") {
+            return m_internal->nft(arguments);
+        }
+
+        return std::chrono::nanoseconds(0);
+    });
+}
+
+void Kernel::writeSysctl(const std::string& pathname, const std::string& value) const
+{
+    m_internal->perform(m_internal->costModel.sysctl, [this, &pathname, &value]() {
+        m_internal->sysctls[pathname] = value;
+        return std::chrono::nanoseconds(0);
+    });
+}
+
+void Kernel::loadSet(const std::string& name, std::size_t nbEntries) const
+{
+    m_internal->perform(std::chrono::nanoseconds(0), [this, &name, nbEntries]() {
+        m_internal->sets[name] = Set {{}, nbEntries};
+        return m_internal->costModel.setEntry * static_cast<long>(nbEntries);
+    });
+}
+
+void Kernel::write(std::size_t nbBytes) const
+{
+    m_internal->perform(std::chrono::nanoseconds(0), [this, nbBytes]() {
+        return m_internal->costModel.writeByte * static_cast<long>(nbBytes);
+    });
+}
+
+bool Kernel::hasInterface(const std::string& interfaceName) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    return m_internal->interfaces.count(interfaceName) != 0;
+}
+
+std::vector<std::string> Kernel::addresses(const std::string& interfaceName) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    const auto found = m_internal->interfaces.find(interfaceName);
+    return (found == m_internal->interfaces.end()) ? std::vector<std::string>()
+                                                   : found->second;
+}
+
+std::optional<std::string> Kernel::sysctl(const std::string& pathname) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    const auto found = m_internal->sysctls.find(pathname);
+    if (found == m_internal->sysctls.end()) {
+        return std::nullopt;
+    }
+
+    return found->second;
+}
+
+std::vector<std::string> Kernel::rules(const std::string& program,
+                                       const std::string& table,
+                                       const std::string& chain) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    if (program == "nft") {
+        const auto foundTable = m_internal->nftTables.find(table);
+        if (foundTable == m_internal->nftTables.end()) {
+            return {};
+        }
+
+        const auto& chains    = foundTable->second.chains;
+        const auto foundChain = chains.find(chain);
+        return (foundChain == chains.end()) ? std::vector<std::string>()
+                                            : foundChain->second;
+    }
+
+    const auto foundTable = m_internal->tables.find(program + " " + table);
+    if (foundTable == m_internal->tables.end()) {
+        return {};
+    }
+
+    const auto& chains    = foundTable->second.chains;
+    const auto foundChain = chains.find(chain);
+    return (foundChain == chains.end()) ? std::vector<std::string>()
+                                        : foundChain->second;
+}
+
+std::size_t Kernel::setSize(const std::string& name) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    const auto found = m_internal->sets.find(name);
+    return (found == m_internal->sets.end()) ? 0 : found->second.size();
+}
+
+std::size_t Kernel::nftSetSize(const std::string& table,
+                               const std::string& name) const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    const auto foundTable = m_internal->nftTables.find(table);
+    if (foundTable == m_internal->nftTables.end()) {
+        return 0;
+    }
+
+    const auto& sets    = foundTable->second.sets;
+    const auto foundSet = sets.find(name);
+    return (foundSet == sets.end()) ? 0 : foundSet->second;
+}
+
+std::chrono::nanoseconds Kernel::elapsed() const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    return m_internal->elapsed;
+}
+
+std::size_t Kernel::nbPrograms() const
+{
+    const std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    return m_internal->nbPrograms;
+}
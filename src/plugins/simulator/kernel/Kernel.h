@@ -0,0 +1,168 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_SIMULATOR_KERNEL_KERNEL_H__
+#define __PLUGINS_SIMULATOR_KERNEL_KERNEL_H__
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CostModel.h"
+
+namespace service::plugins::simulator::kernel {
+
+/**
+ * @class Kernel Kernel.h "plugins/simulator/kernel/Kernel.h"
+ * @ingroup Helper
+ *
+ * @brief An in-memory model of the parts of the kernel configured by the
+ *        service: network interfaces and their addresses, sysctls, iptables
+ *        chains and address sets
+ *
+ * Programs are interpreted instead of being executed: "ip link" and "ip addr"
+ * add, delete and modify interfaces; "iptables" and "ip6tables" append,
+ * insert, delete and flush rules of chains; "ipset" creates, fills and swaps
+ * sets; "nft" manages tables, chains, rules and sets. Batches are read from
+ * their file and applied too: "iptables-restore", "ipset restore" and
+ * "nft -f". Any other program only costs a spawn.
+ *
+ * Each operation charges the time given by the @ref CostModel.h to a virtual
+ * clock. All methods are thread-safe.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Kernel {
+
+public:
+    /**
+     * Class constructor
+     *
+     * Only the "lo" interface exists at the beginning.
+     *
+     * @param costModel What each operation costs
+     */
+    explicit Kernel(const CostModel& costModel);
+
+    /** Class destructor */
+    ~Kernel();
+
+    /** Class copy constructor */
+    Kernel(const Kernel&) = delete;
+
+    /** Class copy-assignment operator */
+    Kernel& operator=(const Kernel&) = delete;
+
+    /** Class move constructor */
+    Kernel(Kernel&&) = delete;
+
+    /** Class move-assignment operator */
+    Kernel& operator=(Kernel&&) = delete;
+
+    /**
+     * @brief Simulate the execution of a program
+     *
+     * @param argc The number of elements in argv
+     * @param argv Arguments, starting with the path to the program
+     *
+     * @throw std::runtime_error if the program would have failed (E.g: the
+     *        interface or the chain does not exist)
+     */
+    void execute(int argc, const char* const* argv) const;
+
+    /** Set the value of the sysctl at "pathname" */
+    void writeSysctl(const std::string& pathname, const std::string& value) const;
+
+    /** Replace the content of the set "name" by "nbEntries" elements */
+    void loadSet(const std::string& name, std::size_t nbEntries) const;
+
+    /** Account for "nbBytes" bytes written to a file */
+    void write(std::size_t nbBytes) const;
+
+    /** Check if the network interface whose name is "interfaceName" exists */
+    [[nodiscard]] bool hasInterface(const std::string& interfaceName) const;
+
+    /** Addresses of an interface, in the order they were added */
+    [[nodiscard]] std::vector<std::string>
+        addresses(const std::string& interfaceName) const;
+
+    /** Value of a sysctl or std::nullopt if it was never written */
+    [[nodiscard]] std::optional<std::string>
+        sysctl(const std::string& pathname) const;
+
+    /**
+     * @brief Rules of a chain, in order
+     *
+     * @param program "iptables", "ip6tables" or "nft"
+     * @param table   E.g: "filter" or, for nft, "inet filter"
+     * @param chain   E.g: "INPUT"
+     *
+     * @return The rule specifications (E.g: "-s 10.0.0.1 -j DROP")
+     */
+    [[nodiscard]] std::vector<std::string> rules(const std::string& program,
+                                                 const std::string& table,
+                                                 const std::string& chain) const;
+
+    /** Number of elements in the ipset "name" or 0 if it does not exist */
+    [[nodiscard]] std::size_t setSize(const std::string& name) const;
+
+    /**
+     * @brief Number of elements in an nftables set
+     *
+     * @param table The family and the name of the table (E.g: "inet filter")
+     * @param name  The name of the set
+     *
+     * @return 0 if the set does not exist
+     */
+    [[nodiscard]] std::size_t nftSetSize(const std::string& table,
+                                         const std::string& name) const;
+
+    /** Sum of the costs of all operations performed so far */
+    [[nodiscard]] std::chrono::nanoseconds elapsed() const;
+
+    /** Number of programs executed so far */
+    [[nodiscard]] std::size_t nbPrograms() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
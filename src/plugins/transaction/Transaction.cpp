@@ -0,0 +1,458 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <net/if.h>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "utils/command/parser/Parser.h"
+#include "utils/command/pathname/DefaultPathnames.h"
+#include "utils/file/temporary/TemporaryFile.h"
+#include "utils/helper/Errno.h"
+
+#include "Transaction.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::transaction;
+using namespace utils::command;
+using namespace utils::file;
+using namespace utils::helper;
+
+namespace {
+
+/* Programs whose state is saved, in the order it is restored: ipset comes
+ * last since sets can't be destroyed while restored rules refer to them */
+constexpr std::array<const char*, 4> FIREWALLS
+    = {"iptables", "ip6tables", "nft", "ipset"};
+
+/* "nft list ruleset" only writes to its standard output */
+constexpr const char* const SHELL = "/bin/sh";
+
+/* Saved sets that still exist are filled under this name then swapped */
+constexpr const char* const ROLLBACK_SET = "networkservice-rollback";
+
+/* Split "<directory>/<program> <arguments>" */
+std::pair<std::string, std::string> programOf(const std::string& command)
+{
+    const std::string pathname = command.substr(0, command.find(' '));
+    return {pathname.substr(pathname.rfind('/') + 1), pathname};
+}
+
+/* Names of the sets in a file written by "ipset save" */
+std::set<std::string> ipsetNames(const std::string& pathname)
+{
+    std::ifstream stream(pathname);
+    std::set<std::string> names;
+    for (std::string line; std::getline(stream, line);) {
+        std::string verb;
+        std::string name;
+        std::istringstream(line) >> verb >> name;
+        if (verb == "create") {
+            names.insert(name);
+        }
+    }
+
+    return names;
+}
+
+}
+
+struct Transaction::Internal {
+    /* A file where the state of a firewall has been saved */
+    struct FirewallSnapshot {
+        std::string program;  /* E.g: "nft" */
+        std::string pathname; /* The configured binary. E.g: "/usr/sbin/nft" */
+        std::unique_ptr<TemporaryFile> file;
+    };
+
+    const IExecutor& executor;
+    const IWriter& writer;
+    const bool enabled;
+
+    /* One per firewall used by the rules to apply */
+    std::vector<FirewallSnapshot> firewallSnapshots;
+
+    /* Values of the files written by layer commands before the apply */
+    std::vector<ConfigData::Network::LayerCommand> layerSnapshot;
+
+    /* Existing interfaces if there are interface commands to apply */
+    std::optional<std::set<std::string>> interfacesSnapshot;
+
+    /* Words of the interface commands: the only interfaces the apply can
+     * have created, and the binary of "ip" */
+    std::set<std::string> interfaceWords;
+    std::string ip;
+
+    explicit Internal(const IExecutor& providedExecutor,
+                      const IWriter& providedWriter,
+                      bool providedEnabled)
+        : executor(providedExecutor),
+          writer(providedWriter),
+          enabled(providedEnabled)
+    {}
+
+    void execute(const std::string& command) const
+    {
+        const std::unique_ptr<Parser::Command, Parser::CommandDeleter>& parsedCommand
+            = Parser::parse(command);
+
+        const IExecutor::ProgramParams params
+            = {parsedCommand->pathname, parsedCommand->argv, nullptr, "transaction"};
+        executor.executeProgram(params);
+    }
+
+    void writeFile(const TemporaryFile& file, const std::string& content) const
+    {
+        std::ofstream stream(file.pathname());
+        writer.writeToStream(stream, content);
+    }
+
+    /* The binary of each firewall used by the rules, as configured */
+    static std::map<std::string, std::string>
+        firewallsOf(const ConfigData& configData)
+    {
+        std::map<std::string, std::string> pathnames;
+        for (const ConfigData::Rule& rule : configData.rules) {
+            for (const std::string& command : rule.commands) {
+                const auto [program, pathname] = programOf(command);
+                if (std::find(FIREWALLS.begin(), FIREWALLS.end(), program)
+                    != FIREWALLS.end()) {
+                    pathnames.emplace(program, pathname);
+                }
+            }
+        }
+
+        for (const ConfigData::Rule& rule : configData.rules) {
+            for (const ConfigData::Rule::AddressSet& set : rule.sets) {
+                // Loaded by the default binary. An unknown backend is
+                // reported when the set is loaded
+                const char* const pathname = DefaultPathnames::of(set.backend);
+                if (pathname != nullptr) {
+                    pathnames.emplace(set.backend, pathname);
+                }
+            }
+        }
+
+        return pathnames;
+    }
+
+    void saveFirewall(const FirewallSnapshot& snapshot) const
+    {
+        const std::string& file = snapshot.file->pathname();
+
+        if (snapshot.program == "ipset") {
+            execute(snapshot.pathname + " -file " + file + " save");
+        }
+        else if (snapshot.program == "nft") {
+            const TemporaryFile script;
+            writeFile(script,
+                      "exec " + snapshot.pathname + " list ruleset > " + file
+                          + "\n");
+            execute(std::string(SHELL) + " " + script.pathname());
+        }
+        else {
+            execute(snapshot.pathname + "-save -f " + file);
+        }
+    }
+
+    void restoreFirewall(const FirewallSnapshot& snapshot) const
+    {
+        const std::string& file = snapshot.file->pathname();
+
+        if (snapshot.program == "ipset") {
+            restoreIpset(snapshot);
+        }
+        else if (snapshot.program == "nft") {
+            // A single transaction replacing the whole ruleset
+            const TemporaryFile script;
+            writeFile(script, "flush ruleset\ninclude \"" + file + "\"\n");
+            execute(snapshot.pathname + " -f " + script.pathname());
+        }
+        else {
+            execute(snapshot.pathname + "-restore " + file);
+        }
+    }
+
+    /* Sets still in use can't be destroyed then created again: the saved
+     * content is loaded into another set swapped with them instead. Sets
+     * created since the snapshot are destroyed. The batch is streamed since
+     * sets may hold millions of entries */
+    void restoreIpset(const FirewallSnapshot& snapshot) const
+    {
+        const TemporaryFile current;
+        execute(snapshot.pathname + " -file " + current.pathname() + " save");
+        const std::set<std::string> currentNames = ipsetNames(current.pathname());
+
+        const TemporaryFile batch;
+        {
+            std::ifstream saved(snapshot.file->pathname());
+            std::ofstream stream(batch.pathname());
+            std::set<std::string> savedNames;
+            std::string swapped;
+
+            auto endSet = [&stream, &swapped]() {
+                if (!swapped.empty()) {
+                    stream << "swap " << ROLLBACK_SET << " " << swapped << "\n"
+                           << "destroy " << ROLLBACK_SET << "\n";
+                    swapped.clear();
+                }
+            };
+
+            std::string target;
+            for (std::string line; std::getline(saved, line);) {
+                std::istringstream words(line);
+                std::string verb;
+                std::string name;
+                words >> verb >> name;
+
+                if (verb == "create") {
+                    endSet();
+                    savedNames.insert(name);
+                    swapped = currentNames.count(name) != 0 ? name : "";
+                    target  = swapped.empty() ? name : ROLLBACK_SET;
+                }
+                else if (verb != "add") {
+                    continue;
+                }
+
+                // Only the name is replaced: "<verb> <name><arguments>"
+                const std::size_t arguments = verb.size() + 1 + name.size();
+                stream << verb << " " << target
+                       << std::string_view(line).substr(arguments) << "\n";
+            }
+            endSet();
+
+            for (const std::string& name : currentNames) {
+                if (savedNames.count(name) == 0) {
+                    stream << "destroy " << name << "\n";
+                }
+            }
+
+            stream.close();
+            if (stream.fail()) {
+                throw std::runtime_error("Transaction: Could not write "
+                                         + batch.pathname());
+            }
+        }
+
+        execute(snapshot.pathname + " -file " + batch.pathname() + " restore");
+    }
+
+    static std::set<std::string> interfaceNames()
+    {
+        struct if_nameindex* interfaces = if_nameindex();
+        if (interfaces == nullptr) {
+            throw std::runtime_error(Errno::toString("if_nameindex()", errno));
+        }
+
+        std::set<std::string> names;
+        for (const struct if_nameindex* interface = interfaces;
+             interface->if_index != 0;
+             ++interface) {
+            names.emplace(interface->if_name);
+        }
+
+        if_freenameindex(interfaces);
+
+        return names;
+    }
+
+    /* Reader is not used because files in /proc/sys have no size */
+    static std::string readValue(const std::string& pathname)
+    {
+        std::ifstream stream(pathname);
+        if (!stream.good()) {
+            throw std::runtime_error("Transaction: Could not read " + pathname);
+        }
+
+        std::string value((std::istreambuf_iterator<char>(stream)),
+                          std::istreambuf_iterator<char>());
+        if (!value.empty() && (value.back() == '\n')) {
+            value.pop_back();
+        }
+
+        return value;
+    }
+
+    /* Interfaces which did not exist before the apply and are named by its
+     * commands. Others may have been created meanwhile by someone else */
+    [[nodiscard]] bool isCreatedByApply(const std::string& name) const
+    {
+        return (interfacesSnapshot->count(name) == 0)
+               && (interfaceWords.count(name) != 0);
+    }
+
+    void restoreInterfaces() const
+    {
+        std::string batch;
+        for (const std::string& name : interfaceNames()) {
+            if (isCreatedByApply(name)) {
+                batch += "link delete " + name + "\n";
+            }
+        }
+
+        if (batch.empty()) {
+            return;
+        }
+
+        const TemporaryFile batchFile;
+        writeFile(batchFile, batch);
+
+        try {
+            execute(ip + " -force -batch " + batchFile.pathname());
+        }
+        catch (const std::exception&) {
+            // Deleting an interface may also delete the ones that depend on
+            // it (VLAN, ...) making next lines fail: only the result matters
+            for (const std::string& name : interfaceNames()) {
+                if (isCreatedByApply(name)) {
+                    throw;
+                }
+            }
+        }
+    }
+
+    void restoreValue(const ConfigData::Network::LayerCommand& savedValue) const
+    {
+        std::ofstream stream(savedValue.pathname);
+        writer.writeToStream(stream, savedValue.value);
+    }
+
+    void clear()
+    {
+        firewallSnapshots.clear();
+        layerSnapshot.clear();
+        interfacesSnapshot.reset();
+        interfaceWords.clear();
+    }
+};
+
+Transaction::Transaction(const IExecutor& executor,
+                         const IWriter& writer,
+                         bool enabled)
+    : m_internal(std::make_unique<Internal>(executor, writer, enabled))
+{}
+
+Transaction::~Transaction() = default;
+
+void Transaction::begin(const ConfigData& configData) const
+{
+    if (!m_internal->enabled) {
+        return;
+    }
+
+    m_internal->clear();
+
+    const std::map<std::string, std::string> firewalls
+        = Internal::firewallsOf(configData);
+    for (const char* const program : FIREWALLS) {
+        const auto firewall = firewalls.find(program);
+        if (firewall == firewalls.end()) {
+            continue;
+        }
+
+        Internal::FirewallSnapshot snapshot {
+            program, firewall->second, std::make_unique<TemporaryFile>()};
+        m_internal->saveFirewall(snapshot);
+        m_internal->firewallSnapshots.push_back(std::move(snapshot));
+    }
+
+    for (const auto& layerCommand : configData.network.layerCommands) {
+        m_internal->layerSnapshot.push_back(
+            {layerCommand.pathname, Internal::readValue(layerCommand.pathname)});
+    }
+
+    if (!configData.network.interfaceCommands.empty()) {
+        m_internal->ip = DefaultPathnames::IP;
+        for (const std::string& command : configData.network.interfaceCommands) {
+            const auto [program, pathname] = programOf(command);
+            if (program == "ip") {
+                m_internal->ip = pathname;
+            }
+
+            std::istringstream words(command);
+            for (std::string word; words >> word;) {
+                m_internal->interfaceWords.insert(word);
+            }
+        }
+
+        m_internal->interfacesSnapshot = Internal::interfaceNames();
+    }
+}
+
+void Transaction::commit() const
+{
+    m_internal->clear();
+}
+
+void Transaction::rollback() const
+{
+    if (!m_internal->enabled) {
+        return;
+    }
+
+    std::string errors;
+    auto attempt = [&errors](const auto& restore) {
+        try {
+            restore();
+        }
+        catch (const std::exception& e) {
+            errors += std::string(errors.empty() ? "" : "; ") + e.what();
+        }
+    };
+
+    // Undo in the reverse order of the apply: rules, interfaces then layer
+    for (const auto& snapshot : m_internal->firewallSnapshots) {
+        attempt([this, &snapshot]() { m_internal->restoreFirewall(snapshot); });
+    }
+
+    if (m_internal->interfacesSnapshot) {
+        attempt([this]() { m_internal->restoreInterfaces(); });
+    }
+
+    // Reverse order so that a file written twice gets its initial value
+    const auto& layerSnapshot = m_internal->layerSnapshot;
+    for (auto it = layerSnapshot.rbegin(); it != layerSnapshot.rend(); ++it) {
+        attempt([this, &it]() { m_internal->restoreValue(*it); });
+    }
+
+    m_internal->clear();
+
+    if (!errors.empty()) {
+        throw std::runtime_error("Transaction: Rollback failed: " + errors);
+    }
+}
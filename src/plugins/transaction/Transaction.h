@@ -0,0 +1,128 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __PLUGINS_TRANSACTION_TRANSACTION_H__
+#define __PLUGINS_TRANSACTION_TRANSACTION_H__
+
+#include <memory>
+
+#include "utils/command/executor/IExecutor.h"
+#include "utils/file/writer/IWriter.h"
+
+#include "service/plugins/ITransaction.h"
+
+namespace service::plugins::transaction {
+
+/**
+ * @class Transaction Transaction.h "plugins/transaction/Transaction.h"
+ * @ingroup Implementation
+ *
+ * @brief Make applying a configuration all-or-nothing
+ *
+ * This class is the "low level class" that implements @ref ITransaction.h
+ *
+ * Only what the configuration touches is saved: the state of each firewall
+ * its rules use (iptables, ip6tables, nft and ipset, sets loaded from files
+ * included), the current value of each file written by a layer command and
+ * the list of existing network interfaces when there are interface
+ * commands. Snapshots are taken with the binaries of the configured
+ * commands (E.g: "/usr/sbin/iptables" is saved by "/usr/sbin/iptables-save").
+ *
+ * Restoring is done in batches rather than by replaying inverse commands: a
+ * single iptables-restore (or ip6tables-restore) per family, a single "nft
+ * -f" transaction replacing the ruleset, a single "ipset restore" swapping
+ * the saved content into the sets and destroying the new ones, the saved
+ * values written back and a single "ip -batch" deleting the interfaces
+ * created since the snapshot and named by the interface commands, so that
+ * the ones created meanwhile by someone else are left alone.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Transaction : public ITransaction {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param executor Command executor to use
+     * @param writer   Writer object to write into files
+     * @param enabled  Whether a snapshot is taken. A disabled transaction
+     *                 does nothing
+     */
+    explicit Transaction(const utils::command::IExecutor& executor,
+                         const utils::file::IWriter& writer,
+                         bool enabled = true);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~Transaction() override;
+
+    /** Class copy constructor */
+    Transaction(const Transaction&) = delete;
+
+    /** Class copy-assignment operator */
+    Transaction& operator=(const Transaction&) = delete;
+
+    /** Class move constructor */
+    Transaction(Transaction&&) = delete;
+
+    /** Class move-assignment operator */
+    Transaction& operator=(Transaction&&) = delete;
+
+    /**
+     * @brief Take a snapshot of the state "configData" is about to change
+     *
+     * @param configData The configuration that is going to be applied
+     */
+    void begin(const config::ConfigData& configData) const override;
+
+    /** @brief Forget the snapshot */
+    void commit() const override;
+
+    /** @brief Restore the state saved by @ref begin() */
+    void rollback() const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,702 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <grp.h>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <poll.h>
+#include <pwd.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "utils/file/temporary/TemporaryFile.h"
+#include "utils/helper/Errno.h"
+
+#include "ControlServer.h"
+
+using namespace service;
+using namespace service::plugins::logger;
+using namespace utils::file;
+using namespace utils::helper;
+
+namespace {
+
+/* Longest request accepted, inline configurations included */
+constexpr std::size_t MAX_REQUEST_SIZE = 1U << 20U;
+
+/* Amount of bytes read from a client at once */
+constexpr std::size_t READ_SIZE = 4096;
+
+using ClientId = std::uint64_t;
+
+struct Client {
+    int fd = -1;
+    std::string input;
+    std::string output;
+    std::size_t nbRequests = 0;
+};
+
+/* A configuration waiting to be applied, given by path or inline */
+struct Submission {
+    ClientId client = 0;
+    std::size_t request = 0;
+    std::string configFile;
+    std::optional<std::string> content;
+};
+
+/* A response computed by the worker, to deliver to its client */
+struct Reply {
+    ClientId client = 0;
+    std::string line;
+};
+
+struct Metrics {
+    std::uint64_t requests     = 0;
+    std::uint64_t applied      = 0;
+    std::uint64_t failed       = 0;
+    std::uint64_t superseded   = 0;
+    std::uint64_t lastApplyUs  = 0;
+    std::uint64_t totalApplyUs = 0;
+};
+
+/* Size of the buffers of getgrnam_r() and getpwuid_r() when not given */
+constexpr std::size_t ENTRY_BUFFER_SIZE = 16384;
+
+std::vector<char> entryBuffer(int name)
+{
+    const long size = sysconf(name);
+    return std::vector<char>(size > 0 ? static_cast<std::size_t>(size)
+                                      : ENTRY_BUFFER_SIZE);
+}
+
+gid_t findGroup(const std::string& name)
+{
+    std::vector<char> buffer = entryBuffer(_SC_GETGR_R_SIZE_MAX);
+    struct group entry {};
+    struct group* found = nullptr;
+
+    const int error
+        = getgrnam_r(name.c_str(), &entry, buffer.data(), buffer.size(), &found);
+    if (error != 0) {
+        throw std::runtime_error(Errno::toString("getgrnam_r(" + name + ")", error));
+    }
+    if (found == nullptr) {
+        throw std::invalid_argument("ControlServer: Unknown group: " + name);
+    }
+
+    return entry.gr_gid;
+}
+
+/* Whether a user belongs to a group, as its primary group or not */
+bool isMember(uid_t user, gid_t primaryGroup, gid_t group)
+{
+    if (primaryGroup == group) {
+        return true;
+    }
+
+    std::vector<char> buffer = entryBuffer(_SC_GETPW_R_SIZE_MAX);
+    struct passwd entry {};
+    struct passwd* found = nullptr;
+    if ((getpwuid_r(user, &entry, buffer.data(), buffer.size(), &found) != 0)
+        || (found == nullptr)) {
+        return false;
+    }
+
+    int nbGroups = 0;
+    (void)getgrouplist(entry.pw_name, primaryGroup, nullptr, &nbGroups);
+    std::vector<gid_t> groups(static_cast<std::size_t>(nbGroups));
+    if (getgrouplist(entry.pw_name, primaryGroup, groups.data(), &nbGroups) == -1) {
+        return false;
+    }
+
+    return std::find(groups.begin(), groups.end(), group) != groups.end();
+}
+
+/* Whether a server accepts connections on that address. A socket nobody
+ * listens on anymore refuses them */
+bool isAnswering(const sockaddr_un& address)
+{
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd == -1) {
+        throw std::runtime_error(Errno::toString("socket()", errno));
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const int status = connect(fd, reinterpret_cast<const sockaddr*>(&address),
+                               sizeof(address));
+    const int error  = errno;
+    (void)close(fd);
+
+    if (status == 0) {
+        return true;
+    }
+    if (error == ECONNREFUSED) {
+        return false;
+    }
+
+    throw std::runtime_error(Errno::toString(
+        "connect(" + std::string(address.sun_path) + ")", error));
+}
+
+}
+
+struct ControlServer::Internal {
+    const ILogger& logger;
+    const Apply apply;
+    const Report report;
+    const std::string socketPath;
+    const std::optional<gid_t> socketGroup;
+
+    int listenFd = -1;
+    bool isBound = false;
+    std::array<int, 2> wakePipe {-1, -1};
+    std::atomic<bool> stopRequested {false};
+
+    /* Shared with the worker thread */
+    std::mutex mutex;
+    std::condition_variable workerCondition;
+    std::optional<Submission> pending;
+    std::vector<Reply> replies;
+    Metrics metrics;
+    const char* lastResult = "none";
+    std::string lastReport = "none";
+    bool isApplying        = false;
+    bool isStopping        = false;
+
+    Internal(const ILogger& providedLogger,
+             Apply providedApply,
+             std::string providedSocketPath,
+             const std::string& providedSocketGroup,
+             Report providedReport)
+        : logger(providedLogger),
+          apply(std::move(providedApply)),
+          report(std::move(providedReport)),
+          socketPath(std::move(providedSocketPath)),
+          socketGroup(providedSocketGroup.empty()
+                          ? std::nullopt
+                          : std::optional<gid_t>(findGroup(providedSocketGroup)))
+    {}
+
+    ~Internal()
+    {
+        for (int fd : {listenFd, wakePipe[0], wakePipe[1]}) {
+            if (fd != -1) {
+                (void)close(fd);
+            }
+        }
+
+        if (isBound) {
+            (void)unlink(socketPath.c_str());
+        }
+    }
+
+    Internal(const Internal&) = delete;
+    Internal& operator=(const Internal&) = delete;
+    Internal(Internal&&)                 = delete;
+    Internal& operator=(Internal&&) = delete;
+
+    void listen()
+    {
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("ControlServer: Socket path too long: "
+                                        + socketPath);
+        }
+        std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+        if (pipe2(wakePipe.data(), O_NONBLOCK | O_CLOEXEC) == -1) {
+            throw std::runtime_error(Errno::toString("pipe2()", errno));
+        }
+
+        listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd == -1) {
+            throw std::runtime_error(Errno::toString("socket()", errno));
+        }
+
+        // A socket left behind by a previous instance would make bind() fail
+        // but the one of an instance still running must be left alone
+        struct stat status {};
+        if ((lstat(socketPath.c_str(), &status) == 0) && S_ISSOCK(status.st_mode)) {
+            if (isAnswering(address)) {
+                throw std::runtime_error(
+                    "ControlServer: Another instance is listening on " + socketPath);
+            }
+            (void)unlink(socketPath.c_str());
+        }
+
+        // Created with no permission for the others so that nobody else can
+        // connect before the group, if any, is given access
+        const mode_t previousMask = umask(S_IXUSR | S_IRWXG | S_IRWXO);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const int bound = bind(listenFd, reinterpret_cast<sockaddr*>(&address),
+                               sizeof(address));
+        const int error = errno;
+        (void)umask(previousMask);
+        if (bound == -1) {
+            throw std::runtime_error(
+                Errno::toString("bind(" + socketPath + ")", error));
+        }
+        isBound = true;
+
+        if (socketGroup) {
+            if (chown(socketPath.c_str(), static_cast<uid_t>(-1), *socketGroup)
+                == -1) {
+                throw std::runtime_error(
+                    Errno::toString("chown(" + socketPath + ")", errno));
+            }
+            if (chmod(socketPath.c_str(), S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP)
+                == -1) {
+                throw std::runtime_error(
+                    Errno::toString("chmod(" + socketPath + ")", errno));
+            }
+        }
+
+        if (::listen(listenFd, SOMAXCONN) == -1) {
+            throw std::runtime_error(Errno::toString("listen()", errno));
+        }
+    }
+
+    /* Only async-signal-safe functions are used here */
+    void wake() const
+    {
+        const char byte = 0;
+        (void)write(wakePipe[1], &byte, sizeof(byte));
+    }
+
+    /* Apply the submissions one at a time, the latest one first */
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;) {
+            workerCondition.wait(lock, [this]() { return isStopping || pending; });
+            if (isStopping) {
+                return;
+            }
+
+            const Submission submission = std::move(*pending);
+            pending.reset();
+            isApplying = true;
+            lock.unlock();
+
+            const auto start   = std::chrono::steady_clock::now();
+            const int status   = applySubmission(submission);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            std::string applyReport = lastApplyReport();
+
+            lock.lock();
+            isApplying = false;
+            lastReport = std::move(applyReport);
+            if (status == EXIT_SUCCESS) {
+                lastResult = "ok";
+                ++metrics.applied;
+            }
+            else {
+                lastResult = "failed";
+                ++metrics.failed;
+            }
+            metrics.lastApplyUs = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                    .count());
+            metrics.totalApplyUs += metrics.lastApplyUs;
+            replies.push_back({submission.client,
+                               std::to_string(submission.request) + " "
+                                   + lastResult});
+            wake();
+        }
+    }
+
+    /* The report of the apply that just ended, on a single line */
+    [[nodiscard]] std::string lastApplyReport() const
+    {
+        std::string text;
+        try {
+            text = report ? report() : std::string();
+        }
+        catch (const std::exception& e) {
+            logger.error(e.what());
+        }
+
+        std::string line;
+        std::istringstream stream(text);
+        for (std::string change; std::getline(stream, change);) {
+            const std::size_t start = change.find_first_not_of(' ');
+            if (start != std::string::npos) {
+                line += (line.empty() ? "" : " | ") + change.substr(start);
+            }
+        }
+
+        if (line.empty()) {
+            return "none";
+        }
+
+        logger.info(text);
+        return line;
+    }
+
+    [[nodiscard]] int applySubmission(const Submission& submission) const
+    {
+        try {
+            if (!submission.content) {
+                return apply(submission.configFile);
+            }
+
+            // The config plugin reads configurations from files
+            const TemporaryFile configFile;
+            {
+                std::ofstream stream(configFile.pathname());
+                stream << *submission.content;
+                if (!stream.flush()) {
+                    throw std::runtime_error("ControlServer: Failed to write "
+                                             + configFile.pathname());
+                }
+            }
+            return apply(configFile.pathname());
+        }
+        catch (const std::exception& e) {
+            logger.error(e.what());
+            return EXIT_FAILURE;
+        }
+    }
+
+    void serve()
+    {
+        std::map<ClientId, Client> clients;
+        ClientId nextClientId = 0;
+        std::vector<pollfd> pollFds;
+        std::vector<ClientId> pollClients;
+
+        while (!stopRequested) {
+            pollFds.assign({{listenFd, POLLIN, 0}, {wakePipe[0], POLLIN, 0}});
+            pollClients.clear();
+            for (const auto& [clientId, client] : clients) {
+                const int events = client.output.empty() ? POLLIN : POLLIN | POLLOUT;
+                pollFds.push_back({client.fd, static_cast<short>(events), 0});
+                pollClients.push_back(clientId);
+            }
+
+            if (poll(pollFds.data(), pollFds.size(), -1) == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::runtime_error(Errno::toString("poll()", errno));
+            }
+
+            if ((pollFds[1].revents & POLLIN) != 0) {
+                deliverReplies(clients);
+            }
+
+            if ((pollFds[0].revents & POLLIN) != 0) {
+                acceptClients(clients, nextClientId);
+            }
+
+            for (std::size_t index = 0; index < pollClients.size(); ++index) {
+                const short revents = pollFds[index + 2].revents;
+                if ((revents & (POLLIN | POLLHUP | POLLERR)) != 0) {
+                    receive(clients, pollClients[index]);
+                }
+            }
+
+            // Responses are sent as soon as possible, the rest when writable
+            for (auto it = clients.begin(); it != clients.end();) {
+                it = (it->second.fd == -1) || !send(it->second)
+                         ? disconnect(clients, it)
+                         : std::next(it);
+            }
+        }
+
+        for (auto it = clients.begin(); it != clients.end();) {
+            it = disconnect(clients, it);
+        }
+    }
+
+    void deliverReplies(std::map<ClientId, Client>& clients)
+    {
+        std::array<char, 64> bytes {};
+        while (read(wakePipe[0], bytes.data(), bytes.size()) > 0) {
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const Reply& reply : replies) {
+            const auto client = clients.find(reply.client);
+            if (client != clients.end()) {
+                client->second.output += reply.line + "\n";
+            }
+        }
+        replies.clear();
+    }
+
+    void acceptClients(std::map<ClientId, Client>& clients, ClientId& nextClientId)
+    {
+        for (;;) {
+            const int fd = accept4(listenFd, nullptr, nullptr,
+                                   SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd == -1) {
+                if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                    logger.warn(Errno::toString("accept4()", errno));
+                }
+                return;
+            }
+
+            if (!isAllowed(fd)) {
+                (void)close(fd);
+                continue;
+            }
+
+            clients[nextClientId++].fd = fd;
+        }
+    }
+
+    /* Only the user of the service, root and the members of the group of
+     * the socket may submit configurations */
+    [[nodiscard]] bool isAllowed(int fd) const
+    {
+        ucred credentials {};
+        socklen_t size = sizeof(credentials);
+        if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) == -1) {
+            logger.warn(Errno::toString("getsockopt(SO_PEERCRED)", errno));
+            return false;
+        }
+
+        if ((credentials.uid == 0) || (credentials.uid == geteuid())
+            || (socketGroup
+                && isMember(credentials.uid, credentials.gid, *socketGroup))) {
+            return true;
+        }
+
+        logger.warn("ControlServer: Connection of uid "
+                    + std::to_string(credentials.uid) + " refused");
+        return false;
+    }
+
+    /* Read what is available and handle each complete line. The client is
+     * disconnected (fd set to -1) on end of file, error or overlong line */
+    void receive(std::map<ClientId, Client>& clients, ClientId clientId)
+    {
+        Client& client = clients.at(clientId);
+        std::array<char, READ_SIZE> bytes {};
+
+        for (;;) {
+            const ssize_t size = read(client.fd, bytes.data(), bytes.size());
+            if (size > 0) {
+                client.input.append(bytes.data(), static_cast<std::size_t>(size));
+                continue;
+            }
+            if ((size == -1) && (errno == EINTR)) {
+                continue;
+            }
+            if ((size == 0)
+                || ((size == -1) && (errno != EAGAIN) && (errno != EWOULDBLOCK))) {
+                closeClient(client);
+            }
+            break;
+        }
+
+        std::size_t start = 0;
+        for (std::size_t end = client.input.find('\n'); end != std::string::npos;
+             end              = client.input.find('\n', start)) {
+            std::string line = client.input.substr(start, end - start);
+            if (!line.empty() && (line.back() == '\r')) {
+                line.pop_back();
+            }
+            handle(clients, clientId, line);
+            start = end + 1;
+        }
+        client.input.erase(0, start);
+
+        if (client.input.size() > MAX_REQUEST_SIZE) {
+            logger.warn("ControlServer: Request too long, client disconnected");
+            closeClient(client);
+        }
+    }
+
+    void handle(std::map<ClientId, Client>& clients,
+                ClientId clientId,
+                const std::string& line)
+    {
+        Client& client            = clients.at(clientId);
+        const std::size_t request = ++client.nbRequests;
+        const std::string prefix  = std::to_string(request) + " ";
+
+        const std::size_t space    = line.find(' ');
+        const std::string verb     = line.substr(0, space);
+        const std::string argument = (space != std::string::npos)
+                                         ? line.substr(space + 1)
+                                         : std::string();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        ++metrics.requests;
+
+        if (((verb == "apply") || (verb == "apply-json")) && !argument.empty()) {
+            Submission submission {clientId, request, {}, {}};
+            if (verb == "apply") {
+                submission.configFile = argument;
+            }
+            else {
+                submission.content = argument;
+            }
+
+            // Only the latest configuration matters
+            if (pending) {
+                const auto superseded = clients.find(pending->client);
+                if (superseded != clients.end()) {
+                    superseded->second.output
+                        += std::to_string(pending->request) + " superseded\n";
+                }
+                ++metrics.superseded;
+            }
+            pending = std::move(submission);
+            workerCondition.notify_one();
+        }
+        else if (line == "status") {
+            client.output += prefix + "status state="
+                             + (isApplying ? "applying" : "idle")
+                             + " pending=" + (pending ? "1" : "0")
+                             + " last=" + lastResult + "\n";
+        }
+        else if (line == "report") {
+            client.output += prefix + "report " + lastReport + "\n";
+        }
+        else if (line == "metrics") {
+            client.output += prefix + "metrics requests="
+                             + std::to_string(metrics.requests)
+                             + " applied=" + std::to_string(metrics.applied)
+                             + " failed=" + std::to_string(metrics.failed)
+                             + " superseded=" + std::to_string(metrics.superseded)
+                             + " apply_us_last="
+                             + std::to_string(metrics.lastApplyUs)
+                             + " apply_us_total="
+                             + std::to_string(metrics.totalApplyUs) + "\n";
+        }
+        else {
+            client.output += prefix + "error invalid request\n";
+        }
+    }
+
+    /* Return false if the client has to be disconnected */
+    static bool send(Client& client)
+    {
+        while (!client.output.empty()) {
+            const ssize_t size = ::send(client.fd,
+                                        client.output.data(),
+                                        client.output.size(),
+                                        MSG_NOSIGNAL);
+            if (size == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+            }
+            client.output.erase(0, static_cast<std::size_t>(size));
+        }
+
+        return true;
+    }
+
+    static void closeClient(Client& client)
+    {
+        if (client.fd != -1) {
+            (void)close(client.fd);
+            client.fd = -1;
+        }
+    }
+
+    static std::map<ClientId, Client>::iterator
+        disconnect(std::map<ClientId, Client>& clients,
+                   std::map<ClientId, Client>::iterator client)
+    {
+        closeClient(client->second);
+        return clients.erase(client);
+    }
+
+    void stopWorker(std::thread& worker)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            isStopping = true;
+        }
+        workerCondition.notify_one();
+        worker.join();
+    }
+};
+
+ControlServer::ControlServer(const ILogger& logger,
+                             Apply apply,
+                             const std::string& socketPath,
+                             const std::string& socketGroup,
+                             Report report)
+    : m_internal(std::make_unique<Internal>(
+        logger, std::move(apply), socketPath, socketGroup, std::move(report)))
+{
+    m_internal->listen();
+}
+
+ControlServer::~ControlServer() = default;
+
+void ControlServer::run() const
+{
+    m_internal->logger.info("Listening on " + m_internal->socketPath);
+
+    std::thread worker([this]() { m_internal->work(); });
+
+    try {
+        m_internal->serve();
+    }
+    catch (...) {
+        m_internal->stopWorker(worker);
+        throw;
+    }
+
+    m_internal->stopWorker(worker);
+}
+
+void ControlServer::stop() const
+{
+    m_internal->stopRequested = true;
+    m_internal->wake();
+}
@@ -0,0 +1,150 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __SERVICE_CONTROLSERVER_H__
+#define __SERVICE_CONTROLSERVER_H__
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "service/plugins/ILogger.h"
+
+namespace service {
+
+/**
+ * @class ControlServer ControlServer.h "service/ControlServer.h"
+ * @ingroup Core
+ *
+ * @brief Keep the service resident and apply the configurations submitted
+ *        through a Unix domain socket
+ *
+ * Clients connect to the socket and send requests, one per line. Each
+ * response is a single line starting with the number of the request it
+ * answers on that connection (1 for the first one) so that a client can
+ * send several requests without waiting for their responses:
+ *
+ * - "apply <path>": apply the configuration file at that path
+ * - "apply-json <json>": apply the configuration given inline, on one line
+ * - "status": "<n> status state=<idle|applying> pending=<0|1> last=<...>"
+ * - "metrics": "<n> metrics requests=... applied=... failed=... ..."
+ * - "report": "<n> report <...>", what the last apply did (E.g: the rules
+ *   rewritten by the optimizer) on one line, its lines separated by " | "
+ *
+ * An "apply" is answered by "<n> ok", "<n> failed" or "<n> superseded".
+ * Configurations are applied one at a time by a worker thread while the
+ * socket keeps being served. A submitted configuration describes the whole
+ * expected state so, when several are received while one is being applied,
+ * only the latest one is applied next and the others are superseded.
+ *
+ * The socket is only accessible to the user of the service (mode 0600) or
+ * also to a given group (mode 0660). The credentials of each client are
+ * checked as well: connections from other users are closed at once.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class ControlServer {
+
+public:
+    /** Apply a configuration file and return EXIT_SUCCESS or EXIT_FAILURE */
+    using Apply = std::function<int(const std::string& configFile)>;
+
+    /** Describe what the last apply did, one change per line. Empty if none */
+    using Report = std::function<std::string()>;
+
+    /**
+     * Class constructor
+     *
+     * @param logger     An object to use the logger plugin
+     * @param apply      The function that applies submitted configurations
+     * @param socketPath  Where to create the socket. A socket left behind
+     *                    at this path is replaced unless an instance still
+     *                    answers on it
+     * @param socketGroup The group whose members may use the socket too.
+     *                    Empty for the user of the service only
+     * @param report      The function called after each apply to get its
+     *                    report. Empty if there is nothing to report
+     *
+     * @throw std::invalid_argument if the path is too long or the group
+     *        doesn't exist
+     * @throw std::runtime_error if the socket can't be created or another
+     *        instance is listening on it
+     */
+    ControlServer(const plugins::logger::ILogger& logger,
+                  Apply apply,
+                  const std::string& socketPath,
+                  const std::string& socketGroup = "",
+                  Report report                  = nullptr);
+
+    /** Class destructor. The socket is removed from the filesystem */
+    ~ControlServer();
+
+    /** Class copy constructor */
+    ControlServer(const ControlServer&) = delete;
+
+    /** Class copy-assignment operator */
+    ControlServer& operator=(const ControlServer&) = delete;
+
+    /** Class move constructor */
+    ControlServer(ControlServer&&) = delete;
+
+    /** Class move-assignment operator */
+    ControlServer& operator=(ControlServer&&) = delete;
+
+    /**
+     * @brief Serve clients until @ref stop is called
+     *
+     * The configuration being applied when stopping is completed first.
+     *
+     * @throw std::runtime_error if waiting for clients fails
+     */
+    void run() const;
+
+    /**
+     * @brief Make @ref run return
+     *
+     * It is async-signal-safe so that it can be called from a handler of
+     * SIGINT or SIGTERM.
+     */
+    void stop() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -26,62 +26,460 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 
+#include "utils/command/parser/Parser.h"
+#include "utils/concurrency/FiberScheduler.h"
+#include "utils/concurrency/Pipeline.h"
+#include "utils/concurrency/WorkStealingPool.h"
+#include "utils/helper/Arena.h"
+
 #include "NetworkService.h"
 
 using namespace service;
 using namespace service::plugins::config;
 using namespace service::plugins::firewall;
+using namespace service::plugins::profiler;
+using namespace utils::command;
+using namespace utils::concurrency;
+using namespace utils::helper;
+
+using NetworkServiceParams = NetworkService::NetworkServiceParams;
+
+namespace {
+
+/* Make sure a phase is stopped even when it is left through an exception */
+class Phase {
+
+public:
+    Phase(const IProfiler& profiler, const char* name)
+        : m_profiler(profiler),
+          m_name(name)
+    {
+        m_profiler.startPhase(m_name);
+    }
+
+    ~Phase() { m_profiler.stopPhase(m_name); }
+
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+    Phase(Phase&&)                 = delete;
+    Phase& operator=(Phase&&) = delete;
+
+private:
+    const IProfiler& m_profiler;
+    const std::string m_name;
+};
+
+void checkInterfaces(const NetworkServiceParams& params,
+                     const ConfigData::Network& networkData)
+{
+    params.logger.debug("Make sure specified interfaces are valid");
+    for (const std::string& interfaceName : networkData.interfaceNames) {
+        params.logger.debug([&interfaceName]() {
+            return "Check validity of interface: " + interfaceName;
+        });
+        if (!params.network.hasInterface(interfaceName)) {
+            throw std::invalid_argument(
+                "NetworkService: No valid interface found for: " + interfaceName);
+        }
+    }
+}
+
+std::unique_ptr<IRule> createRule(const NetworkServiceParams& params,
+                                  const ConfigData::Rule& ruleData)
+{
+    std::unique_ptr<IRule> rule
+        = params.ruleFactory.createRule(ruleData.name,
+                                        ruleData.commands,
+                                        ruleData.sets);
+
+    if (!rule) {
+        throw std::runtime_error(
+            "NetworkService: createRule() returned an invalid object");
+    }
+
+    return rule;
+}
+
+/* Rules are created while planning so that applying them does not allocate */
+std::vector<std::unique_ptr<IRule>> createRules(const NetworkServiceParams& params,
+                                                const ConfigData& configData)
+{
+    params.logger.debug("Create rules");
+
+    std::vector<std::unique_ptr<IRule>> rules;
+    rules.reserve(configData.rules.size());
+    for (const ConfigData::Rule& ruleData : configData.rules) {
+        rules.push_back(createRule(params, ruleData));
+    }
+
+    return rules;
+}
+
+/* Size of an arena into which all executed commands can be parsed */
+std::size_t commandsFootprint(const ConfigData& configData)
+{
+    std::size_t footprint = 0;
+    for (const std::string& command : configData.network.interfaceCommands) {
+        footprint += Parser::footprint(command);
+    }
+
+    for (const ConfigData::Rule& ruleData : configData.rules) {
+        for (const std::string& command : ruleData.commands) {
+            footprint += Parser::footprint(command);
+        }
+    }
+
+    return footprint;
+}
+
+/* Rules store their commands as interned tokens so the strings loaded from
+ * the configuration are not needed anymore once all rules are created */
+void releaseCommands(ConfigData& configData)
+{
+    for (ConfigData::Rule& ruleData : configData.rules) {
+        std::vector<std::string>().swap(ruleData.commands);
+    }
+}
+
+/* Configure the network then the firewall of the current namespace. Commands
+ * are parsed into an arena released at once when leaving */
+void applyToCurrentNamespace(const NetworkServiceParams& params,
+                             const ConfigData& configData,
+                             const std::vector<std::unique_ptr<IRule>>& rules,
+                             std::size_t arenaSize)
+{
+    const ConfigData::Network& networkData = configData.network;
+
+    const Arena arena(arenaSize);
+    const Arena::Scope scope(arena);
+
+    {
+        Phase phase(params.profiler, "checkInterfaces");
+        checkInterfaces(params, networkData);
+    }
+
+    {
+        Phase phase(params.profiler, "applyLayerCommands");
+
+        params.logger.debug("Apply network layer commands");
+        params.network.applyLayerCommands(networkData.layerCommands);
+    }
+
+    {
+        Phase phase(params.profiler, "applyInterfaceCommands");
+
+        params.logger.debug("Apply network interface commands");
+        params.network.applyInterfaceCommands(networkData.interfaceCommands);
+    }
+
+    {
+        Phase phase(params.profiler, "applyRules");
+
+        params.logger.debug("Apply rules");
+        for (const std::unique_ptr<IRule>& rule : rules) {
+            rule->applyCommands();
+        }
+    }
+
+    {
+        Phase phase(params.profiler, "reorder");
+
+        params.logger.debug("Reorder rules by packet counters");
+        params.reorderer.reorder();
+    }
+}
+
+/* Configure the network of the current namespace before any rule */
+void applyNetwork(const NetworkServiceParams& params,
+                  const ConfigData::Network& networkData)
+{
+    checkInterfaces(params, networkData);
+
+    params.logger.debug("Apply network layer commands");
+    params.network.applyLayerCommands(networkData.layerCommands);
+
+    params.logger.debug("Apply network interface commands");
+    params.network.applyInterfaceCommands(networkData.interfaceCommands);
+}
+
+/* Everything that has to be done again in each network namespace. Rules are
+ * created once beforehand because they don't depend on the namespace */
+void applyToNamespace(const NetworkServiceParams& params,
+                      const std::string& namespacePath,
+                      const ConfigData::Network& networkData,
+                      const std::vector<std::unique_ptr<IRule>>& rules,
+                      std::size_t arenaSize)
+{
+    params.logger.debug(
+        [&namespacePath]() { return "Join network namespace: " + namespacePath; });
+    params.network.joinNamespace(namespacePath);
+
+    // The current arena is per thread: namespaces sharing a thread as fibers
+    // would use each other's one so they parse commands on the heap. They
+    // also join the namespace again each time they are resumed
+    std::optional<Arena> arena;
+    std::optional<Arena::Scope> scope;
+    if (FiberScheduler::isInFiber()) {
+        FiberScheduler::onResume([&params, &namespacePath]() {
+            params.network.joinNamespace(namespacePath);
+        });
+    }
+    else {
+        arena.emplace(arenaSize);
+        scope.emplace(*arena);
+    }
+
+    applyNetwork(params, networkData);
+
+    params.logger.debug("Apply rules");
+    for (const std::unique_ptr<IRule>& rule : rules) {
+        rule->applyCommands();
+    }
+}
+
+/* Load the config once and configure each namespace from a worker thread,
+ * several at once per worker when they are run as fibers */
+int applyToNamespaces(const NetworkServiceParams& params,
+                      const std::string& configFile,
+                      const std::vector<std::string>& namespacePaths,
+                      std::size_t nbJobs,
+                      bool asFibers)
+{
+    std::atomic<bool> hasFailed(false);
+
+    try {
+        std::unique_ptr<ConfigData> configData;
+        {
+            Phase phase(params.profiler, "load");
+
+            params.logger.debug(
+                [&configFile]() { return "Load config: " + configFile; });
+            configData = params.config.load(configFile);
+        }
+
+        {
+            Phase phase(params.profiler, "optimize");
+
+            params.logger.debug("Optimize rules");
+            params.optimizer.optimize(*configData);
+        }
+
+        std::vector<std::unique_ptr<IRule>> rules;
+        std::size_t arenaSize = 0;
+        {
+            Phase phase(params.profiler, "createRules");
+
+            rules     = createRules(params, *configData);
+            arenaSize = commandsFootprint(*configData);
+            releaseCommands(*configData);
+        }
+
+        {
+            Phase phase(params.profiler, "applyNamespaces");
+
+            std::vector<WorkStealingPool::Task> tasks;
+            tasks.reserve(namespacePaths.size());
+            for (const std::string& namespacePath : namespacePaths) {
+                tasks.emplace_back(
+                    [&params, &namespacePath, &configData, &rules, arenaSize,
+                     &hasFailed]() {
+                        try {
+                            applyToNamespace(params,
+                                             namespacePath,
+                                             configData->network,
+                                             rules,
+                                             arenaSize);
+                        }
+                        catch (const std::exception& e) {
+                            // A failure in one namespace must not prevent the
+                            // others from being configured
+                            params.logger.error(namespacePath + ": " + e.what());
+                            hasFailed = true;
+                        }
+                    });
+            }
+
+            params.logger.debug([&namespacePaths]() {
+                return "Apply config to " + std::to_string(namespacePaths.size())
+                       + " network namespace(s)";
+            });
+            const WorkStealingPool pool(nbJobs);
+            if (!asFibers) {
+                pool.run(std::move(tasks));
+            }
+            else {
+                const std::size_t nbWorkers
+                    = std::min(pool.nbWorkers(), tasks.size());
+
+                std::vector<std::vector<FiberScheduler::Task>> groups(nbWorkers);
+                for (std::size_t index = 0; index < tasks.size(); ++index) {
+                    groups[index % nbWorkers].push_back(std::move(tasks[index]));
+                }
+
+                std::vector<WorkStealingPool::Task> workers;
+                workers.reserve(nbWorkers);
+                for (std::vector<FiberScheduler::Task>& group : groups) {
+                    workers.emplace_back([group = std::move(group)]() mutable {
+                        FiberScheduler().run(std::move(group));
+                    });
+                }
+                pool.run(std::move(workers));
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        params.logger.error(e.what());
+        return EXIT_FAILURE;
+    }
+
+    return hasFailed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+}
 
 NetworkService::NetworkService(const NetworkServiceParams& params) : m_params(params)
 {}
 
 int NetworkService::applyConfig(const std::string& configFile) const
 {
+    return apply(configFile).succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+NetworkService::Result NetworkService::apply(const std::string& configFile) const
+{
+    std::unique_ptr<ConfigData> configData;
+
     try {
-        m_params.logger.debug("Load config: " + configFile);
-        const std::unique_ptr<ConfigData>& configData
-            = m_params.config.load(configFile);
-
-        m_params.logger.debug("Make sure specified interfaces are valid");
-        const ConfigData::Network& networkData         = configData->network;
-        const std::vector<ConfigData::Rule>& rulesData = configData->rules;
-
-        for (const std::string& interfaceName : networkData.interfaceNames) {
-            m_params.logger.debug("Check validity of interface: " + interfaceName);
-            if (!m_params.network.hasInterface(interfaceName)) {
-                throw std::invalid_argument(
-                    "NetworkService: No valid interface found for: "
-                    + interfaceName);
-            }
+        Phase phase(m_params.profiler, "load");
+
+        m_params.logger.debug(
+            [&configFile]() { return "Load config: " + configFile; });
+        configData = m_params.config.load(configFile);
+    }
+    catch (const std::exception& e) {
+        m_params.logger.error(e.what());
+        return {false, e.what()};
+    }
+
+    return apply(std::move(*configData));
+}
+
+NetworkService::Result NetworkService::apply(ConfigData configData) const
+{
+    Result result;
+
+    try {
+        {
+            Phase phase(m_params.profiler, "optimize");
+
+            m_params.logger.debug("Optimize rules");
+            m_params.optimizer.optimize(configData);
         }
 
-        m_params.logger.debug("Apply network layer commands");
-        m_params.network.applyLayerCommands(networkData.layerCommands);
+        std::vector<std::unique_ptr<IRule>> rules;
+        std::size_t arenaSize = 0;
+        {
+            Phase phase(m_params.profiler, "createRules");
 
-        m_params.logger.debug("Apply network interface commands");
-        m_params.network.applyInterfaceCommands(networkData.interfaceCommands);
+            rules     = createRules(m_params, configData);
+            arenaSize = commandsFootprint(configData);
+            m_params.reorderer.prepare(configData);
+        }
 
-        m_params.logger.debug("Create and apply rules");
-        for (const ConfigData::Rule& ruleData : rulesData) {
-            const std::unique_ptr<IRule>& rule
-                = m_params.ruleFactory.createRule(ruleData.name, ruleData.commands);
+        {
+            Phase phase(m_params.profiler, "snapshot");
 
-            if (!rule) {
-                throw std::runtime_error(
-                    "NetworkService: createRule() returned an invalid object");
-            }
+            // The programs used by the commands tell what to save
+            m_params.logger.debug("Save the state to restore on failure");
+            m_params.transaction.begin(configData);
+            releaseCommands(configData);
+        }
 
-            rule->applyCommands();
+        try {
+            applyToCurrentNamespace(m_params, configData, rules, arenaSize);
         }
+        catch (const std::exception& e) {
+            m_params.logger.error(e.what());
+            result.error = e.what();
+
+            Phase phase(m_params.profiler, "rollback");
+
+            m_params.logger.debug("Restore the state saved before applying");
+            m_params.transaction.rollback();
+            result.rolledBack = true;
+            return result;
+        }
+
+        m_params.transaction.commit();
+        result.nbRules = rules.size();
     }
     catch (const std::exception& e) {
         // All exceptions are caught because the service is expected to ignore
         // how lower -level components are implemented (which specific exception
-        // is raised, ...)
+        // is raised, ...). The first error is the one that explains the failure
+        m_params.logger.error(e.what());
+        if (result.error.empty()) {
+            result.error = e.what();
+        }
+        return result;
+    }
+
+    result.succeeded = true;
+    return result;
+}
+
+int NetworkService::applyConfig(const std::string& configFile,
+                                const std::vector<std::string>& namespacePaths,
+                                std::size_t nbJobs) const
+{
+    return applyToNamespaces(m_params, configFile, namespacePaths, nbJobs, false);
+}
+
+int NetworkService::applyConfigAsync(const std::string& configFile,
+                                     const std::vector<std::string>& namespacePaths,
+                                     std::size_t nbJobs) const
+{
+    return applyToNamespaces(m_params, configFile, namespacePaths, nbJobs, true);
+}
+
+int NetworkService::applyConfigPipelined(const std::string& configFile,
+                                         std::size_t queueSize) const
+{
+    try {
+        Phase phase(m_params.profiler, "pipeline");
+
+        m_params.logger.debug(
+            [&configFile]() { return "Stream config: " + configFile; });
+
+        // The loader thread only reads: commands are all run by this thread
+        Pipeline(queueSize).run([this, &configFile](const Pipeline::Submit& submit) {
+            m_params.config.stream(
+                configFile,
+                [this, &submit](ConfigData::Network networkData) {
+                    submit([this, networkData = std::move(networkData)]() {
+                        applyNetwork(m_params, networkData);
+                        m_params.logger.debug("Apply rules");
+                    });
+                },
+                [this, &submit](ConfigData::Rule ruleData) {
+                    // Each rule is destroyed once applied, before the next
+                    // one is created. Its commands, and the command table
+                    // of the rule factory with them, are therefore released
+                    // so that memory does not grow with the number of rules
+                    submit([this, ruleData = std::move(ruleData)]() {
+                        createRule(m_params, ruleData)->applyCommands();
+                    });
+                });
+        });
+    }
+    catch (const std::exception& e) {
         m_params.logger.error(e.what());
         return EXIT_FAILURE;
     }
@@ -29,10 +29,15 @@
 #ifndef __SERVICE_NETWORKSERVICE_H__
 #define __SERVICE_NETWORKSERVICE_H__
 
+#include "service/Export.h"
 #include "service/plugins/IConfig.h"
 #include "service/plugins/ILogger.h"
 #include "service/plugins/INetwork.h"
+#include "service/plugins/IOptimizer.h"
+#include "service/plugins/IProfiler.h"
+#include "service/plugins/IReorderer.h"
 #include "service/plugins/IRuleFactory.h"
+#include "service/plugins/ITransaction.h"
 
 namespace service {
 
@@ -116,7 +121,7 @@ namespace service {
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class NetworkService {
+class NETWORKSERVICE_EXPORT NetworkService {
 
 public:
     /**
@@ -141,6 +146,38 @@ public:
 
         /** An object to use the firewall plugin */
         const plugins::firewall::IRuleFactory& ruleFactory;
+
+        /** An object to use the profiler plugin */
+        const plugins::profiler::IProfiler& profiler;
+
+        /** An object to use the transaction plugin */
+        const plugins::transaction::ITransaction& transaction;
+
+        /** An object to use the optimizer plugin */
+        const plugins::optimizer::IOptimizer& optimizer;
+
+        /** An object to use the reorderer plugin */
+        const plugins::reorderer::IReorderer& reorderer;
+    };
+
+    /**
+     * @struct Result
+     *
+     * @brief What happened when applying a configuration
+     */
+    struct Result {
+        /** Whether the whole configuration has been applied */
+        bool succeeded = false;
+
+        /** Why applying has failed. Empty on success */
+        std::string error {};
+
+        /** Whether the transaction plugin has been asked to restore the state
+         *  saved before applying */
+        bool rolledBack = false;
+
+        /** Number of rules applied, once optimized */
+        std::size_t nbRules = 0;
     };
 
     /**
@@ -160,10 +197,117 @@ public:
      *                   reader (E.g. database name, tables name, etc. in case
      *                   the config is retrieved from a database)
      *
+     * A snapshot of the state the configuration changes is taken before
+     * applying it. Once rules are applied, they are reordered by the number
+     * of packets they match. If any of this fails, that state is restored so
+     * that the host is not left half-configured.
+     *
      * @return EXIT_SUCCESS on success, EXIT_FAILURE on failure
      */
     [[nodiscard]] int applyConfig(const std::string& configFile) const;
 
+    /**
+     * @brief Apply the network configuration given in provided file and
+     *        tell what happened
+     *
+     * Same as @ref applyConfig for programs that embed the service.
+     *
+     * @param configFile See @ref applyConfig
+     *
+     * @return See @ref Result
+     */
+    [[nodiscard]] Result apply(const std::string& configFile) const;
+
+    /**
+     * @brief Apply a network configuration built in memory and tell what
+     *        happened
+     *
+     * Same as @ref applyConfig without loading the configuration from a
+     * file.
+     *
+     * @param configData The configuration to apply. It is taken by value
+     *                   because the optimizer rewrites its rules
+     *
+     * @return See @ref Result
+     */
+    [[nodiscard]] Result apply(plugins::config::ConfigData configData) const;
+
+    /**
+     * @brief Apply the network configuration given in provided file to
+     *        several network namespaces in parallel
+     *
+     * The configuration is loaded and the rules are created only once. Then,
+     * each namespace is joined by a worker thread which checks interfaces,
+     * applies network commands and rules exactly like @ref applyConfig does
+     * for the current namespace. A failure in a namespace is logged and does
+     * not prevent the other namespaces from being configured. Failed
+     * namespaces are not rolled back.
+     *
+     * @param configFile     See @ref applyConfig
+     * @param namespacePaths Paths to the network namespace files (E.g:
+     *                       /var/run/netns/<name> or /proc/<pid>/ns/net)
+     * @param nbJobs         The maximum number of namespaces configured at
+     *                       the same time. 0 means as many as the number of
+     *                       concurrent threads supported by the host
+     *
+     * @return EXIT_SUCCESS if all namespaces have been configured,
+     *         EXIT_FAILURE otherwise
+     */
+    [[nodiscard]] int applyConfig(const std::string& configFile,
+                                  const std::vector<std::string>& namespacePaths,
+                                  std::size_t nbJobs = 0) const;
+
+    /**
+     * @brief Same as the namespaces version of @ref applyConfig with many
+     *        namespaces configured concurrently by each worker thread
+     *
+     * Namespaces are spread over the worker threads. Each worker configures
+     * all its namespaces at once using a FiberScheduler: while a namespace
+     * waits for a command to exit (pidfd), the worker goes on with the
+     * other namespaces instead of blocking. So, up to one command per
+     * namespace is in flight whatever the number of workers. Commands of a
+     * namespace are still executed one after the other, in order.
+     *
+     * Commands are not parsed into an arena in this mode and perf counters
+     * are not collected per command since a thread is shared by several
+     * namespaces.
+     *
+     * @param configFile     See @ref applyConfig
+     * @param namespacePaths See @ref applyConfig
+     * @param nbJobs         The number of worker threads. 0 means as many as
+     *                       the number of concurrent threads supported by
+     *                       the host
+     *
+     * @return EXIT_SUCCESS if all namespaces have been configured,
+     *         EXIT_FAILURE otherwise
+     */
+    [[nodiscard]] int
+        applyConfigAsync(const std::string& configFile,
+                         const std::vector<std::string>& namespacePaths,
+                         std::size_t nbJobs = 0) const;
+
+    /**
+     * @brief Apply the network configuration given in provided file while
+     *        it is still being read
+     *
+     * A loader thread streams the configuration and queues the network
+     * section then each rule as soon as they have been read. They are
+     * applied in that order by the calling thread meanwhile. The loader is
+     * paused while the queue is full so neither the time before the first
+     * command runs nor the memory used grows with the number of rules.
+     *
+     * As rules are never all known at once, they are neither optimized nor
+     * reordered and no snapshot is taken: a failure stops the loader and
+     * leaves the rules applied so far in place.
+     *
+     * @param configFile See @ref applyConfig
+     * @param queueSize  The maximum number of rules read but not applied yet
+     *
+     * @return EXIT_SUCCESS on success, EXIT_FAILURE on failure
+     */
+    [[nodiscard]] int applyConfigPipelined(const std::string& configFile,
+                                           std::size_t queueSize) const;
+
 private:
     const NetworkServiceParams& m_params;
 };
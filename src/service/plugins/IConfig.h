@@ -29,8 +29,11 @@
 #ifndef __SERVICE_PLUGINS_ICONFIG_H__
 #define __SERVICE_PLUGINS_ICONFIG_H__
 
+#include <functional>
 #include <memory>
 
+#include "service/Export.h"
+
 #include "IConfigData.h"
 
 namespace service::plugins::config {
@@ -63,9 +66,15 @@ namespace service::plugins::config {
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class IConfig {
+class NETWORKSERVICE_EXPORT IConfig {
 
 public:
+    /** Receive the network section of a streamed configuration */
+    using NetworkHandler = std::function<void(ConfigData::Network)>;
+
+    /** Receive a rule of a streamed configuration */
+    using RuleHandler = std::function<void(ConfigData::Rule)>;
+
     /** Class constructor */
     IConfig() = default;
 
@@ -97,6 +106,27 @@ public:
      */
     [[nodiscard]] virtual std::unique_ptr<ConfigData>
         load(const std::string& configFile) const = 0;
+
+    /**
+     * @brief Read the provided configuration file and hand each part of it
+     *        over as soon as it has been read
+     *
+     * Unlike @ref load, the whole configuration is never held in memory:
+     * the network section is given first, then the rules one by one in the
+     * order of the file. Handlers are called on the calling thread and can
+     * block it to slow the reading down. The data given are the ones
+     * @ref load would have returned.
+     *
+     * @param configFile Configuration file to read
+     * @param onNetwork  Called once with the network section, before any rule
+     * @param onRule     Called with each rule
+     *
+     * @throw An exception if the file is invalid, if its rules come before
+     *        its network section or if a handler has raised one
+     */
+    virtual void stream(const std::string& configFile,
+                        const NetworkHandler& onNetwork,
+                        const RuleHandler& onRule) const = 0;
 };
 
 }
@@ -89,12 +89,43 @@ struct ConfigData {
      * @brief A data structure containing firewall-related data
      */
     struct Rule {
+        /**
+         * @struct AddressSet
+         *
+         * @brief An ipset or nft set filled from an external file of
+         *        addresses
+         *
+         * The file contains one IPv4/IPv6 address or network per line.
+         * Blank lines and text after '#' are ignored. It is streamed into
+         * the set when the rule is applied so that lists of millions of
+         * addresses neither end up in memory nor as one command each.
+         */
+        struct AddressSet {
+            /** Name of the set the commands refer to (E.g: "blocklist") */
+            std::string name;
+
+            /** Absolute path to the file of addresses */
+            std::string file;
+
+            /** Address family of the set: "inet" or "inet6" */
+            std::string family = "inet";
+
+            /** Program loading the set: "ipset" or "nft" */
+            std::string backend = "ipset";
+
+            /** nft only: family and name of the table owning the set */
+            std::string table = "inet filter";
+        };
+
         /** The name of the rule; just for the readability of the config and
          * logs */
         std::string name;
 
         /** The list of rule commands (E.g: "/sbin/iptables -P INPUT DROP") */
         std::vector<std::string> commands;
+
+        /** The sets to load before the commands are applied */
+        std::vector<AddressSet> sets {};
     };
 
     /** Member variable containing network data */
@@ -30,6 +30,10 @@
 #define __SERVICE_PLUGINS_ILOGGER_H__
 
 #include <string>
+#include <type_traits>
+#include <utility>
+
+#include "service/Export.h"
 
 namespace service::plugins::logger {
 
@@ -63,14 +67,41 @@ namespace service::plugins::logger {
  * thus have possibility to alter the logger object which is not what is
  * expected.
  *
+ * @note
+ * Building a message (concatenations, conversions, ...) has a cost even when
+ * the message is not printed. To avoid it, each log function also accepts a
+ * callable returning the message; it is only invoked if the level is enabled
+ * and, for debug-level logs, is compiled out in release builds (NDEBUG):
+ * @code
+ * logger.debug([&interfaceName]() { return "Check interface: " + interfaceName; });
+ * @endcode
+ *
  * @see https://en.cppreference.com/w/cpp/language/rule_of_three
  *
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class ILogger {
+class NETWORKSERVICE_EXPORT ILogger {
+
+    /* Only callables returning something convertible to a string are
+     * treated as message builders */
+    template<typename Builder>
+    using EnableIfBuilder = std::enable_if_t<
+        std::is_convertible_v<std::invoke_result_t<Builder>, std::string>>;
 
 public:
+    /**
+     * @enum Level
+     *
+     * @brief Log levels sorted by increasing severity
+     */
+    enum class Level : unsigned int {
+        DEBUG, /**< @ref debug() */
+        INFO,  /**< @ref info() */
+        WARN,  /**< @ref warn() */
+        ERROR  /**< @ref error() */
+    };
+
     /** Class constructor */
     ILogger() = default;
 
@@ -174,6 +205,88 @@ public:
      *       version.
      */
     virtual void error(const std::string& message) const = 0;
+
+    /**
+     * @brief Tell whether logs of a given level are printed
+     *
+     * @param level The level to check
+     *
+     * @return true if logs of that level are printed, false otherwise
+     */
+    [[nodiscard]] virtual bool isEnabled(Level level) const = 0;
+
+    /**
+     * @brief Print debug-level logs without building the message when
+     *        debug-level logs are disabled or compiled out (NDEBUG)
+     *
+     * @param buildMessage A callable returning the log message to print
+     */
+    template<typename Builder, typename = EnableIfBuilder<Builder>>
+    void debug([[maybe_unused]] Builder&& buildMessage) const
+    {
+#ifndef NDEBUG
+        if (isEnabled(Level::DEBUG)) {
+            debug(std::string(std::forward<Builder>(buildMessage)()));
+        }
+#endif
+    }
+
+    /**
+     * @brief Print a constant debug-level log without creating a string
+     *        when debug-level logs are disabled or compiled out (NDEBUG)
+     *
+     * @param message The log message to print
+     */
+    void debug([[maybe_unused]] const char* message) const
+    {
+#ifndef NDEBUG
+        if (isEnabled(Level::DEBUG)) {
+            debug(std::string(message));
+        }
+#endif
+    }
+
+    /**
+     * @brief Print info-level logs without building the message when
+     *        info-level logs are disabled
+     *
+     * @param buildMessage A callable returning the log message to print
+     */
+    template<typename Builder, typename = EnableIfBuilder<Builder>>
+    void info(Builder&& buildMessage) const
+    {
+        if (isEnabled(Level::INFO)) {
+            info(std::string(std::forward<Builder>(buildMessage)()));
+        }
+    }
+
+    /**
+     * @brief Print warning-level logs without building the message when
+     *        warning-level logs are disabled
+     *
+     * @param buildMessage A callable returning the log message to print
+     */
+    template<typename Builder, typename = EnableIfBuilder<Builder>>
+    void warn(Builder&& buildMessage) const
+    {
+        if (isEnabled(Level::WARN)) {
+            warn(std::string(std::forward<Builder>(buildMessage)()));
+        }
+    }
+
+    /**
+     * @brief Print error-level logs without building the message when
+     *        error-level logs are disabled
+     *
+     * @param buildMessage A callable returning the log message to print
+     */
+    template<typename Builder, typename = EnableIfBuilder<Builder>>
+    void error(Builder&& buildMessage) const
+    {
+        if (isEnabled(Level::ERROR)) {
+            error(std::string(std::forward<Builder>(buildMessage)()));
+        }
+    }
 };
 
 }
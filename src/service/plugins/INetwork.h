@@ -32,6 +32,8 @@
 #include <string>
 #include <vector>
 
+#include "service/Export.h"
+
 #include "IConfigData.h"
 
 namespace service::plugins::network {
@@ -59,7 +61,7 @@ namespace service::plugins::network {
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class INetwork {
+class NETWORKSERVICE_EXPORT INetwork {
 
 public:
     /** Class constructor */
@@ -118,6 +120,19 @@ public:
         const std::vector<
             service::plugins::config::ConfigData::Network::LayerCommand>&
             layerCommands) const = 0;
+
+    /**
+     * @brief Move the calling thread into the network namespace referred to
+     *        by "namespacePath" so that all subsequent network operations it
+     *        does (including the ones done by the processes it creates) are
+     *        applied to that namespace.
+     *
+     * @param namespacePath Path to a network namespace file (E.g:
+     *                      /var/run/netns/<name> or /proc/<pid>/ns/net)
+     *
+     * @throw std::runtime_error if the namespace can't be joined
+     */
+    virtual void joinNamespace(const std::string& namespacePath) const = 0;
 };
 
 }
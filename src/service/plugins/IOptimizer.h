@@ -0,0 +1,92 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __SERVICE_PLUGINS_IOPTIMIZER_H__
+#define __SERVICE_PLUGINS_IOPTIMIZER_H__
+
+#include "service/Export.h"
+
+#include "IConfigData.h"
+
+namespace service::plugins::optimizer {
+
+/**
+ * @interface IOptimizer IOptimizer.h "service/plugins/IOptimizer.h"
+ * @ingroup Abstraction
+ *
+ * @brief Rewrite a loaded configuration into an equivalent but cheaper one
+ *
+ * This class is the high level interface that must be implemented by
+ * optimizer plugin. The core service depends on it and not on its
+ * implementation(s) to respect the Dependency Inversion Principle. Once the
+ * configuration is loaded, the core service gives the optimizer a chance to
+ * rewrite it (fewer firewall rules, fewer commands to spawn, ...) before
+ * anything is applied. The result must have the same effect on the host.
+ *
+ * @note
+ * Copy contructor, copy-assignment operator, move constructor and move
+ * assignment operator are defined to be compliant with the "Rule of five".
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NETWORKSERVICE_EXPORT IOptimizer {
+
+public:
+    /** Class constructor */
+    IOptimizer() = default;
+
+    /** Class destructor made virtual because it is used as base class by
+     *  derived classes in optimizer plugin */
+    virtual ~IOptimizer() = default;
+
+    /** Class copy constructor */
+    IOptimizer(const IOptimizer&) = delete;
+
+    /** Class copy-assignment operator */
+    IOptimizer& operator=(const IOptimizer&) = delete;
+
+    /** Class move constructor */
+    IOptimizer(IOptimizer&&) = delete;
+
+    /** Class move-assignment operator */
+    IOptimizer& operator=(IOptimizer&&) = delete;
+
+    /**
+     * @brief Rewrite the configuration in place
+     *
+     * @param configData The configuration to optimize
+     */
+    virtual void optimize(config::ConfigData& configData) const = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,101 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __SERVICE_PLUGINS_IPROFILER_H__
+#define __SERVICE_PLUGINS_IPROFILER_H__
+
+#include <string>
+
+#include "service/Export.h"
+
+namespace service::plugins::profiler {
+
+/**
+ * @interface IProfiler IProfiler.h "service/plugins/IProfiler.h"
+ * @ingroup Abstraction
+ *
+ * @brief Measure what each phase of the service costs
+ *
+ * This class is the high level interface that must be implemented by profiler
+ * plugin. The core service depends on it and not on its implementation(s) to
+ * respect the Dependency Inversion Principle. The core service only tells when
+ * a phase (loading the configuration, applying rules, ...) starts and stops;
+ * what is measured (wall time, CPU cycles, page faults, ...) and where it is
+ * reported are left to the profiler plugin.
+ *
+ * @note
+ * Copy contructor, copy-assignment operator, move constructor and move
+ * assignment operator are defined to be compliant with the "Rule of five".
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NETWORKSERVICE_EXPORT IProfiler {
+
+public:
+    /** Class constructor */
+    IProfiler() = default;
+
+    /** Class destructor made virtual because it is used as base class by
+     *  derived classes in profiler plugin */
+    virtual ~IProfiler() = default;
+
+    /** Class copy constructor */
+    IProfiler(const IProfiler&) = delete;
+
+    /** Class copy-assignment operator */
+    IProfiler& operator=(const IProfiler&) = delete;
+
+    /** Class move constructor */
+    IProfiler(IProfiler&&) = delete;
+
+    /** Class move-assignment operator */
+    IProfiler& operator=(IProfiler&&) = delete;
+
+    /**
+     * @brief Start measuring a phase
+     *
+     * @param phaseName A name identifying the phase
+     *
+     * @note Phases are not expected to overlap
+     */
+    virtual void startPhase(const std::string& phaseName) const = 0;
+
+    /**
+     * @brief Stop measuring a phase previously started with startPhase()
+     *
+     * @param phaseName The name given to startPhase()
+     */
+    virtual void stopPhase(const std::string& phaseName) const = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __SERVICE_PLUGINS_IREORDERER_H__
+#define __SERVICE_PLUGINS_IREORDERER_H__
+
+#include "service/Export.h"
+
+#include "IConfigData.h"
+
+namespace service::plugins::reorderer {
+
+/**
+ * @interface IReorderer IReorderer.h "service/plugins/IReorderer.h"
+ * @ingroup Abstraction
+ *
+ * @brief Move the firewall rules that match the most packets first
+ *
+ * This class is the high level interface that must be implemented by
+ * reorderer plugin. The core service depends on it and not on its
+ * implementation(s) to respect the Dependency Inversion Principle. Once
+ * rules are applied, the core service gives the reorderer a chance to
+ * change the order of the rules in the kernel so that packets go through
+ * fewer of them. The firewall must behave exactly the same afterwards.
+ *
+ * @note
+ * Copy contructor, copy-assignment operator, move constructor and move
+ * assignment operator are defined to be compliant with the "Rule of five".
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NETWORKSERVICE_EXPORT IReorderer {
+
+public:
+    /** Class constructor */
+    IReorderer() = default;
+
+    /** Class destructor made virtual because it is used as base class by
+     *  derived classes in reorderer plugin */
+    virtual ~IReorderer() = default;
+
+    /** Class copy constructor */
+    IReorderer(const IReorderer&) = delete;
+
+    /** Class copy-assignment operator */
+    IReorderer& operator=(const IReorderer&) = delete;
+
+    /** Class move constructor */
+    IReorderer(IReorderer&&) = delete;
+
+    /** Class move-assignment operator */
+    IReorderer& operator=(IReorderer&&) = delete;
+
+    /**
+     * @brief Record the firewalls "configData" applies to
+     *
+     * Called before the rules are applied, while the commands of the rules
+     * are still in "configData": they are released afterwards.
+     *
+     * @param configData The configuration about to be applied
+     */
+    virtual void prepare(const config::ConfigData& configData) const = 0;
+
+    /** @brief Reorder the rules of the firewalls recorded by @ref prepare */
+    virtual void reorder() const = 0;
+};
+
+}
+
+#endif
@@ -32,6 +32,8 @@
 #include <string>
 #include <vector>
 
+#include "service/Export.h"
+
 namespace service::plugins::firewall {
 
 /**
@@ -54,7 +56,7 @@ namespace service::plugins::firewall {
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class IRule {
+class NETWORKSERVICE_EXPORT IRule {
 
 public:
     /** Class constructor */
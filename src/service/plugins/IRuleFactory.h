@@ -33,6 +33,9 @@
 #include <string>
 #include <vector>
 
+#include "service/Export.h"
+
+#include "IConfigData.h"
 #include "IRule.h"
 
 namespace service::plugins::firewall {
@@ -53,7 +56,7 @@ namespace service::plugins::firewall {
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
-class IRuleFactory {
+class NETWORKSERVICE_EXPORT IRuleFactory {
 
 public:
     /** Class constructor */
@@ -82,13 +85,18 @@ public:
      * configuration file.
      *
      * @param name     The name of the rule (For internal usage: logging, ...)
-     * @param commands The list of shell commands that compose the rule
+     * @param commands The list of shell commands that compose the rule. The
+     *                 rule must not refer to them: they are released once
+     *                 all rules are created
+     * @param sets     The sets of addresses the commands rely on
      *
      * @return The created rule
      */
     [[nodiscard]] virtual std::unique_ptr<IRule>
         createRule(const std::string& name,
-                   const std::vector<std::string>& commands) const = 0;
+                   const std::vector<std::string>& commands,
+                   const std::vector<config::ConfigData::Rule::AddressSet>& sets)
+            const = 0;
 };
 
 }
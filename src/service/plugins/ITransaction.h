@@ -0,0 +1,111 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __SERVICE_PLUGINS_ITRANSACTION_H__
+#define __SERVICE_PLUGINS_ITRANSACTION_H__
+
+#include "service/Export.h"
+
+#include "IConfigData.h"
+
+namespace service::plugins::transaction {
+
+/**
+ * @interface ITransaction ITransaction.h "service/plugins/ITransaction.h"
+ * @ingroup Abstraction
+ *
+ * @brief Make applying a configuration all-or-nothing
+ *
+ * This class is the high level interface that must be implemented by
+ * transaction plugin. The core service depends on it and not on its
+ * implementation(s) to respect the Dependency Inversion Principle. Before
+ * applying a configuration, the core service asks for a snapshot of the state
+ * this configuration is about to change. If applying it fails, the core
+ * service asks for that state to be restored so that the host is not left
+ * half-configured. How the state is saved and restored is left to the
+ * transaction plugin.
+ *
+ * @note
+ * Copy contructor, copy-assignment operator, move constructor and move
+ * assignment operator are defined to be compliant with the "Rule of five".
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class NETWORKSERVICE_EXPORT ITransaction {
+
+public:
+    /** Class constructor */
+    ITransaction() = default;
+
+    /** Class destructor made virtual because it is used as base class by
+     *  derived classes in transaction plugin */
+    virtual ~ITransaction() = default;
+
+    /** Class copy constructor */
+    ITransaction(const ITransaction&) = delete;
+
+    /** Class copy-assignment operator */
+    ITransaction& operator=(const ITransaction&) = delete;
+
+    /** Class move constructor */
+    ITransaction(ITransaction&&) = delete;
+
+    /** Class move-assignment operator */
+    ITransaction& operator=(ITransaction&&) = delete;
+
+    /**
+     * @brief Take a snapshot of the state "configData" is about to change
+     *
+     * @param configData The configuration that is going to be applied
+     *
+     * @throw std::runtime_error if the snapshot can't be taken. In that case,
+     *        the configuration must not be applied
+     */
+    virtual void begin(const config::ConfigData& configData) const = 0;
+
+    /**
+     * @brief Forget the snapshot once the configuration has been applied
+     */
+    virtual void commit() const = 0;
+
+    /**
+     * @brief Restore the state saved by @ref begin()
+     *
+     * All parts of the snapshot are restored even if some of them fail.
+     *
+     * @throw std::runtime_error if at least one part could not be restored
+     */
+    virtual void rollback() const = 0;
+};
+
+}
+
+#endif
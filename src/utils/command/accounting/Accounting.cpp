@@ -0,0 +1,136 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "Accounting.h"
+
+using namespace utils::command;
+using namespace utils::command::osal;
+using namespace utils::helper;
+
+struct Accounting::Internal {
+    std::mutex mutex;
+    std::map<std::string, Total> perLabel;
+    std::map<std::string, Total> perBinary;
+
+    static inline void add(Total& total,
+                           const IOsal::ResourceUsage& usage,
+                           const PerfCounters::Sample& counters)
+    {
+        ++total.nbPrograms;
+        total.counters += counters;
+
+        total.usage.userTimeUs += usage.userTimeUs;
+        total.usage.systemTimeUs += usage.systemTimeUs;
+        total.usage.maxResidentSetKb
+            = std::max(total.usage.maxResidentSetKb, usage.maxResidentSetKb);
+        total.usage.minorPageFaults += usage.minorPageFaults;
+        total.usage.majorPageFaults += usage.majorPageFaults;
+        total.usage.voluntaryContextSwitches += usage.voluntaryContextSwitches;
+        total.usage.involuntaryContextSwitches += usage.involuntaryContextSwitches;
+    }
+
+    static inline void print(std::ostringstream& stream,
+                             const std::string& title,
+                             const std::map<std::string, Total>& totals)
+    {
+        using Entry = std::pair<std::string, Total>;
+        std::vector<Entry> entries(totals.begin(), totals.end());
+
+        std::stable_sort(
+            entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+                return (a.second.usage.userTimeUs + a.second.usage.systemTimeUs)
+                       > (b.second.usage.userTimeUs + b.second.usage.systemTimeUs);
+            });
+
+        stream << title << ":\n";
+        for (const auto& [name, total] : entries) {
+            const IOsal::ResourceUsage& usage = total.usage;
+            stream << "  " << name << ": " << total.nbPrograms << " program(s)"
+                   << ", user " << usage.userTimeUs << " us"
+                   << ", system " << usage.systemTimeUs << " us"
+                   << ", max RSS " << usage.maxResidentSetKb << " KiB"
+                   << ", page faults " << usage.minorPageFaults << "/"
+                   << usage.majorPageFaults << " (minor/major)"
+                   << ", context switches " << usage.voluntaryContextSwitches
+                   << "/" << usage.involuntaryContextSwitches
+                   << " (voluntary/involuntary)\n";
+
+            if (total.counters.isAvailable()) {
+                stream << "    " << total.counters.toString() << "\n";
+            }
+        }
+    }
+};
+
+Accounting::Accounting() : m_internal(std::make_unique<Internal>()) {}
+
+Accounting::~Accounting() = default;
+
+void Accounting::record(const char* label,
+                        const char* pathname,
+                        const IOsal::ResourceUsage& usage,
+                        const PerfCounters::Sample& counters)
+{
+    std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    Internal::add(
+        m_internal->perLabel[label != nullptr ? label : "(none)"], usage, counters);
+    Internal::add(m_internal->perBinary[pathname != nullptr ? pathname : "(none)"],
+                  usage,
+                  counters);
+}
+
+std::map<std::string, Accounting::Total> Accounting::totalsPerLabel() const
+{
+    std::lock_guard<std::mutex> lock(m_internal->mutex);
+    return m_internal->perLabel;
+}
+
+std::map<std::string, Accounting::Total> Accounting::totalsPerBinary() const
+{
+    std::lock_guard<std::mutex> lock(m_internal->mutex);
+    return m_internal->perBinary;
+}
+
+std::string Accounting::toString() const
+{
+    std::lock_guard<std::mutex> lock(m_internal->mutex);
+
+    std::ostringstream stream;
+    if (!m_internal->perLabel.empty()) {
+        Internal::print(stream, "Resource usage per rule", m_internal->perLabel);
+        Internal::print(stream, "Resource usage per binary", m_internal->perBinary);
+    }
+
+    return stream.str();
+}
@@ -0,0 +1,141 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_ACCOUNTING_H__
+#define __UTILS_COMMAND_ACCOUNTING_H__
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "utils/command/executor/IOsal.h"
+#include "utils/helper/PerfCounters.h"
+
+namespace utils::command {
+
+/**
+ * @class Accounting Accounting.h "utils/command/accounting/Accounting.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to aggregate the resources consumed by the executed
+ *        programs so as to find out which commands dominate the run.
+ *
+ * Resources are aggregated per label (E.g: the name of the rule a command
+ * belongs to) and per binary. Recording is thread-safe.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Accounting {
+
+public:
+    /**
+     * @struct Total
+     *
+     * @brief Resources consumed by all programs of a same group
+     */
+    struct Total {
+        /** The number of programs that have been recorded */
+        std::size_t nbPrograms;
+
+        /** Sum of resources consumed by the programs except maxResidentSetKb
+         * which is the largest value seen */
+        osal::IOsal::ResourceUsage usage;
+
+        /** Sum of the events counted while the programs were running. Fields
+         *  are not available if at least one program was recorded without them */
+        helper::PerfCounters::Sample counters;
+    };
+
+    /** Class constructor */
+    Accounting();
+
+    /** Class destructor */
+    ~Accounting();
+
+    /** Class copy constructor */
+    Accounting(const Accounting&) = delete;
+
+    /** Class copy-assignment operator */
+    Accounting& operator=(const Accounting&) = delete;
+
+    /** Class move constructor */
+    Accounting(Accounting&&) = delete;
+
+    /** Class move-assignment operator */
+    Accounting& operator=(Accounting&&) = delete;
+
+    /**
+     * @brief Add the resources consumed by a program to the totals
+     *
+     * @param label    Name of the group the program belongs to or nullptr
+     * @param pathname The program that has been executed
+     * @param usage    The resources it consumed
+     * @param counters The events counted while it was running (optional)
+     */
+    void record(const char* label,
+                const char* pathname,
+                const osal::IOsal::ResourceUsage& usage,
+                const helper::PerfCounters::Sample& counters
+                = {helper::PerfCounters::NOT_AVAILABLE,
+                   helper::PerfCounters::NOT_AVAILABLE,
+                   helper::PerfCounters::NOT_AVAILABLE,
+                   helper::PerfCounters::NOT_AVAILABLE,
+                   helper::PerfCounters::NOT_AVAILABLE});
+
+    /** Totals per label. Programs recorded without label are grouped under
+     *  "(none)" */
+    [[nodiscard]] std::map<std::string, Total> totalsPerLabel() const;
+
+    /** Totals per binary */
+    [[nodiscard]] std::map<std::string, Total> totalsPerBinary() const;
+
+    /**
+     * @brief Generate a human-readable report of the totals
+     *
+     * Groups are sorted by decreasing CPU time (user + system) so that the
+     * most expensive ones come first.
+     *
+     * @return The report or an empty string if nothing has been recorded
+     */
+    [[nodiscard]] std::string toString() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
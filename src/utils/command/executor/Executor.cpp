@@ -26,51 +26,117 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <cerrno>
+
+#include "utils/concurrency/FiberScheduler.h"
+#include "utils/helper/PerfCounters.h"
+
 #include "Executor.h"
 
 using namespace utils::command;
 using namespace utils::command::osal;
+using namespace utils::concurrency;
+using namespace utils::helper;
 
 struct Executor::Internal {
     const IOsal& osal;
+    Accounting* const accounting;
+    FlightRecorder* const flightRecorder;
+
+    explicit Internal(const IOsal& providedOsal, const Recorders& recorders)
+        : osal(providedOsal),
+          accounting(recorders.accounting),
+          flightRecorder(recorders.flightRecorder)
+    {}
+
+    /* Counters only measure the calling thread (and the children it creates)
+     * so each thread that executes programs needs its own ones */
+    static inline const PerfCounters& spawnCounters()
+    {
+        thread_local const PerfCounters counters;
+        return counters;
+    }
+
+    /* Execute the program and tell in which process this function returns
+     * (in the child process, it only returns if execve() failed) */
+    IOsal::ProcessId execute(Flags flags, const ProgramParams& params) const
+    {
+        const bool accountUsage
+            = (accounting != nullptr) && ((flags & Flags::WAIT_COMMAND) != 0);
+
+        /* Count events caused by the spawn itself (fork, page tables, ...)
+         * and by the program since counters are inherited by the child. Not
+         * from a fiber: other ones would run on the thread while it waits */
+        const bool countEvents = accountUsage && !FiberScheduler::isInFiber();
+        if (countEvents) {
+            spawnCounters().start();
+        }
+
+        /* Create child process */
+        IOsal::ProcessId pid = osal.createProcess();
+
+        /* Reseed PRNG in both parent and the child */
+        if ((flags & Flags::RESEED_PRNG) != 0) {
+            osal.reseedPRNG();
+        }
+
+        /* Wait child process (if in parent process) */
+        if (pid == IOsal::ProcessId::PARENT) {
+            if ((flags & Flags::WAIT_COMMAND) != 0) {
+                const IOsal::ResourceUsage usage = osal.waitChildProcess();
+                if (countEvents) {
+                    accounting->record(params.label,
+                                       params.pathname,
+                                       usage,
+                                       spawnCounters().stop());
+                }
+                else if (accountUsage) {
+                    accounting->record(params.label, params.pathname, usage);
+                }
+            }
+            return pid;
+        }
 
-    explicit Internal(const IOsal& providedOsal) : osal(providedOsal) {}
+        /* In child process: Sanitize files */
+        if ((flags & Flags::SANITIZE_FILES) != 0) {
+            osal.sanitizeFiles();
+        }
+
+        /* In child process: Drop privileges */
+        if ((flags & Flags::DROP_PRIVILEGES) != 0) {
+            osal.dropPrivileges();
+        }
+
+        osal.executeProgram(params.pathname, params.argv, params.envp);
+        return pid;
+    }
 };
 
-Executor::Executor(const IOsal& osal, Flags flags)
+Executor::Executor(const IOsal& osal, Flags flags, const Recorders& recorders)
     : IExecutor(flags),
-      m_internal(std::make_unique<Internal>(osal))
+      m_internal(std::make_unique<Internal>(osal, recorders))
 {}
 
 Executor::~Executor() = default;
 
 void Executor::executeProgram(const ProgramParams& params) const
 {
-    /* Create child process */
-    IOsal::ProcessId pid = m_internal->osal.createProcess();
-
-    /* Reseed PRNG in both parent and the child */
-    if ((m_flags & Flags::RESEED_PRNG) != 0) {
-        m_internal->osal.reseedPRNG();
-    }
-
-    /* Wait child process (if in parent process) */
-    if (pid == IOsal::ProcessId::PARENT) {
-        if ((m_flags & Flags::WAIT_COMMAND) != 0) {
-            m_internal->osal.waitChildProcess();
-        }
+    FlightRecorder* const flightRecorder = m_internal->flightRecorder;
+    if (flightRecorder == nullptr) {
+        (void)m_internal->execute(m_flags, params);
         return;
     }
 
-    /* In child process: Sanitize files */
-    if ((m_flags & Flags::SANITIZE_FILES) != 0) {
-        m_internal->osal.sanitizeFiles();
+    flightRecorder->startCommand();
+    try {
+        if (m_internal->execute(m_flags, params) == IOsal::ProcessId::PARENT) {
+            flightRecorder->record(FlightRecorder::COMMAND_SUCCEEDED);
+        }
     }
-
-    /* In child process: Drop privileges */
-    if ((m_flags & Flags::DROP_PRIVILEGES) != 0) {
-        m_internal->osal.dropPrivileges();
+    catch (...) {
+        // Read before any other call can overwrite it
+        const int errnum = errno;
+        flightRecorder->record(FlightRecorder::COMMAND_FAILED, -1, 0, errnum);
+        throw;
     }
-
-    m_internal->osal.executeProgram(params.pathname, params.argv, params.envp);
 }
@@ -31,6 +31,9 @@
 
 #include <memory>
 
+#include "utils/command/accounting/Accounting.h"
+#include "utils/command/recorder/FlightRecorder.h"
+
 #include "IExecutor.h"
 #include "IOsal.h"
 
@@ -56,14 +59,35 @@ namespace utils::command {
 class Executor : public IExecutor {
 
 public:
+    /**
+     * @struct Recorders
+     *
+     * @brief Optional objects in which executed programs are recorded
+     */
+    struct Recorders {
+        /** Where to record the resources consumed by executed programs (only
+         *  when they are waited for) or nullptr. When set, hardware and
+         *  software events are also counted around each spawn (see
+         *  helper::PerfCounters) */
+        Accounting* accounting;
+
+        /** Where to record when each program starts, succeeds or fails or
+         *  nullptr */
+        FlightRecorder* flightRecorder;
+    };
+
     /**
      * Class constructor
      *
-     * @param osal   OS abstract layer's implementation to use. This is passed
-     *               to the constructor to ease unit testing of Executor class.
-     * @param flags  A set of masks of type @ref IExecutor::Flags
+     * @param osal      OS abstract layer's implementation to use. This is
+     *                  passed to the constructor to ease unit testing of
+     *                  Executor class.
+     * @param flags     A set of masks of type @ref IExecutor::Flags
+     * @param recorders A structure of type @ref Recorders
      */
-    explicit Executor(const osal::IOsal& osal, Flags flags = Flags::WAIT_COMMAND);
+    explicit Executor(const osal::IOsal& osal,
+                      Flags flags                = Flags::WAIT_COMMAND,
+                      const Recorders& recorders = {});
 
     /**
      * Class destructor
@@ -89,6 +89,10 @@ public:
         /** An array of strings of the form key=value, which are passed as
          * environment to the new program */
         char* const* const envp;
+
+        /** Name of the group (E.g: the rule) the program belongs to. It is
+         * only used to aggregate the resources consumed by the program */
+        const char* const label = nullptr;
     };
 
     /**
@@ -62,6 +62,23 @@ public:
         PARENT = (1u << 1u)  /**< In parent process */
     };
 
+    /**
+     * @struct ResourceUsage
+     *
+     * @brief Resources consumed by a child process until it terminated
+     *
+     * @see https://man7.org/linux/man-pages/man2/getrusage.2.html
+     */
+    struct ResourceUsage {
+        long userTimeUs;                 /**< CPU time spent in user mode */
+        long systemTimeUs;               /**< CPU time spent in kernel mode */
+        long maxResidentSetKb;           /**< Maximum resident set size */
+        long minorPageFaults;            /**< Page faults without I/O */
+        long majorPageFaults;            /**< Page faults requiring I/O */
+        long voluntaryContextSwitches;   /**< Waits for a resource */
+        long involuntaryContextSwitches; /**< Preemptions by the scheduler */
+    };
+
     /** Class constructor */
     IOsal() = default;
 
@@ -90,15 +107,18 @@ public:
     [[nodiscard]] virtual ProcessId createProcess() const = 0;
 
     /**
-     * @brief Wait for any child process whose process group ID is equal to
-     *        that of the calling process.
+     * @brief Wait for the last child process created by the calling thread
+     *        using createProcess().
      *
-     * It can basically be a wrapper of waitpid() call in linux with a pid
-     * equal to 0.
+     * It can basically be a wrapper of wait4() call in linux with the pid
+     * returned by fork(). Waiting for a specific child process allows
+     * several threads to execute programs at the same time.
      *
      * \note This method raises an exception when the child process failed
+     *
+     * @return The resources consumed by the child process
      */
-    virtual void waitChildProcess() const = 0;
+    [[nodiscard]] virtual ResourceUsage waitChildProcess() const = 0;
 
     /**
      * @brief Execute the program referred to by pathname
@@ -0,0 +1,329 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include "utils/concurrency/FiberScheduler.h"
+#include "utils/concurrency/MpmcQueue.h"
+#include "utils/helper/Errno.h"
+
+#include "PoolExecutor.h"
+
+using namespace utils::command;
+using namespace utils::concurrency;
+using namespace utils::helper;
+
+namespace {
+
+/* Network namespace of the calling thread, i.e. the one its children are
+ * created in */
+constexpr const char* THREAD_NAMESPACE = "/proc/thread-self/ns/net";
+
+/* A program to execute. It lives on the stack of the caller which waits
+ * until doneFd is readable before returning */
+struct Job {
+    const IExecutor::ProgramParams& params;
+    int namespaceFd;
+    int doneFd;
+    std::exception_ptr exception;
+};
+
+/* Namespaces are identified by the device and inode of their file */
+bool isSameFile(const struct stat& lhs, const struct stat& rhs)
+{
+    return (lhs.st_dev == rhs.st_dev) && (lhs.st_ino == rhs.st_ino);
+}
+
+void waitSemaphore(sem_t& semaphore)
+{
+    while (sem_wait(&semaphore) != 0) {
+        if (errno != EINTR) {
+            throw std::runtime_error(
+                Errno::toString("PoolExecutor: sem_wait()", errno));
+        }
+    }
+}
+
+/* Used when the caller can't be suspended anymore */
+void blockUntilReadable(int fd)
+{
+    struct pollfd pollFd {fd, POLLIN, 0};
+    while ((poll(&pollFd, 1, -1) == -1) && (errno == EINTR)) {
+    }
+}
+
+}
+
+struct PoolExecutor::Internal {
+    const IExecutor& executor;
+    MpmcQueue<Job*> queue;
+    std::vector<std::thread> workers;
+
+    /* The queue never blocks so free and used cells are also counted by
+     * semaphores on which callers and workers sleep */
+    sem_t freeCells {};
+    sem_t usedCells {};
+
+    /* Set once no job can be pushed anymore: workers leave when they are
+     * woken up and the queue is empty */
+    std::atomic<bool> isStopping {false};
+
+    explicit Internal(const IExecutor& providedExecutor, const Options& options)
+        : executor(providedExecutor), queue(options.queueCapacity)
+    {
+        const auto capacity = static_cast<unsigned int>(
+            std::min<std::size_t>(queue.capacity(), SEM_VALUE_MAX));
+        if (sem_init(&freeCells, 0, capacity) != 0) {
+            throw std::runtime_error(
+                Errno::toString("PoolExecutor: sem_init()", errno));
+        }
+        if (sem_init(&usedCells, 0, 0) != 0) {
+            const int errnum = errno;
+            sem_destroy(&freeCells);
+            throw std::runtime_error(
+                Errno::toString("PoolExecutor: sem_init()", errnum));
+        }
+
+        const std::size_t nbWorkers
+            = options.nbWorkers != 0
+                  ? options.nbWorkers
+                  : std::max(1u, std::thread::hardware_concurrency());
+        try {
+            workers.reserve(nbWorkers);
+            for (std::size_t index = 0; index < nbWorkers; ++index) {
+                workers.emplace_back([this]() { work(); });
+            }
+        }
+        catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    ~Internal() { stop(); }
+
+    Internal(const Internal&) = delete;
+    Internal& operator=(const Internal&) = delete;
+    Internal(Internal&&) = delete;
+    Internal& operator=(Internal&&) = delete;
+
+    /* Nothing here may throw, so no sentinel is queued since that could
+     * mean waiting for a free cell. Jobs already queued are still executed
+     * since workers only leave once the queue is empty */
+    void stop() noexcept
+    {
+        isStopping.store(true, std::memory_order_release);
+        for (std::size_t index = 0; index < workers.size(); ++index) {
+            (void)sem_post(&usedCells);
+        }
+
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        sem_destroy(&usedCells);
+        sem_destroy(&freeCells);
+    }
+
+    void pin(const std::vector<unsigned int>& cpus)
+    {
+        if (cpus.empty()) {
+            return;
+        }
+
+        for (std::size_t index = 0; index < workers.size(); ++index) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(cpus[index % cpus.size()], &cpuSet);
+
+            const int ret = pthread_setaffinity_np(workers[index].native_handle(),
+                                                   sizeof(cpuSet), &cpuSet);
+            if (ret != 0) {
+                throw std::runtime_error(
+                    Errno::toString("PoolExecutor: pthread_setaffinity_np() - CPU "
+                                        + std::to_string(cpus[index % cpus.size()]),
+                                    ret));
+            }
+        }
+    }
+
+    /* A failed attempt only means that another thread has claimed the cell
+     * but not published it yet since semaphores ensure there is one */
+    void push(Job* job)
+    {
+        waitSemaphore(freeCells);
+        while (!queue.tryPush(std::move(job))) {
+            std::this_thread::yield();
+        }
+        sem_post(&usedCells);
+    }
+
+    /* Return nullptr when the worker has to leave. sem_wait() can only
+     * fail on an invalid semaphore, which leaves nothing to wait for */
+    Job* pop() noexcept
+    {
+        Job* job = nullptr;
+
+        while (sem_wait(&usedCells) != 0) {
+            if (errno != EINTR) {
+                return nullptr;
+            }
+        }
+
+        while (!queue.tryPop(job)) {
+            if (isStopping.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            std::this_thread::yield();
+        }
+        sem_post(&freeCells);
+
+        return job;
+    }
+
+    void work()
+    {
+        struct stat currentNamespace {};
+        stat(THREAD_NAMESPACE, &currentNamespace);
+
+        while (Job* job = pop()) {
+            try {
+                joinNamespace(job->namespaceFd, currentNamespace);
+                executor.executeProgram(job->params);
+            }
+            catch (...) {
+                job->exception = std::current_exception();
+            }
+
+            // The job can't be used anymore once the caller is woken up
+            const std::uint64_t done = 1;
+            (void)write(job->doneFd, &done, sizeof(done));
+        }
+    }
+
+    static void joinNamespace(int namespaceFd, struct stat& currentNamespace)
+    {
+        struct stat callerNamespace {};
+        if (fstat(namespaceFd, &callerNamespace) != 0) {
+            throw std::runtime_error(
+                Errno::toString("PoolExecutor: fstat()", errno));
+        }
+
+        if (isSameFile(callerNamespace, currentNamespace)) {
+            return;
+        }
+
+        if (setns(namespaceFd, CLONE_NEWNET) != 0) {
+            throw std::runtime_error(
+                Errno::toString("PoolExecutor: setns()", errno));
+        }
+        currentNamespace = callerNamespace;
+    }
+};
+
+PoolExecutor::PoolExecutor(const IExecutor& executor, const Options& options)
+    : IExecutor(Flags::WAIT_COMMAND),
+      m_internal(std::make_unique<Internal>(executor, options))
+{
+    // Workers already started are stopped by ~Internal() if this fails
+    m_internal->pin(options.cpus);
+}
+
+PoolExecutor::~PoolExecutor() = default;
+
+std::size_t PoolExecutor::nbWorkers() const
+{
+    return m_internal->workers.size();
+}
+
+void PoolExecutor::executeProgram(const ProgramParams& params) const
+{
+    const int namespaceFd = open(THREAD_NAMESPACE, O_RDONLY | O_CLOEXEC);
+    if (namespaceFd == -1) {
+        throw std::runtime_error(
+            Errno::toString("PoolExecutor: open(" + std::string(THREAD_NAMESPACE)
+                                + ")",
+                            errno));
+    }
+
+    const int doneFd = eventfd(0, EFD_CLOEXEC);
+    if (doneFd == -1) {
+        const int errnum = errno;
+        close(namespaceFd);
+        throw std::runtime_error(
+            Errno::toString("PoolExecutor: eventfd()", errnum));
+    }
+
+    Job job {params, namespaceFd, doneFd, nullptr};
+    try {
+        m_internal->push(&job);
+    }
+    catch (...) {
+        close(doneFd);
+        close(namespaceFd);
+        throw;
+    }
+
+    std::exception_ptr resumeException;
+    try {
+        FiberScheduler::awaitReadable(doneFd);
+    }
+    catch (...) {
+        // The worker may still use the job which is on this stack
+        resumeException = std::current_exception();
+        blockUntilReadable(doneFd);
+    }
+
+    close(doneFd);
+    close(namespaceFd);
+
+    if (resumeException) {
+        std::rethrow_exception(resumeException);
+    }
+
+    if (job.exception) {
+        std::rethrow_exception(job.exception);
+    }
+}
@@ -0,0 +1,146 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_POOL_EXECUTOR_H__
+#define __UTILS_COMMAND_POOL_EXECUTOR_H__
+
+#include <memory>
+#include <vector>
+
+#include "IExecutor.h"
+
+namespace utils::command {
+
+/**
+ * @class PoolExecutor PoolExecutor.h "utils/command/executor/PoolExecutor.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to execute programs on a pool of worker threads.
+ *
+ * Programs to execute are queued in a bounded lock-free queue from which
+ * workers take them and pass them to another @ref IExecutor (E.g: an
+ * @ref Executor). As for any executor, executeProgram() only returns once
+ * the program has been executed, so the commands of a caller are still
+ * executed in order. Parallelism comes from several callers: threads or,
+ * better, tasks run by a FiberScheduler which are suspended while their
+ * program is being executed by a worker. Then, a single thread keeps all
+ * workers busy while forks, execs and waits happen on other CPUs.
+ *
+ * A worker joins the network namespace of the caller before executing its
+ * program since children are created in the namespace of the thread that
+ * forks them.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class PoolExecutor : public IExecutor {
+
+public:
+    /**
+     * @struct Options
+     *
+     * @brief Settings of the pool
+     */
+    struct Options {
+        /** The number of worker threads. 0 means as many as the number of
+         *  concurrent threads supported by the host */
+        std::size_t nbWorkers = 0;
+
+        /** CPUs the workers are pinned to, worker i on cpus[i % size]. Not
+         *  pinned when empty */
+        std::vector<unsigned int> cpus {};
+
+        /** The maximum number of programs waiting for a worker. Callers
+         *  block once it is reached */
+        std::size_t queueCapacity = 256;
+    };
+
+    /**
+     * Class constructor. Workers are started and pinned to their CPU
+     *
+     * @param executor The executor used by workers to execute programs. It
+     *                 must be usable from several threads at once
+     * @param options  A structure of type @ref Options
+     *
+     * @throw std::runtime_error if the semaphores of the queue can't be
+     *        initialized or a worker can't be pinned to its CPU
+     */
+    PoolExecutor(const IExecutor& executor, const Options& options);
+
+    /**
+     * Class destructor. Workers are stopped once the programs already
+     * queued have been executed
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~PoolExecutor() override;
+
+    /** Class copy constructor */
+    PoolExecutor(const PoolExecutor&) = delete;
+
+    /** Class copy-assignment operator */
+    PoolExecutor& operator=(const PoolExecutor&) = delete;
+
+    /** Class move constructor */
+    PoolExecutor(PoolExecutor&&) = delete;
+
+    /** Class move-assignment operator */
+    PoolExecutor& operator=(PoolExecutor&&) = delete;
+
+    /** The number of worker threads */
+    [[nodiscard]] std::size_t nbWorkers() const;
+
+    /**
+     * @brief Execute a program on a worker and wait until it is done
+     *
+     * From a task run by a FiberScheduler, the task is suspended meanwhile.
+     * Otherwise, the calling thread blocks.
+     *
+     * @param params An object of type @ref IExecutor::ProgramParams. It is
+     *               used by the worker so it must stay valid during the call,
+     *               which is the case of any argument
+     *
+     * @throw Rethrow any exception raised by the executor on the worker
+     */
+    void executeProgram(const ProgramParams& params) const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
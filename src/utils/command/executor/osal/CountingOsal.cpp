@@ -0,0 +1,174 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+
+#include "utils/helper/Errno.h"
+
+#include "CountingOsal.h"
+
+using namespace utils::command::osal;
+using namespace utils::helper;
+
+namespace {
+
+/* Atomics shared between processes must not rely on a (process-local) lock */
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Counters can't be shared with child processes");
+
+struct SharedCounters {
+    std::atomic<std::uint64_t> forks {0};
+    std::atomic<std::uint64_t> execs {0};
+    std::atomic<std::uint64_t> waits {0};
+    std::atomic<std::uint64_t> closes {0};
+};
+
+inline void increment(std::atomic<std::uint64_t>& counter)
+{
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline std::size_t load(const std::atomic<std::uint64_t>& counter)
+{
+    return static_cast<std::size_t>(counter.load(std::memory_order_relaxed));
+}
+
+}
+
+struct CountingOsal::Internal {
+    const IOsal& osal;
+    SharedCounters* shared;
+
+    explicit Internal(const IOsal& providedOsal) : osal(providedOsal)
+    {
+        void* mapping = mmap(nullptr,
+                             sizeof(SharedCounters),
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_ANONYMOUS,
+                             -1,
+                             0);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error(Errno::toString("CountingOsal: mmap()", errno));
+        }
+
+        shared = new (mapping) SharedCounters();
+    }
+
+    ~Internal()
+    {
+        shared->~SharedCounters();
+        (void)munmap(shared, sizeof(SharedCounters));
+    }
+
+    Internal(const Internal&) = delete;
+    Internal& operator=(const Internal&) = delete;
+    Internal(Internal&&)                 = delete;
+    Internal& operator=(Internal&&) = delete;
+};
+
+CountingOsal::Counters
+    CountingOsal::Counters::operator-(const Counters& start) const
+{
+    return {forks - start.forks,
+            execs - start.execs,
+            waits - start.waits,
+            closes - start.closes};
+}
+
+CountingOsal::Counters& CountingOsal::Counters::operator+=(const Counters& other)
+{
+    forks += other.forks;
+    execs += other.execs;
+    waits += other.waits;
+    closes += other.closes;
+
+    return *this;
+}
+
+CountingOsal::CountingOsal(const IOsal& osal)
+    : m_internal(std::make_unique<Internal>(osal))
+{}
+
+CountingOsal::~CountingOsal() = default;
+
+CountingOsal::Counters CountingOsal::counters() const
+{
+    const SharedCounters& shared = *m_internal->shared;
+
+    return {load(shared.forks), load(shared.execs), load(shared.waits),
+            load(shared.closes)};
+}
+
+IOsal::ProcessId CountingOsal::createProcess() const
+{
+    const ProcessId pid = m_internal->osal.createProcess();
+    if (pid == ProcessId::PARENT) {
+        increment(m_internal->shared->forks);
+    }
+
+    return pid;
+}
+
+IOsal::ResourceUsage CountingOsal::waitChildProcess() const
+{
+    increment(m_internal->shared->waits);
+
+    return m_internal->osal.waitChildProcess();
+}
+
+void CountingOsal::executeProgram(const char* pathname,
+                                  char* const argv[],
+                                  char* const envp[]) const
+{
+    // Count before the process image (if any) is replaced
+    increment(m_internal->shared->execs);
+
+    m_internal->osal.executeProgram(pathname, argv, envp);
+}
+
+void CountingOsal::reseedPRNG() const
+{
+    m_internal->osal.reseedPRNG();
+}
+
+void CountingOsal::sanitizeFiles() const
+{
+    increment(m_internal->shared->closes);
+
+    m_internal->osal.sanitizeFiles();
+}
+
+void CountingOsal::dropPrivileges() const
+{
+    m_internal->osal.dropPrivileges();
+}
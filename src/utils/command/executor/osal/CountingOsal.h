@@ -0,0 +1,139 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_EXECUTOR_COUNTING_OSAL_H__
+#define __UTILS_COMMAND_EXECUTOR_COUNTING_OSAL_H__
+
+#include <cstddef>
+#include <memory>
+
+#include "utils/command/executor/IOsal.h"
+
+namespace utils::command::osal {
+
+/**
+ * @class CountingOsal CountingOsal.h "utils/command/executor/osal/CountingOsal.h"
+ * @ingroup Helper
+ *
+ * @brief A decorator of @ref IOsal.h counting the process-related system calls
+ *        made through another implementation
+ *
+ * Execs and closes happen in the child process, between fork() and execve(),
+ * so counters are kept in a shared anonymous mapping that children inherit:
+ * what they count is seen by the parent.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class CountingOsal : public IOsal {
+
+public:
+    /**
+     * @struct Counters
+     *
+     * @brief Number of calls made so far of each kind
+     */
+    struct Counters {
+        std::size_t forks;  /**< Child processes created */
+        std::size_t execs;  /**< Programs executed by children */
+        std::size_t waits;  /**< Children waited for */
+        std::size_t closes; /**< Sweeps of the descriptors inherited by children */
+
+        /** Number of calls made between "start" and this snapshot */
+        Counters operator-(const Counters& start) const;
+
+        /** Accumulate the calls of another snapshot */
+        Counters& operator+=(const Counters& other);
+    };
+
+    /**
+     * Class constructor
+     *
+     * @param osal The implementation whose calls are counted
+     *
+     * @throw std::runtime_error if the shared mapping can't be created
+     */
+    explicit CountingOsal(const IOsal& osal);
+
+    /**
+     * Class destructor
+     *
+     * @note The override specifier aims at making the compiler warn if the
+     *       base class's destructor is not virtual.
+     */
+    ~CountingOsal() override;
+
+    /** Class copy constructor */
+    CountingOsal(const CountingOsal&) = delete;
+
+    /** Class copy-assignment operator */
+    CountingOsal& operator=(const CountingOsal&) = delete;
+
+    /** Class move constructor */
+    CountingOsal(CountingOsal&&) = delete;
+
+    /** Class move-assignment operator */
+    CountingOsal& operator=(CountingOsal&&) = delete;
+
+    /** Snapshot of the counters. Subtract two of them to count an interval */
+    [[nodiscard]] Counters counters() const;
+
+    /** Count a fork (in the parent only) then return what osal returns */
+    [[nodiscard]] ProcessId createProcess() const override;
+
+    /** Count a wait then wait for the child with osal */
+    [[nodiscard]] ResourceUsage waitChildProcess() const override;
+
+    /** Count an exec then execute the program with osal */
+    void executeProgram(const char* pathname,
+                        char* const argv[],
+                        char* const envp[]) const override;
+
+    /** Reseed with osal */
+    void reseedPRNG() const override;
+
+    /** Count a close then sanitize files with osal */
+    void sanitizeFiles() const override;
+
+    /** Drop privileges with osal */
+    void dropPrivileges() const override;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -30,20 +30,49 @@
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <exception>
 #include <grp.h>
+#include <stdexcept>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include "utils/concurrency/FiberScheduler.h"
 #include "utils/helper/Errno.h"
 
 #include "Linux.h"
 
 using namespace utils::command::osal;
+using namespace utils::concurrency;
 using namespace utils::helper;
 
+namespace {
+
+/* Child process created by each thread and not waited for yet. Programs can
+ * be executed from several threads at once so a thread must never reap the
+ * child of another one */
+thread_local pid_t tChildPid = 0;
+
+}
+
 struct Linux::Internal {
+    FlightRecorder* const flightRecorder;
+
+    explicit Internal(FlightRecorder* providedFlightRecorder)
+        : flightRecorder(providedFlightRecorder)
+    {}
+
+    inline void
+        record(FlightRecorder::EventType type, int pid, int status, int errnum)
+    {
+        if (flightRecorder != nullptr) {
+            flightRecorder->record(type, pid, status, errnum);
+        }
+    }
+
     /* Reopen the standard stream (stdin, stdout or stderr) and redirect it
      * to the the provided destination file */
     static inline bool redirectStandardStream(int fd, const char* const destPathname)
@@ -69,35 +98,111 @@ struct Linux::Internal {
 
         return ((file != nullptr) && (fileno(file) == fd));
     }
+
+    /* Let the other tasks of the scheduler run until the child has exited.
+     * Nothing is awaited when pidfds are not supported: wait4() then blocks
+     * the whole thread */
+    static inline void awaitExit(pid_t childPid)
+    {
+#if defined(SYS_pidfd_open)
+        const auto pidFd = static_cast<int>(syscall(SYS_pidfd_open, childPid, 0));
+        if (pidFd == -1) {
+            return;
+        }
+
+        try {
+            FiberScheduler::awaitReadable(pidFd);
+        }
+        catch (...) {
+            (void)close(pidFd);
+            throw;
+        }
+        (void)close(pidFd);
+#else
+        (void)childPid;
+#endif
+    }
+
+    /* Convert a timeval as filled in by wait4() to microseconds */
+    static inline long toMicroseconds(const struct timeval& time)
+    {
+        constexpr long usPerSecond = 1000000L;
+        return (time.tv_sec * usPerSecond) + time.tv_usec;
+    }
 };
 
-Linux::Linux() : m_internal(std::make_unique<Internal>()) {}
+Linux::Linux(FlightRecorder* flightRecorder)
+    : m_internal(std::make_unique<Internal>(flightRecorder))
+{}
 
 Linux::~Linux() = default;
 
 IOsal::ProcessId Linux::createProcess() const
 {
     pid_t childPid = fork();
+    if (childPid != 0) {
+        const int errnum = (childPid == -1) ? errno : 0;
+        m_internal->record(FlightRecorder::PROCESS_CREATED, childPid, 0, errnum);
+    }
+
     if (childPid == -1) {
         throw std::runtime_error(Errno::toString("fork()", errno));
     }
 
+    if (childPid != 0) {
+        tChildPid = childPid;
+    }
+
     return (childPid != 0 ? IOsal::ProcessId::PARENT : IOsal::ProcessId::CHILD);
 }
 
-void Linux::waitChildProcess() const
+IOsal::ResourceUsage Linux::waitChildProcess() const
 {
     pid_t pid;
-    int status;
+    int status = 0;
+    struct rusage usage {};
+
+    /* Other tasks may create children and execute commands meanwhile so the
+     * state of the calling thread is saved before suspending this one */
+    const pid_t childPid = tChildPid;
+    tChildPid            = 0;
+
+    std::exception_ptr resumeException;
+    if (FiberScheduler::isInFiber()) {
+        const std::uint32_t commandIndex = FlightRecorder::currentCommand();
+        try {
+            Internal::awaitExit(childPid);
+        }
+        catch (...) {
+            // The child is reaped anyway
+            resumeException = std::current_exception();
+        }
+        FlightRecorder::resumeCommand(commandIndex);
+    }
 
     do {
-        pid = waitpid(0, &status, 0);
+        pid = wait4(childPid, &status, 0, &usage);
     } while ((pid == -1) && (errno == EINTR));
 
+    const int errnum = (pid == -1) ? errno : 0;
+    m_internal->record(FlightRecorder::PROCESS_EXITED, pid, status, errnum);
+
+    if (resumeException) {
+        std::rethrow_exception(resumeException);
+    }
+
     if ((pid == -1) || (WIFEXITED(status) && (WEXITSTATUS(status) != 0))) {
-        throw std::runtime_error("Parent - waitpid() status: "
+        throw std::runtime_error("Parent - wait4() status: "
                                  + std::to_string(status));
     }
+
+    return {Internal::toMicroseconds(usage.ru_utime),
+            Internal::toMicroseconds(usage.ru_stime),
+            usage.ru_maxrss,
+            usage.ru_minflt,
+            usage.ru_majflt,
+            usage.ru_nvcsw,
+            usage.ru_nivcsw};
 }
 
 void Linux::executeProgram(const char* pathname,
@@ -32,6 +32,7 @@
 #include <memory>
 
 #include "utils/command/executor/IOsal.h"
+#include "utils/command/recorder/FlightRecorder.h"
 
 namespace utils::command::osal {
 
@@ -53,8 +54,13 @@ namespace utils::command::osal {
 class Linux : public IOsal {
 
 public:
-    /* Class constructor */
-    Linux();
+    /**
+     * Class constructor
+     *
+     * @param flightRecorder Where to record created and waited for child
+     *                       processes (pid, status, errno) or nullptr
+     */
+    explicit Linux(FlightRecorder* flightRecorder = nullptr);
 
     /**
      * Class destructor
@@ -85,10 +91,13 @@ public:
     [[nodiscard]] ProcessId createProcess() const override;
 
     /**
-     * @brief Wait for any child process whose process group ID is equal to
-     *        that of the calling process.
+     * @brief Wait for the last child process created by the calling thread
+     *        or, if there is none, for any child process whose process group
+     *        ID is equal to that of the calling process.
+     *
+     * @return The resources consumed by the child process
      */
-    void waitChildProcess() const override;
+    [[nodiscard]] ResourceUsage waitChildProcess() const override;
 
     /**
      * @brief Execute the program referred to by pathname
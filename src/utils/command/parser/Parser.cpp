@@ -26,9 +26,9 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <algorithm>
 #include <cstring>
-#include <sstream>
-#include <vector>
+#include <new>
 
 #include "Parser.h"
 
@@ -36,67 +36,77 @@ using namespace utils::command;
 
 namespace {
 
-/* Provided "delimiter", return an array of strings resulting from the
- * splitting of "stringToSplit" into substrings */
-std::vector<std::string> splitString(const std::string& stringToSplit,
-                                     char delimiter = ' ')
+/* Substrings are separated by "delimiter". Like std::getline(), empty
+ * substrings are kept except after a trailing delimiter */
+std::size_t countSubstrings(const std::string& commandToParse, char delimiter)
 {
-    std::vector<std::string> results;
-    std::string substring;
-
-    std::istringstream iss(stringToSplit);
-    while (std::getline(iss, substring, delimiter)) {
-        results.push_back(substring);
+    if (commandToParse.empty()) {
+        return 0;
     }
 
-    return results;
+    return static_cast<std::size_t>(
+               std::count(commandToParse.begin(), commandToParse.end(), delimiter))
+           + (commandToParse.back() == delimiter ? 0 : 1);
+}
+
+/* Layout: Command | argv (NULL-terminated) | copy of commandToParse.
+ * sizeof(Command) is a multiple of the alignment of char* */
+std::size_t blockSize(std::size_t length, std::size_t nbResults)
+{
+    return sizeof(Parser::Command) + (nbResults + 1) * sizeof(char*) + length + 1;
 }
 
 }
 
 void Parser::CommandDeleter::operator()(Command* command)
 {
-    delete[] command->pathname;
-
-    for (int index = 0; index < command->argc; ++index) {
-        delete[] command->argv[index];
-    }
-
-    delete[] command->argv;
-    delete command;
+    // The command, argv and the strings live in the block allocated by parse()
+    command->~Command();
+    resource->deallocate(command, size, alignof(Command));
 }
 
 std::unique_ptr<Parser::Command, Parser::CommandDeleter>
-    Parser::parse(const std::string& commandToParse, char delimiter)
+    Parser::parse(const std::string& commandToParse,
+                  char delimiter,
+                  std::pmr::memory_resource* resource)
 {
-    /* Split command into substrings */
-    std::vector<std::string> results = splitString(commandToParse, delimiter);
-
-    std::size_t nbResults     = results.size();
-    std::size_t oneResultSize = 0llu;
+    const std::size_t length    = commandToParse.size();
+    const std::size_t nbResults = countSubstrings(commandToParse, delimiter);
 
-    /* Generate parsed command */
-    std::unique_ptr<Parser::Command, Parser::CommandDeleter> command(
-        new Command, CommandDeleter());
+    const std::size_t argvSize = (nbResults + 1) * sizeof(char*);
+    const std::size_t size     = blockSize(length, nbResults);
+    void* block                = resource->allocate(size, alignof(Command));
 
-    /* pathname is the absolute path to command to execute
-     * It is always saved as the first element of the array */
-    oneResultSize = results[0].size();
-
-    command->pathname = new char[oneResultSize + 1]();
-    strncpy(command->pathname, results[0].c_str(), oneResultSize);
-
-    /* argv contains program name (i.e pathname) + arguments */
-    command->argc = static_cast<int>(nbResults);
-    command->argv = new char*[static_cast<std::size_t>(command->argc)
-                              + 1lu](); // +1 because NULL-terminated
+    auto** argv   = reinterpret_cast<char**>(static_cast<char*>(block)
+                                           + sizeof(Command));
+    char* strings = reinterpret_cast<char*>(argv) + argvSize;
+    std::memcpy(strings, commandToParse.c_str(), length + 1);
 
+    /* Terminate each substring in place and point argv to it */
+    char* substring = strings;
     for (std::size_t index = 0; index < nbResults; ++index) {
-        oneResultSize = results[index].size();
+        argv[index] = substring;
 
-        command->argv[index] = new char[oneResultSize + 1]();
-        strncpy(command->argv[index], results[index].c_str(), oneResultSize);
+        substring = std::find(substring, strings + length, delimiter);
+        *substring++ = '\0';
     }
+    argv[nbResults] = nullptr;
+
+    /* pathname is the absolute path to command to execute
+     * It is always saved as the first element of the array */
+    std::unique_ptr<Parser::Command, Parser::CommandDeleter> command(
+        new (block) Command {strings, static_cast<int>(nbResults), argv},
+        CommandDeleter {resource, size});
 
     return command;
 }
+
+std::size_t Parser::footprint(const std::string& commandToParse, char delimiter)
+{
+    /* Blocks are allocated one after another so each one starts aligned */
+    constexpr std::size_t ALIGNMENT = alignof(Command);
+
+    const std::size_t nbResults = countSubstrings(commandToParse, delimiter);
+    const std::size_t size      = blockSize(commandToParse.size(), nbResults);
+    return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
@@ -30,6 +30,10 @@
 #define __UTILS_COMMAND_PARSER_H__
 
 #include <memory>
+#include <memory_resource>
+#include <string>
+
+#include "utils/helper/Arena.h"
 
 namespace utils::command {
 
@@ -40,6 +44,12 @@ namespace utils::command {
  * @brief A helper class to parse a string representing a command so
  *        as to create a real command that can be passed to @ref IExecutor.
  *
+ * Commands are parsed on the hot path of every apply so a command, its
+ * argv array and all its strings are stored in a single allocation. It is
+ * taken from the current arena of the calling thread, if any (see
+ * helper::Arena), so that parsing does not even hit the heap when the
+ * arena has been sized with @ref footprint.
+ *
  * @author Boubacar DIENE <boubacar.diene@gmail.com>
  * @date April 2020
  */
@@ -65,6 +75,9 @@ public:
      * @brief Custom deleter associated to the created command
      */
     struct CommandDeleter {
+        std::pmr::memory_resource* resource; /**< Where the command lives */
+        std::size_t size;                    /**< Size of the allocation */
+
         void operator()(Command* command);
     };
 
@@ -74,13 +87,28 @@ public:
      * @param commandToParse The shell command to parse
      * @param delimiter      The delimiter that shows how to split the input
      *                       string into substrings
+     * @param resource       The memory resource to allocate the command from
      *
      * @return A command that can be provided to @ref IExecutor
      *
      * @see Command
      */
     [[nodiscard]] static std::unique_ptr<Command, CommandDeleter>
-        parse(const std::string& commandToParse, char delimiter = ' ');
+        parse(const std::string& commandToParse,
+              char delimiter                     = ' ',
+              std::pmr::memory_resource* resource = helper::Arena::current());
+
+    /**
+     * @brief Tell how many bytes parse() takes from a memory resource for
+     *        the given command, alignment included
+     *
+     * @param commandToParse See @ref parse
+     * @param delimiter      See @ref parse
+     *
+     * @return The size to add to an arena for each command parsed from it
+     */
+    [[nodiscard]] static std::size_t footprint(const std::string& commandToParse,
+                                               char delimiter = ' ');
 };
 
 }
@@ -0,0 +1,87 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_PATHNAME_DEFAULTPATHNAMES_H__
+#define __UTILS_COMMAND_PATHNAME_DEFAULTPATHNAMES_H__
+
+#include <string_view>
+
+namespace utils::command {
+
+/**
+ * @class DefaultPathnames DefaultPathnames.h
+ *        "utils/command/pathname/DefaultPathnames.h"
+ * @ingroup Helper
+ *
+ * @brief Where the programs the service runs on its own are expected when
+ *        the configuration doesn't tell (E.g: "ipset" to load a set given
+ *        by a file, "ip" to take a snapshot of the interfaces)
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class DefaultPathnames {
+
+public:
+    /** ipset, to load sets and save or restore them */
+    static constexpr const char* const IPSET = "/sbin/ipset";
+
+    /** nftables, to load sets and save or restore the ruleset */
+    static constexpr const char* const NFT = "/usr/sbin/nft";
+
+    /** iproute2, to save the interfaces and remove the ones created */
+    static constexpr const char* const IP = "/sbin/ip";
+
+    /**
+     * @brief Find the default pathname of a program
+     *
+     * @param program The name of the program (E.g: "nft")
+     *
+     * @return The pathname or nullptr if the program has none
+     */
+    [[nodiscard]] static constexpr const char* of(std::string_view program)
+    {
+        if (program == "ipset") {
+            return IPSET;
+        }
+
+        if (program == "nft") {
+            return NFT;
+        }
+
+        if (program == "ip") {
+            return IP;
+        }
+
+        return nullptr;
+    }
+};
+
+}
+
+#endif
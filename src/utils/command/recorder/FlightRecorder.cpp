@@ -0,0 +1,313 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <fstream>
+#include <pthread.h>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "FlightRecorder.h"
+
+using namespace utils::command;
+
+namespace {
+
+constexpr std::array<char, 4> MAGIC = {'N', 'S', 'F', 'R'};
+constexpr std::uint32_t VERSION     = 1;
+
+constexpr std::array<int, 5> FATAL_SIGNALS
+    = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+/* Number of events copied on the stack before being written by dump() */
+constexpr std::size_t NB_DUMPED_EVENTS_PER_WRITE = 64;
+
+/* Index of the command being executed by each thread */
+thread_local std::uint32_t tCommandIndex = 0;
+
+/* Cached result of gettid(), 0 until the thread records its first event. It
+ * is reset in forked children since their only thread has another id */
+thread_local std::int32_t tThreadId = 0;
+
+/* Recorder to dump when a fatal signal is received and where. The handler
+ * can interrupt any thread, so the pointer must be lock-free */
+std::atomic<const FlightRecorder*> gSignalRecorder {nullptr};
+static_assert(std::atomic<const FlightRecorder*>::is_always_lock_free);
+std::array<char, 256> gSignalPathname {};
+
+std::int32_t currentThreadId()
+{
+    if (tThreadId == 0) {
+        tThreadId = static_cast<std::int32_t>(syscall(SYS_gettid));
+    }
+    return tThreadId;
+}
+
+bool writeAll(int fd, const void* buffer, std::size_t size)
+{
+    const auto* bytes = static_cast<const char*>(buffer);
+
+    while (size > 0) {
+        ssize_t written = ::write(fd, bytes, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+
+        bytes += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+
+void onFatalSignal(int signalNumber)
+{
+    int savedErrno = errno;
+
+    const FlightRecorder* const recorder
+        = gSignalRecorder.load(std::memory_order_acquire);
+    if (recorder != nullptr) {
+        (void)recorder->dump(gSignalPathname.data());
+    }
+
+    // The handler has been reset to the default action (SA_RESETHAND)
+    errno = savedErrno;
+    (void)raise(signalNumber);
+}
+
+}
+
+struct FlightRecorder::Internal {
+    /* An event and the index it was recorded at plus one, 0 while it is
+     * being written, so that readers can tell a complete event from a
+     * torn one */
+    struct Slot {
+        std::atomic<std::uint64_t> commit {0};
+        Event event {};
+    };
+
+    std::array<Slot, NB_EVENTS> slots {};
+    std::atomic<std::uint64_t> nbRecordedEvents {0};
+    std::atomic<std::uint32_t> nbCommands {0};
+
+    /* Return the range of recorded events as [first, last) indexes */
+    [[nodiscard]] std::pair<std::uint64_t, std::uint64_t> range() const
+    {
+        const std::uint64_t last = nbRecordedEvents.load(std::memory_order_acquire);
+        return {(last > NB_EVENTS) ? (last - NB_EVENTS) : 0, last};
+    }
+
+    void store(std::uint64_t index, const Event& event)
+    {
+        Slot& slot = slots[index % NB_EVENTS];
+        slot.commit.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.event = event;
+        slot.commit.store(index + 1, std::memory_order_release);
+    }
+
+    /* Copy the event recorded at index unless it is still being written or
+     * has already been overwritten. Lock-free and async-signal-safe */
+    bool load(std::uint64_t index, Event& event) const
+    {
+        const Slot& slot            = slots[index % NB_EVENTS];
+        const std::uint64_t expected = index + 1;
+        if (slot.commit.load(std::memory_order_acquire) != expected) {
+            return false;
+        }
+
+        event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.commit.load(std::memory_order_relaxed) == expected;
+    }
+};
+
+FlightRecorder::FlightRecorder() : m_internal(std::make_unique<Internal>())
+{
+    static const int isRegistered = pthread_atfork(nullptr, nullptr, []() {
+        tThreadId = 0;
+    });
+    (void)isRegistered;
+}
+
+FlightRecorder::~FlightRecorder()
+{
+    const FlightRecorder* recorder = this;
+    (void)gSignalRecorder.compare_exchange_strong(recorder, nullptr);
+}
+
+std::uint32_t FlightRecorder::startCommand()
+{
+    tCommandIndex
+        = m_internal->nbCommands.fetch_add(1, std::memory_order_relaxed) + 1;
+    record(COMMAND_STARTED);
+
+    return tCommandIndex;
+}
+
+void FlightRecorder::record(EventType type, int pid, int status, int errnum)
+{
+    struct timespec now {};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    constexpr std::uint64_t nsPerSecond = 1000000000ULL;
+    const std::uint64_t index
+        = m_internal->nbRecordedEvents.fetch_add(1, std::memory_order_acq_rel);
+
+    Event event {};
+    event.timestampNs  = (static_cast<std::uint64_t>(now.tv_sec) * nsPerSecond)
+                        + static_cast<std::uint64_t>(now.tv_nsec);
+    event.type         = type;
+    event.commandIndex = tCommandIndex;
+    event.threadId     = currentThreadId();
+    event.pid          = pid;
+    event.status       = status;
+    event.errnum       = errnum;
+
+    m_internal->store(index, event);
+}
+
+std::uint32_t FlightRecorder::currentCommand()
+{
+    return tCommandIndex;
+}
+
+void FlightRecorder::resumeCommand(std::uint32_t commandIndex)
+{
+    tCommandIndex = commandIndex;
+}
+
+std::vector<FlightRecorder::Event> FlightRecorder::events() const
+{
+    const auto [first, last] = m_internal->range();
+
+    std::vector<Event> result;
+    result.reserve(static_cast<std::size_t>(last - first));
+
+    Event event {};
+    for (std::uint64_t index = first; index < last; ++index) {
+        if (m_internal->load(index, event)) {
+            result.push_back(event);
+        }
+    }
+
+    return result;
+}
+
+bool FlightRecorder::dump(const char* pathname) const
+{
+    /* Only async-signal-safe functions are used here */
+    int fd = open(pathname, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd == -1) {
+        return false;
+    }
+
+    const auto [first, last] = m_internal->range();
+
+    /* The number of events is only known once torn ones are skipped so the
+     * header is written again at the end */
+    Header header {};
+    std::memcpy(header.magic, MAGIC.data(), MAGIC.size());
+    header.version   = VERSION;
+    header.eventSize = sizeof(Event);
+    header.nbEvents  = 0;
+
+    bool isDumped = writeAll(fd, &header, sizeof(header));
+
+    /* Events are copied to the stack, oldest first, and written by chunks */
+    std::array<Event, NB_DUMPED_EVENTS_PER_WRITE> chunk {};
+    std::size_t nbInChunk = 0;
+
+    for (std::uint64_t index = first; isDumped && (index < last); ++index) {
+        if (!m_internal->load(index, chunk[nbInChunk])) {
+            continue;
+        }
+
+        ++header.nbEvents;
+        if (++nbInChunk == chunk.size()) {
+            isDumped  = writeAll(fd, chunk.data(), nbInChunk * sizeof(Event));
+            nbInChunk = 0;
+        }
+    }
+
+    isDumped = isDumped && writeAll(fd, chunk.data(), nbInChunk * sizeof(Event))
+               && (lseek(fd, 0, SEEK_SET) == 0)
+               && writeAll(fd, &header, sizeof(header));
+
+    return (close(fd) == 0) && isDumped;
+}
+
+void FlightRecorder::dumpOnFatalSignals(const std::string& pathname) const
+{
+    if (pathname.size() >= gSignalPathname.size()) {
+        throw std::invalid_argument("FlightRecorder: Pathname too long: "
+                                    + pathname);
+    }
+
+    std::memcpy(gSignalPathname.data(), pathname.c_str(), pathname.size() + 1);
+    gSignalRecorder.store(this, std::memory_order_release);
+
+    struct sigaction action {};
+    action.sa_handler = onFatalSignal;
+    action.sa_flags   = static_cast<int>(SA_RESETHAND);
+    (void)sigemptyset(&action.sa_mask);
+
+    for (int signalNumber : FATAL_SIGNALS) {
+        (void)sigaction(signalNumber, &action, nullptr);
+    }
+}
+
+std::vector<FlightRecorder::Event> FlightRecorder::read(const std::string& pathname)
+{
+    std::ifstream file(pathname, std::ios::binary);
+
+    Header header {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || (std::memcmp(header.magic, MAGIC.data(), MAGIC.size()) != 0)
+        || (header.version != VERSION) || (header.eventSize != sizeof(Event))) {
+        throw std::runtime_error("FlightRecorder: Invalid file: " + pathname);
+    }
+
+    std::vector<Event> result(header.nbEvents);
+    if (!file.read(reinterpret_cast<char*>(result.data()),
+                   static_cast<std::streamsize>(result.size() * sizeof(Event)))) {
+        throw std::runtime_error("FlightRecorder: Truncated file: " + pathname);
+    }
+
+    return result;
+}
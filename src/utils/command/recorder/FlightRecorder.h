@@ -0,0 +1,204 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_FLIGHT_RECORDER_H__
+#define __UTILS_COMMAND_FLIGHT_RECORDER_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace utils::command {
+
+/**
+ * @class FlightRecorder FlightRecorder.h "utils/command/recorder/FlightRecorder.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to keep the last events related to executed programs
+ *        in memory so that they can be dumped for post-mortem debugging.
+ *
+ * Events are fixed-size binary records written to a preallocated ring buffer
+ * without any lock nor allocation. Only the most recent events are kept.
+ * Recording is thread-safe and the dump is async-signal-safe so it can also
+ * be done from a fatal signal handler (see dumpOnFatalSignals()). Each slot
+ * of the buffer has a commit word so that events being written when they
+ * are read or dumped are left out instead of being torn.
+ *
+ * Dump file format (native endianness):
+ * - @ref Header
+ * - Header::nbEvents records of type @ref Event, oldest first
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class FlightRecorder {
+
+public:
+    /** Maximum number of events kept in memory */
+    static constexpr std::size_t NB_EVENTS = 4096;
+
+    /**
+     * @enum EventType
+     *
+     * @brief What an event is about
+     */
+    enum EventType : std::uint32_t {
+        COMMAND_STARTED   = 1, /**< Executor started a command */
+        PROCESS_CREATED   = 2, /**< A child process has been created (or not) */
+        PROCESS_EXITED    = 3, /**< A child process has been waited for */
+        COMMAND_SUCCEEDED = 4, /**< Executor completed a command */
+        COMMAND_FAILED    = 5  /**< Executor failed to complete a command */
+    };
+
+    /**
+     * @struct Event
+     *
+     * @brief A binary record as stored in memory and in dump files
+     */
+    struct Event {
+        std::uint64_t timestampNs;  /**< CLOCK_MONOTONIC time */
+        std::uint32_t type;         /**< A value of type @ref EventType */
+        std::uint32_t commandIndex; /**< Command being executed by the thread */
+        std::int32_t threadId;      /**< Thread that recorded the event */
+        std::int32_t pid;           /**< Child process or -1 */
+        std::int32_t status;        /**< Status as returned by wait4() or 0 */
+        std::int32_t errnum;        /**< errno value or 0 */
+    };
+
+    /**
+     * @struct Header
+     *
+     * @brief Header of dump files
+     */
+    struct Header {
+        char magic[4];           /**< "NSFR" */
+        std::uint32_t version;   /**< Format version, currently 1 */
+        std::uint32_t eventSize; /**< sizeof(Event) */
+        std::uint32_t nbEvents;  /**< Number of events following the header */
+    };
+
+    /** Class constructor. All memory is allocated here */
+    FlightRecorder();
+
+    /** Class destructor */
+    ~FlightRecorder();
+
+    /** Class copy constructor */
+    FlightRecorder(const FlightRecorder&) = delete;
+
+    /** Class copy-assignment operator */
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /** Class move constructor */
+    FlightRecorder(FlightRecorder&&) = delete;
+
+    /** Class move-assignment operator */
+    FlightRecorder& operator=(FlightRecorder&&) = delete;
+
+    /**
+     * @brief Record a @ref COMMAND_STARTED event with a new command index.
+     *        Following events recorded by the calling thread carry this
+     *        index
+     *
+     * @return The new command index (starting at 1)
+     */
+    std::uint32_t startCommand();
+
+    /**
+     * @brief Record an event for the command being executed by the calling
+     *        thread
+     *
+     * @param type   A value of type @ref EventType
+     * @param pid    Child process or -1
+     * @param status Status as returned by wait4() or 0
+     * @param errnum errno value or 0
+     */
+    void record(EventType type, int pid = -1, int status = 0, int errnum = 0);
+
+    /** The index of the command being executed by the calling thread or 0 */
+    [[nodiscard]] static std::uint32_t currentCommand();
+
+    /**
+     * @brief Make a command the one being executed by the calling thread
+     *        again. Needed when a thread executes other commands while one
+     *        is waiting (E.g: tasks run by a FiberScheduler)
+     *
+     * @param commandIndex A value returned by @ref currentCommand()
+     */
+    static void resumeCommand(std::uint32_t commandIndex);
+
+    /** Recorded events, oldest first */
+    [[nodiscard]] std::vector<Event> events() const;
+
+    /**
+     * @brief Write recorded events to a file (see class description for
+     *        the format). This function is async-signal-safe
+     *
+     * @param pathname Where to write the events
+     *
+     * @return true on success, false otherwise
+     */
+    bool dump(const char* pathname) const;
+
+    /**
+     * @brief Dump recorded events to a file if the process receives a
+     *        fatal signal (SIGSEGV, SIGBUS, SIGFPE, SIGILL or SIGABRT).
+     *        The signal is then raised again with its default action
+     *
+     * @param pathname Where to write the events. It is copied
+     *
+     * @note Only one recorder can be dumped on fatal signals at a time
+     */
+    void dumpOnFatalSignals(const std::string& pathname) const;
+
+    /**
+     * @brief Read events from a file written by dump()
+     *
+     * @param pathname The file to read
+     *
+     * @return Events read from the file, oldest first
+     *
+     * @throw std::runtime_error if the file is not a valid dump file
+     */
+    static std::vector<Event> read(const std::string& pathname);
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,190 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "CommandTable.h"
+
+using namespace utils::command;
+
+struct CommandTable::Internal {
+    /* Most tokens are a few bytes long so a block holds thousands of them */
+    static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+    /* Distinct tokens, NUL-terminated, in blocks that are never reallocated
+     * so that argv arrays and the index can point to them */
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* freeSpace         = nullptr;
+    std::size_t freeLength  = 0;
+    std::unordered_map<std::string_view, char*> index;
+
+    /* NULL-terminated argv arrays of all commands, one after another, and
+     * where each one starts */
+    std::vector<char*> argvs;
+    std::vector<std::size_t> offsets;
+
+    char* copy(std::string_view token)
+    {
+        const std::size_t size = token.size() + 1;
+        if (size > freeLength) {
+            // Tokens longer than a block get a block of their own
+            const std::size_t blockSize = std::max(size, BLOCK_SIZE);
+            blocks.emplace_back(new char[blockSize]);
+            freeSpace  = blocks.back().get();
+            freeLength = blockSize;
+        }
+
+        char* const stored = freeSpace;
+        std::memcpy(stored, token.data(), token.size());
+        stored[token.size()] = '\0';
+
+        freeSpace += size;
+        freeLength -= size;
+        return stored;
+    }
+
+    char* intern(std::string_view token)
+    {
+        const auto found = index.find(token);
+        if (found != index.end()) {
+            return found->second;
+        }
+
+        char* const stored = copy(token);
+        index.emplace(std::string_view(stored, token.size()), stored);
+        return stored;
+    }
+
+    [[nodiscard]] char* const* argv(Id id) const { return &argvs[offsets.at(id)]; }
+};
+
+CommandTable::CommandTable() : m_internal(std::make_unique<Internal>()) {}
+
+CommandTable::~CommandTable() = default;
+
+CommandTable::Id CommandTable::add(const std::string& command, char delimiter)
+{
+    const Id id = m_internal->offsets.size();
+    m_internal->offsets.push_back(m_internal->argvs.size());
+
+    /* Same splitting as Parser: empty tokens are kept except after a
+     * trailing delimiter */
+    const std::string_view view(command);
+    std::size_t start = 0;
+    while (start < view.size()) {
+        std::size_t end = view.find(delimiter, start);
+        if (end == std::string_view::npos) {
+            end = view.size();
+        }
+
+        char* const token = m_internal->intern(view.substr(start, end - start));
+        m_internal->argvs.push_back(token);
+        start = end + 1;
+    }
+    m_internal->argvs.push_back(nullptr);
+
+    return id;
+}
+
+std::size_t CommandTable::size() const
+{
+    return m_internal->offsets.size();
+}
+
+std::size_t CommandTable::nbTokens() const
+{
+    return m_internal->index.size();
+}
+
+int CommandTable::argc(Id id) const
+{
+    char* const* argv = m_internal->argv(id);
+
+    int count = 0;
+    while (argv[count] != nullptr) {
+        ++count;
+    }
+
+    return count;
+}
+
+char* const* CommandTable::argv(Id id) const
+{
+    return m_internal->argv(id);
+}
+
+const char* CommandTable::pathname(Id id) const
+{
+    char* const* argv = m_internal->argv(id);
+    return argv[0] != nullptr ? argv[0] : "";
+}
+
+std::string CommandTable::command(Id id, char delimiter) const
+{
+    std::string result;
+    for (char* const* token = m_internal->argv(id); *token != nullptr; ++token) {
+        if (token != m_internal->argv(id)) {
+            result += delimiter;
+        }
+        result += *token;
+    }
+
+    return result;
+}
+
+bool CommandTable::equal(Id first, Id second) const
+{
+    char* const* firstToken  = m_internal->argv(first);
+    char* const* secondToken = m_internal->argv(second);
+
+    // Interned tokens are equal if and only if they are at the same address
+    while ((*firstToken != nullptr) && (*firstToken == *secondToken)) {
+        ++firstToken;
+        ++secondToken;
+    }
+
+    return *firstToken == *secondToken;
+}
+
+std::size_t CommandTable::hash(Id id) const
+{
+    constexpr std::size_t GOLDEN_RATIO = 0x9e3779b97f4a7c15ULL;
+
+    std::size_t result = 0;
+    for (char* const* token = m_internal->argv(id); *token != nullptr; ++token) {
+        const std::size_t tokenHash = std::hash<const char*>()(*token);
+        result ^= tokenHash + GOLDEN_RATIO + (result << 6U) + (result >> 2U);
+    }
+
+    return result;
+}
@@ -0,0 +1,133 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_COMMAND_COMMAND_TABLE_H__
+#define __UTILS_COMMAND_COMMAND_TABLE_H__
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace utils::command {
+
+/**
+ * @class CommandTable CommandTable.h "utils/command/table/CommandTable.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class storing many commands in a flat, interned form
+ *
+ * Large configurations repeat the same few strings over and over
+ * ("/sbin/iptables", "-A", "INPUT", "-j", "DROP", interface names, ...).
+ * Commands added to the table are split like @ref Parser does, each
+ * distinct token is stored only once and a command is reduced to an array
+ * of pointers to its tokens. These arrays are stored one after another in
+ * a single vector and are NULL-terminated so that they can be passed as
+ * they are to @ref IExecutor: a command of the table is executed without
+ * being parsed or copied again.
+ *
+ * Since tokens are interned, two commands are equal if and only if their
+ * arrays hold the same pointers, which makes comparing and hashing
+ * commands cheap.
+ *
+ * @note Tokens never move once interned but the arrays returned by argv()
+ *       are only valid until the next call to add(). Commands can be read
+ *       from several threads as long as none is added meanwhile.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class CommandTable {
+
+public:
+    /** Identifier of a command in the table */
+    using Id = std::size_t;
+
+    /** Class constructor */
+    CommandTable();
+
+    /** Class destructor */
+    ~CommandTable();
+
+    /** Class copy constructor */
+    CommandTable(const CommandTable&) = delete;
+
+    /** Class copy-assignment operator */
+    CommandTable& operator=(const CommandTable&) = delete;
+
+    /** Class move constructor */
+    CommandTable(CommandTable&&) = delete;
+
+    /** Class move-assignment operator */
+    CommandTable& operator=(CommandTable&&) = delete;
+
+    /**
+     * @brief Add a command to the table
+     *
+     * @param command   The shell command to add
+     * @param delimiter The delimiter splitting the command into tokens
+     *
+     * @return The identifier of the command
+     */
+    Id add(const std::string& command, char delimiter = ' ');
+
+    /** Number of commands in the table */
+    [[nodiscard]] std::size_t size() const;
+
+    /** Number of distinct tokens in the table */
+    [[nodiscard]] std::size_t nbTokens() const;
+
+    /** Number of tokens of a command */
+    [[nodiscard]] int argc(Id id) const;
+
+    /** Tokens of a command, NULL-terminated */
+    [[nodiscard]] char* const* argv(Id id) const;
+
+    /** Program of a command i.e its first token ("" if it has none) */
+    [[nodiscard]] const char* pathname(Id id) const;
+
+    /** Build a command back as it was added */
+    [[nodiscard]] std::string command(Id id, char delimiter = ' ') const;
+
+    /** Whether two commands are made of the same tokens */
+    [[nodiscard]] bool equal(Id first, Id second) const;
+
+    /** Hash of a command, consistent with @ref equal */
+    [[nodiscard]] std::size_t hash(Id id) const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
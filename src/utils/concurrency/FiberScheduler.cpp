@@ -0,0 +1,345 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <deque>
+#include <exception>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#if defined(__SANITIZE_ADDRESS__)
+#include <sanitizer/common_interface_defs.h>
+#endif
+
+#include "utils/helper/Errno.h"
+
+#include "FiberScheduler.h"
+
+using namespace utils::concurrency;
+using namespace utils::helper;
+
+namespace {
+
+/* AddressSanitizer has to be told which stack is about to be used, else it
+ * takes each switch for a stack overflow */
+inline void startSwitch(void** fakeStack, const void* bottom, std::size_t size)
+{
+#if defined(__SANITIZE_ADDRESS__)
+    __sanitizer_start_switch_fiber(fakeStack, bottom, size);
+#else
+    (void)fakeStack;
+    (void)bottom;
+    (void)size;
+#endif
+}
+
+inline void
+    finishSwitch(void* fakeStack, const void** oldBottom, std::size_t* oldSize)
+{
+#if defined(__SANITIZE_ADDRESS__)
+    __sanitizer_finish_switch_fiber(fakeStack, oldBottom, oldSize);
+#else
+    (void)fakeStack;
+    (void)oldBottom;
+    (void)oldSize;
+#endif
+}
+
+inline std::size_t pageSize()
+{
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/* Stack of a task with an inaccessible guard page below it */
+class Stack {
+
+public:
+    explicit Stack(std::size_t size) : m_size(size)
+    {
+        m_mapping = mmap(nullptr,
+                         m_size + pageSize(),
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK,
+                         -1,
+                         0);
+        if (m_mapping == MAP_FAILED) {
+            throw std::runtime_error(
+                Errno::toString("FiberScheduler: mmap()", errno));
+        }
+
+        if (mprotect(m_mapping, pageSize(), PROT_NONE) == -1) {
+            const int errnum = errno;
+            (void)munmap(m_mapping, m_size + pageSize());
+            throw std::runtime_error(
+                Errno::toString("FiberScheduler: mprotect()", errnum));
+        }
+    }
+
+    ~Stack() { (void)munmap(m_mapping, m_size + pageSize()); }
+
+    Stack(const Stack&) = delete;
+    Stack& operator=(const Stack&) = delete;
+    Stack(Stack&&)                 = delete;
+    Stack& operator=(Stack&&) = delete;
+
+    [[nodiscard]] void* bottom() const
+    {
+        return static_cast<char*>(m_mapping) + pageSize();
+    }
+
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+private:
+    const std::size_t m_size;
+    void* m_mapping = nullptr;
+};
+
+struct Fiber {
+    FiberScheduler::Task task;
+    FiberScheduler::ResumeHook resumeHook;
+    std::unique_ptr<Stack> stack;
+    ucontext_t context {};
+    void* fakeStack = nullptr;
+    std::exception_ptr exception;
+    bool isCompleted = false;
+};
+
+/* State of the run() call in progress on a thread */
+struct Loop {
+    ucontext_t context {};
+    Fiber* running = nullptr;
+    int epollFd = -1;
+    std::size_t nbWaiting = 0;
+
+    /* The stack run() is called from, as seen by AddressSanitizer */
+    const void* stackBottom = nullptr;
+    std::size_t stackSize   = 0;
+    void* fakeStack         = nullptr;
+};
+
+thread_local Loop* tLoop = nullptr;
+
+/* Entry point of all fibers. It never returns: the stack of a completed
+ * fiber is released by the scheduler */
+void fiberMain()
+{
+    Loop* loop   = tLoop;
+    Fiber* fiber = loop->running;
+    finishSwitch(nullptr, &loop->stackBottom, &loop->stackSize);
+
+    try {
+        fiber->task();
+    }
+    catch (...) {
+        fiber->exception = std::current_exception();
+    }
+    fiber->isCompleted = true;
+
+    // No fake stack is saved since this fiber is never resumed
+    startSwitch(nullptr, loop->stackBottom, loop->stackSize);
+    (void)setcontext(&loop->context);
+}
+
+}
+
+struct FiberScheduler::Internal {
+    const std::size_t stackSize;
+
+    explicit Internal(std::size_t providedStackSize)
+        : stackSize(((std::max<std::size_t>(providedStackSize, 1) + pageSize() - 1)
+                     / pageSize())
+                    * pageSize())
+    {}
+
+    /* Run a fiber until it completes or waits. Its stack is allocated when
+     * it is first run and released once it has completed */
+    void resume(Loop& loop, Fiber& fiber) const
+    {
+        if (!fiber.stack) {
+            try {
+                fiber.stack = std::make_unique<Stack>(stackSize);
+                if (getcontext(&fiber.context) == -1) {
+                    throw std::runtime_error(
+                        Errno::toString("FiberScheduler: getcontext()", errno));
+                }
+            }
+            catch (...) {
+                fiber.exception   = std::current_exception();
+                fiber.isCompleted = true;
+                return;
+            }
+
+            fiber.context.uc_stack.ss_sp   = fiber.stack->bottom();
+            fiber.context.uc_stack.ss_size = fiber.stack->size();
+            fiber.context.uc_link          = nullptr;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+            makecontext(&fiber.context, fiberMain, 0);
+        }
+
+        loop.running = &fiber;
+        startSwitch(&loop.fakeStack, fiber.stack->bottom(), fiber.stack->size());
+        (void)swapcontext(&loop.context, &fiber.context);
+        finishSwitch(loop.fakeStack, nullptr, nullptr);
+        loop.running = nullptr;
+
+        if (fiber.isCompleted) {
+            fiber.stack.reset();
+        }
+    }
+};
+
+FiberScheduler::FiberScheduler(std::size_t stackSize)
+    : m_internal(std::make_unique<Internal>(stackSize))
+{}
+
+FiberScheduler::~FiberScheduler() = default;
+
+std::size_t FiberScheduler::stackSize() const
+{
+    return m_internal->stackSize;
+}
+
+void FiberScheduler::run(std::vector<Task> tasks) const
+{
+    if (tLoop != nullptr) {
+        throw std::logic_error("FiberScheduler: run() can't be called from a task");
+    }
+
+    Loop loop;
+    loop.epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (loop.epollFd == -1) {
+        throw std::runtime_error(
+            Errno::toString("FiberScheduler: epoll_create1()", errno));
+    }
+
+    std::vector<Fiber> fibers(tasks.size());
+    std::deque<Fiber*> ready;
+    for (std::size_t index = 0; index < tasks.size(); ++index) {
+        fibers[index].task = std::move(tasks[index]);
+        ready.push_back(&fibers[index]);
+    }
+
+    std::exception_ptr firstException;
+    std::array<epoll_event, 64> events {};
+
+    tLoop = &loop;
+    while (!ready.empty() || (loop.nbWaiting > 0)) {
+        if (ready.empty()) {
+            const int nbEvents = epoll_wait(loop.epollFd,
+                                            events.data(),
+                                            static_cast<int>(events.size()),
+                                            -1);
+
+            // Other errors can't happen with a valid epoll instance and buffer
+            for (int index = 0; index < nbEvents; ++index) {
+                const auto eventIndex = static_cast<std::size_t>(index);
+                ready.push_back(static_cast<Fiber*>(events[eventIndex].data.ptr));
+                --loop.nbWaiting;
+            }
+            continue;
+        }
+
+        Fiber* fiber = ready.front();
+        ready.pop_front();
+
+        m_internal->resume(loop, *fiber);
+        if (fiber->isCompleted && fiber->exception && !firstException) {
+            firstException = fiber->exception;
+        }
+    }
+    tLoop = nullptr;
+
+    (void)close(loop.epollFd);
+
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+bool FiberScheduler::isInFiber()
+{
+    return (tLoop != nullptr) && (tLoop->running != nullptr);
+}
+
+void FiberScheduler::awaitReadable(int fd)
+{
+    if (!isInFiber()) {
+        pollfd pollFd = {fd, POLLIN, 0};
+
+        int ret = 0;
+        do {
+            ret = poll(&pollFd, 1, -1);
+        } while ((ret == -1) && (errno == EINTR));
+
+        if (ret == -1) {
+            throw std::runtime_error(
+                Errno::toString("FiberScheduler: poll()", errno));
+        }
+        return;
+    }
+
+    Loop* loop   = tLoop;
+    Fiber* fiber = loop->running;
+
+    // One-shot so that the descriptor is reported once while the fiber waits
+    // in the ready queue
+    epoll_event event {};
+    event.events   = EPOLLIN | EPOLLONESHOT;
+    event.data.ptr = fiber;
+    if (epoll_ctl(loop->epollFd, EPOLL_CTL_ADD, fd, &event) == -1) {
+        throw std::runtime_error(
+            Errno::toString("FiberScheduler: epoll_ctl()", errno));
+    }
+    ++loop->nbWaiting;
+
+    startSwitch(&fiber->fakeStack, loop->stackBottom, loop->stackSize);
+    (void)swapcontext(&fiber->context, &loop->context);
+    finishSwitch(fiber->fakeStack, &loop->stackBottom, &loop->stackSize);
+
+    (void)epoll_ctl(loop->epollFd, EPOLL_CTL_DEL, fd, nullptr);
+
+    if (fiber->resumeHook) {
+        fiber->resumeHook();
+    }
+}
+
+void FiberScheduler::onResume(ResumeHook hook)
+{
+    if (!isInFiber()) {
+        throw std::logic_error(
+            "FiberScheduler: onResume() must be called by a task");
+    }
+
+    tLoop->running->resumeHook = std::move(hook);
+}
@@ -0,0 +1,158 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_CONCURRENCY_FIBER_SCHEDULER_H__
+#define __UTILS_CONCURRENCY_FIBER_SCHEDULER_H__
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace utils::concurrency {
+
+/**
+ * @class FiberScheduler FiberScheduler.h "utils/concurrency/FiberScheduler.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to run a batch of tasks that mostly wait, all on
+ *        the calling thread.
+ *
+ * Each task runs on a stack of its own (a fiber). A task that has to wait
+ * for a file descriptor (E.g: a pidfd until a child process exits) calls
+ * @ref awaitReadable() which suspends it and resumes another task instead of
+ * blocking the thread. Once no task can run anymore, the thread sleeps in
+ * epoll_wait() until a descriptor is ready. Thus, a single thread keeps as
+ * many operations in flight as there are tasks.
+ *
+ * Tasks are ordinary functions: code they call does not have to be aware of
+ * fibers unless it waits. The price is that everything kept per thread is
+ * shared by the tasks, so code that suspends a task must save and restore
+ * its own per-thread state around @ref awaitReadable(). Tasks must not
+ * suspend while an exception is being handled (inside a catch block).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class FiberScheduler {
+
+public:
+    /** A task to run */
+    using Task = std::function<void()>;
+
+    /** A function called each time a task is resumed */
+    using ResumeHook = std::function<void()>;
+
+    /** Default size of the stack of each task */
+    static constexpr std::size_t DEFAULT_STACK_SIZE = 256 * 1024;
+
+    /**
+     * Class constructor
+     *
+     * @param stackSize Size of the stack of each task, rounded up to a
+     *                  multiple of the page size. A guard page is added
+     *                  below so that an overflow crashes instead of
+     *                  corrupting memory
+     */
+    explicit FiberScheduler(std::size_t stackSize = DEFAULT_STACK_SIZE);
+
+    /** Class destructor */
+    ~FiberScheduler();
+
+    /** Class copy constructor */
+    FiberScheduler(const FiberScheduler&) = delete;
+
+    /** Class copy-assignment operator */
+    FiberScheduler& operator=(const FiberScheduler&) = delete;
+
+    /** Class move constructor */
+    FiberScheduler(FiberScheduler&&) = delete;
+
+    /** Class move-assignment operator */
+    FiberScheduler& operator=(FiberScheduler&&) = delete;
+
+    /** The size of the stack of each task */
+    [[nodiscard]] std::size_t stackSize() const;
+
+    /**
+     * @brief Run all tasks on the calling thread and wait until they are
+     *        completed
+     *
+     * Tasks are started in order. A task runs until it completes or calls
+     * @ref awaitReadable(); the stack of a task is only allocated while it
+     * is running.
+     *
+     * @param tasks The tasks to run
+     *
+     * @throw Rethrow the first exception raised by a task once all other
+     *        tasks are completed
+     */
+    void run(std::vector<Task> tasks) const;
+
+    /** Tell whether the caller is a task run by a scheduler */
+    [[nodiscard]] static bool isInFiber();
+
+    /**
+     * @brief Wait until a file descriptor is readable
+     *
+     * From a task, other tasks run meanwhile and the resume hook of the
+     * task, if any, is called before returning. Otherwise, the calling
+     * thread blocks in poll().
+     *
+     * @param fd The file descriptor to wait for. It is only watched during
+     *           the call
+     *
+     * @throw std::runtime_error if the descriptor can't be watched or any
+     *        exception raised by the resume hook
+     */
+    static void awaitReadable(int fd);
+
+    /**
+     * @brief Set the function called each time the calling task is resumed
+     *        after @ref awaitReadable() (E.g: to join its network namespace
+     *        again since another task may have joined a different one)
+     *
+     * @param hook The function to call or nullptr to remove it
+     *
+     * @throw std::logic_error if the caller is not a task
+     */
+    static void onResume(ResumeHook hook);
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
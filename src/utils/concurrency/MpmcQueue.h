@@ -0,0 +1,214 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_CONCURRENCY_MPMC_QUEUE_H__
+#define __UTILS_CONCURRENCY_MPMC_QUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace utils::concurrency {
+
+/**
+ * @class MpmcQueue MpmcQueue.h "utils/concurrency/MpmcQueue.h"
+ * @ingroup Helper
+ *
+ * @brief A bounded lock-free queue that any number of threads can push to
+ *        and pop from at the same time.
+ *
+ * Each cell carries a sequence number telling whether it is ready to be
+ * written (for the lap of the ring being filled) or read. A thread claims
+ * a position with a single compare-and-swap then publishes the cell by
+ * storing its new sequence number, so neither pushes nor pops ever take a
+ * lock. Positions and cells are aligned on cache lines to keep producers
+ * and consumers from invalidating each other's lines.
+ *
+ * The queue never blocks: tryPush() fails when it is full and tryPop()
+ * when it is empty. Callers that have to wait pair it with something
+ * that sleeps (E.g: semaphores counting free and used cells).
+ *
+ * @tparam T The type of the elements. It must be default constructible and
+ *           move assignable
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ * @see https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+template <typename T>
+class MpmcQueue {
+
+public:
+    /** Size assumed for a cache line */
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * Class constructor
+     *
+     * @param capacity The maximum number of elements in the queue, rounded
+     *                 up to a power of two (at least 2)
+     */
+    explicit MpmcQueue(std::size_t capacity)
+        : m_capacity(roundUpToPowerOfTwo(capacity)),
+          m_cells(std::make_unique<Cell[]>(m_capacity))
+    {
+        for (std::size_t index = 0; index < m_capacity; ++index) {
+            m_cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /** Class destructor */
+    ~MpmcQueue() = default;
+
+    /** Class copy constructor */
+    MpmcQueue(const MpmcQueue&) = delete;
+
+    /** Class copy-assignment operator */
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /** Class move constructor */
+    MpmcQueue(MpmcQueue&&) = delete;
+
+    /** Class move-assignment operator */
+    MpmcQueue& operator=(MpmcQueue&&) = delete;
+
+    /** The maximum number of elements in the queue */
+    [[nodiscard]] std::size_t capacity() const { return m_capacity; }
+
+    /**
+     * @brief Add an element at the end of the queue
+     *
+     * @param value The element to add. It is only moved from on success
+     *
+     * @return false if the queue is full, true otherwise
+     */
+    [[nodiscard]] bool tryPush(T&& value)
+    {
+        std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = m_cells[position & (m_capacity - 1)];
+            const std::ptrdiff_t difference
+                = lag(cell.sequence.load(std::memory_order_acquire), position);
+
+            if (difference == 0) {
+                // The cell is free for this lap: claim it
+                if (m_enqueuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // The cell still holds the element pushed one lap before
+                return false;
+            }
+            else {
+                // Another producer claimed this position first
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Remove the element at the front of the queue
+     *
+     * @param value Where to move the element to
+     *
+     * @return false if the queue is empty, true otherwise
+     */
+    [[nodiscard]] bool tryPop(T& value)
+    {
+        std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = m_cells[position & (m_capacity - 1)];
+            const std::ptrdiff_t difference
+                = lag(cell.sequence.load(std::memory_order_acquire), position + 1);
+
+            if (difference == 0) {
+                // The cell holds an element: claim it
+                if (m_dequeuePosition.compare_exchange_weak(
+                        position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(position + m_capacity,
+                                        std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                // Nothing has been published at this position yet
+                return false;
+            }
+            else {
+                // Another consumer claimed this position first
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Cell {
+        std::atomic<std::size_t> sequence {0};
+        T value {};
+    };
+
+    /* Signed distance between a sequence number and the expected one so
+     * that comparisons still hold once counters have wrapped around */
+    static std::ptrdiff_t lag(std::size_t sequence, std::size_t expected)
+    {
+        return static_cast<std::ptrdiff_t>(sequence - expected);
+    }
+
+    static std::size_t roundUpToPowerOfTwo(std::size_t capacity)
+    {
+        std::size_t powerOfTwo = 2;
+        while (powerOfTwo < capacity) {
+            powerOfTwo *= 2;
+        }
+
+        return powerOfTwo;
+    }
+
+    const std::size_t m_capacity;
+    const std::unique_ptr<Cell[]> m_cells;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_enqueuePosition {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> m_dequeuePosition {0};
+};
+
+}
+
+#endif
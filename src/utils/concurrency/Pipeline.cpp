@@ -0,0 +1,173 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "Pipeline.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+/* Raised to the producer once the consumer has given up */
+class Cancelled : public std::exception {
+
+public:
+    [[nodiscard]] const char* what() const noexcept override
+    {
+        return "Pipeline: cancelled";
+    }
+};
+
+class BoundedQueue {
+
+public:
+    explicit BoundedQueue(std::size_t capacity) : m_capacity(capacity) {}
+
+    void push(Pipeline::Task task)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notFull.wait(lock, [this]() {
+            return m_cancelled || (m_tasks.size() < m_capacity);
+        });
+        if (m_cancelled) {
+            throw Cancelled();
+        }
+
+        m_tasks.push_back(std::move(task));
+        m_notEmpty.notify_one();
+    }
+
+    /* Return false once the queue is closed and all its tasks taken */
+    bool pop(Pipeline::Task& task)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_notEmpty.wait(lock, [this]() { return m_closed || !m_tasks.empty(); });
+        if (m_tasks.empty()) {
+            return false;
+        }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        m_notFull.notify_one();
+        return true;
+    }
+
+    /* No task will be pushed anymore */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed = true;
+        m_notEmpty.notify_one();
+    }
+
+    /* No task will be popped anymore */
+    void cancel()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cancelled = true;
+        m_tasks.clear();
+        m_notFull.notify_one();
+    }
+
+private:
+    const std::size_t m_capacity;
+    std::mutex m_mutex;
+    std::condition_variable m_notFull;
+    std::condition_variable m_notEmpty;
+    std::deque<Pipeline::Task> m_tasks;
+    bool m_closed    = false;
+    bool m_cancelled = false;
+};
+
+}
+
+struct Pipeline::Internal {
+    const std::size_t capacity;
+
+    explicit Internal(std::size_t providedCapacity)
+        : capacity(std::max<std::size_t>(1, providedCapacity))
+    {}
+};
+
+Pipeline::Pipeline(std::size_t capacity)
+    : m_internal(std::make_unique<Internal>(capacity))
+{}
+
+Pipeline::~Pipeline() = default;
+
+std::size_t Pipeline::capacity() const
+{
+    return m_internal->capacity;
+}
+
+void Pipeline::run(const Producer& producer) const
+{
+    BoundedQueue queue(m_internal->capacity);
+    std::exception_ptr producerException;
+
+    std::thread producerThread([&queue, &producer, &producerException]() {
+        try {
+            producer([&queue](Task task) { queue.push(std::move(task)); });
+        }
+        catch (const Cancelled&) {
+            // The consumer has failed, its exception is the one reported
+        }
+        catch (...) {
+            producerException = std::current_exception();
+        }
+        queue.close();
+    });
+
+    std::exception_ptr taskException;
+    Task task;
+    while (queue.pop(task)) {
+        try {
+            task();
+        }
+        catch (...) {
+            taskException = std::current_exception();
+            queue.cancel();
+            break;
+        }
+    }
+
+    producerThread.join();
+
+    if (taskException) {
+        std::rethrow_exception(taskException);
+    }
+    if (producerException) {
+        std::rethrow_exception(producerException);
+    }
+}
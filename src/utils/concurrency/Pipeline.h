@@ -0,0 +1,119 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_CONCURRENCY_PIPELINE_H__
+#define __UTILS_CONCURRENCY_PIPELINE_H__
+
+#include <functional>
+#include <memory>
+
+namespace utils::concurrency {
+
+/**
+ * @class Pipeline Pipeline.h "utils/concurrency/Pipeline.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to consume tasks while they are still being
+ *        produced.
+ *
+ * A producer runs on its own thread and submits tasks to a bounded queue.
+ * The calling thread runs them in the order they have been submitted as
+ * soon as they are available. Once the queue is full, submitting blocks
+ * until a task has been taken out of it so that the producer never gets
+ * more than a few tasks ahead of the consumer (backpressure).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Pipeline {
+
+public:
+    /** A task to run */
+    using Task = std::function<void()>;
+
+    /** Submit a task, blocking while the queue is full */
+    using Submit = std::function<void(Task)>;
+
+    /** Produce tasks by handing them over to the provided function */
+    using Producer = std::function<void(const Submit&)>;
+
+    /**
+     * Class constructor
+     *
+     * @param capacity The maximum number of submitted tasks waiting to be
+     *                 run. 0 is handled as 1
+     */
+    explicit Pipeline(std::size_t capacity);
+
+    /** Class destructor */
+    ~Pipeline();
+
+    /** Class copy constructor */
+    Pipeline(const Pipeline&) = delete;
+
+    /** Class copy-assignment operator */
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /** Class move constructor */
+    Pipeline(Pipeline&&) = delete;
+
+    /** Class move-assignment operator */
+    Pipeline& operator=(Pipeline&&) = delete;
+
+    /** The maximum number of submitted tasks waiting to be run */
+    [[nodiscard]] std::size_t capacity() const;
+
+    /**
+     * @brief Run the producer on a dedicated thread and the tasks it
+     *        submits on the calling thread until both are done
+     *
+     * Tasks are run one at a time and in submission order. When a task
+     * fails, the remaining tasks are dropped and the next call to the
+     * submit function raises an exception to stop the producer.
+     *
+     * @param producer The function that submits the tasks
+     *
+     * @throw Rethrow the exception raised by the failed task or, if none,
+     *        the exception raised by the producer
+     */
+    void run(const Producer& producer) const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
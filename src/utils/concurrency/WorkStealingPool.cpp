@@ -0,0 +1,167 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "WorkStealingPool.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+class TaskQueue {
+
+public:
+    void push(WorkStealingPool::Task task)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+
+    /* The owner takes the most recently pushed task */
+    std::optional<WorkStealingPool::Task> pop()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty()) {
+            return std::nullopt;
+        }
+
+        WorkStealingPool::Task task = std::move(m_tasks.back());
+        m_tasks.pop_back();
+        return task;
+    }
+
+    /* Thieves take the oldest task to limit contention with the owner */
+    std::optional<WorkStealingPool::Task> steal()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_tasks.empty()) {
+            return std::nullopt;
+        }
+
+        WorkStealingPool::Task task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        return task;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::deque<WorkStealingPool::Task> m_tasks;
+};
+
+}
+
+struct WorkStealingPool::Internal {
+    const std::size_t nbWorkers;
+
+    explicit Internal(std::size_t providedNbWorkers)
+        : nbWorkers(providedNbWorkers != 0
+                        ? providedNbWorkers
+                        : std::max(1u, std::thread::hardware_concurrency()))
+    {}
+
+    /* Queues are only filled before workers start: once all of them are
+     * empty, no task can appear anymore */
+    static std::optional<Task> next(std::vector<TaskQueue>& queues,
+                                    std::size_t workerIndex)
+    {
+        if (std::optional<Task> task = queues[workerIndex].pop()) {
+            return task;
+        }
+
+        for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+            std::size_t victim = (workerIndex + offset) % queues.size();
+            if (std::optional<Task> task = queues[victim].steal()) {
+                return task;
+            }
+        }
+
+        return std::nullopt;
+    }
+};
+
+WorkStealingPool::WorkStealingPool(std::size_t nbWorkers)
+    : m_internal(std::make_unique<Internal>(nbWorkers))
+{}
+
+WorkStealingPool::~WorkStealingPool() = default;
+
+std::size_t WorkStealingPool::nbWorkers() const
+{
+    return m_internal->nbWorkers;
+}
+
+void WorkStealingPool::run(std::vector<Task> tasks) const
+{
+    const std::size_t nbWorkers = std::min(m_internal->nbWorkers, tasks.size());
+    if (nbWorkers == 0) {
+        return;
+    }
+
+    std::vector<TaskQueue> queues(nbWorkers);
+    for (std::size_t index = 0; index < tasks.size(); ++index) {
+        queues[index % nbWorkers].push(std::move(tasks[index]));
+    }
+
+    std::mutex exceptionMutex;
+    std::exception_ptr firstException;
+
+    auto work = [&queues, &exceptionMutex, &firstException](
+                    std::size_t workerIndex) {
+        while (std::optional<Task> task = Internal::next(queues, workerIndex)) {
+            try {
+                (*task)();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(nbWorkers);
+    for (std::size_t workerIndex = 0; workerIndex < nbWorkers; ++workerIndex) {
+        workers.emplace_back(work, workerIndex);
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
@@ -0,0 +1,113 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_CONCURRENCY_WORK_STEALING_POOL_H__
+#define __UTILS_CONCURRENCY_WORK_STEALING_POOL_H__
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace utils::concurrency {
+
+/**
+ * @class WorkStealingPool WorkStealingPool.h "utils/concurrency/WorkStealingPool.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to run a batch of independent tasks on several
+ *        worker threads.
+ *
+ * Tasks are first spread over per-worker queues. Each worker runs the tasks
+ * of its own queue and, once it is empty, steals tasks from the other
+ * queues so that workers stay busy even when tasks have uneven durations.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class WorkStealingPool {
+
+public:
+    /** A task to run */
+    using Task = std::function<void()>;
+
+    /**
+     * Class constructor
+     *
+     * @param nbWorkers The maximum number of worker threads. 0 means as many
+     *                  as the number of concurrent threads supported by the
+     *                  host
+     */
+    explicit WorkStealingPool(std::size_t nbWorkers = 0);
+
+    /** Class destructor */
+    ~WorkStealingPool();
+
+    /** Class copy constructor */
+    WorkStealingPool(const WorkStealingPool&) = delete;
+
+    /** Class copy-assignment operator */
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /** Class move constructor */
+    WorkStealingPool(WorkStealingPool&&) = delete;
+
+    /** Class move-assignment operator */
+    WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+
+    /** The maximum number of worker threads */
+    [[nodiscard]] std::size_t nbWorkers() const;
+
+    /**
+     * @brief Run all tasks and wait until they are completed
+     *
+     * Workers are created for the duration of the call only; there are
+     * never more workers than tasks. A worker thread can run several tasks
+     * so any per-thread state changed by a task (E.g: its namespaces) is
+     * seen by the next tasks it runs.
+     *
+     * @param tasks The tasks to run
+     *
+     * @throw Rethrow the first exception raised by a task once all other
+     *        tasks are completed
+     */
+    void run(std::vector<Task> tasks) const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
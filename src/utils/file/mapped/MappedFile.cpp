@@ -0,0 +1,93 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "utils/helper/Errno.h"
+
+#include "MappedFile.h"
+
+using namespace utils::file;
+using namespace utils::helper;
+
+struct MappedFile::Internal {
+    void* address = nullptr;
+    std::size_t length = 0;
+};
+
+MappedFile::MappedFile(const std::string& pathname)
+    : m_internal(std::make_unique<Internal>())
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    const int fd = open(pathname.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        throw std::runtime_error(Errno::toString("open(" + pathname + ")", errno));
+    }
+
+    struct stat status {};
+    if (fstat(fd, &status) == -1) {
+        const int error = errno;
+        (void)close(fd);
+        throw std::runtime_error(Errno::toString("fstat()", error));
+    }
+
+    // mmap() rejects a zero length; an empty file simply has no content
+    m_internal->length = static_cast<std::size_t>(status.st_size);
+    if (m_internal->length > 0) {
+        void* const address
+            = mmap(nullptr, m_internal->length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            const int error = errno;
+            (void)close(fd);
+            throw std::runtime_error(Errno::toString("mmap()", error));
+        }
+
+        // Read-ahead more aggressively and drop pages behind the scan
+        (void)madvise(address, m_internal->length, MADV_SEQUENTIAL);
+        m_internal->address = address;
+    }
+
+    (void)close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_internal->address != nullptr) {
+        (void)munmap(m_internal->address, m_internal->length);
+    }
+}
+
+std::string_view MappedFile::content() const
+{
+    return {static_cast<const char*>(m_internal->address), m_internal->length};
+}
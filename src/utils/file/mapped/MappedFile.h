@@ -0,0 +1,95 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_FILE_MAPPED_FILE_H__
+#define __UTILS_FILE_MAPPED_FILE_H__
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace utils::file {
+
+/**
+ * @class MappedFile MappedFile.h "utils/file/mapped/MappedFile.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to map a whole file read-only into memory
+ *
+ * Unlike @ref Reader.h, the content is not copied: pages are loaded by the
+ * kernel when they are first accessed and can be reclaimed at any time so a
+ * file much larger than the available memory can be scanned sequentially.
+ * The mapping is removed when the object is destroyed.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class MappedFile {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param pathname The file to map
+     *
+     * @throw std::runtime_error if the file can't be opened or mapped
+     */
+    explicit MappedFile(const std::string& pathname);
+
+    /** Class destructor */
+    ~MappedFile();
+
+    /** Class copy constructor */
+    MappedFile(const MappedFile&) = delete;
+
+    /** Class copy-assignment operator */
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** Class move constructor */
+    MappedFile(MappedFile&&) = delete;
+
+    /** Class move-assignment operator */
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /** Content of the file, valid as long as the object exists */
+    [[nodiscard]] std::string_view content() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
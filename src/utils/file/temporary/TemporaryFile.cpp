@@ -0,0 +1,67 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdlib>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "utils/helper/Errno.h"
+
+#include "TemporaryFile.h"
+
+using namespace utils::file;
+using namespace utils::helper;
+
+struct TemporaryFile::Internal {
+    std::string pathname;
+
+    explicit Internal(const std::string& directory)
+        : pathname(directory + "/networkservice-XXXXXX")
+    {}
+};
+
+TemporaryFile::TemporaryFile(const std::string& directory)
+    : m_internal(std::make_unique<Internal>(directory))
+{
+    const int fd = mkstemp(m_internal->pathname.data());
+    if (fd == -1) {
+        throw std::runtime_error(Errno::toString("mkstemp()", errno));
+    }
+
+    (void)close(fd);
+}
+
+TemporaryFile::~TemporaryFile()
+{
+    (void)unlink(m_internal->pathname.c_str());
+}
+
+const std::string& TemporaryFile::pathname() const
+{
+    return m_internal->pathname;
+}
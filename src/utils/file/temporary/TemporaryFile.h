@@ -0,0 +1,93 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_FILE_TEMPORARY_FILE_H__
+#define __UTILS_FILE_TEMPORARY_FILE_H__
+
+#include <memory>
+#include <string>
+
+namespace utils::file {
+
+/**
+ * @class TemporaryFile TemporaryFile.h "utils/file/temporary/TemporaryFile.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to create a uniquely named empty file that is
+ *        removed from the filesystem when the object is destroyed.
+ *
+ * It is typically used to hand data over to programs that read it from a
+ * file (E.g: iptables-restore, ipset restore, ip -batch).
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/language/rule_of_three
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class TemporaryFile {
+
+public:
+    /**
+     * Class constructor
+     *
+     * @param directory The directory where to create the file
+     *
+     * @throw std::runtime_error if the file can't be created
+     */
+    explicit TemporaryFile(const std::string& directory = "/tmp");
+
+    /** Class destructor */
+    ~TemporaryFile();
+
+    /** Class copy constructor */
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    /** Class copy-assignment operator */
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    /** Class move constructor */
+    TemporaryFile(TemporaryFile&&) = delete;
+
+    /** Class move-assignment operator */
+    TemporaryFile& operator=(TemporaryFile&&) = delete;
+
+    /** Path to the file */
+    [[nodiscard]] const std::string& pathname() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,65 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_HELPER_ALLOCATION_COUNTER_H__
+#define __UTILS_HELPER_ALLOCATION_COUNTER_H__
+
+#include <cstddef>
+
+namespace utils::helper {
+
+/**
+ * @class AllocationCounter AllocationCounter.h "utils/helper/AllocationCounter.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to count the heap allocations made by the process
+ *
+ * Its translation unit replaces the global operator new and operator delete
+ * so that every allocation made through a new expression or a standard
+ * container increments a process-wide counter (a relaxed atomic increment).
+ * The replacement is linked in as soon as count() is used.
+ *
+ * Deallocations are not counted: what matters is how many times the
+ * allocator is hit.
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class AllocationCounter {
+
+public:
+    /**
+     * @brief A static member function returning the number of allocations
+     *        made so far. Subtract two values to count an interval
+     */
+    static std::size_t count();
+};
+
+}
+
+#endif
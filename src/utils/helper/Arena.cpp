@@ -0,0 +1,78 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+
+#include "Arena.h"
+
+using namespace utils::helper;
+
+namespace {
+
+/* Each thread applies to its own namespace so each has its own arena */
+thread_local std::pmr::memory_resource* currentResource = nullptr;
+
+}
+
+struct Arena::Internal {
+    /* Not value-initialized: the buffer is only written by allocations */
+    const std::unique_ptr<std::byte[]> buffer;
+    std::pmr::monotonic_buffer_resource resource;
+
+    explicit Internal(std::size_t capacity)
+        : buffer(new std::byte[capacity]),
+          resource(buffer.get(), capacity)
+    {}
+};
+
+Arena::Scope::Scope(const Arena& arena) : m_previous(currentResource)
+{
+    currentResource = arena.resource();
+}
+
+Arena::Scope::~Scope()
+{
+    currentResource = m_previous;
+}
+
+Arena::Arena(std::size_t capacity)
+    : m_internal(std::make_unique<Internal>(std::max<std::size_t>(capacity, 1)))
+{}
+
+Arena::~Arena() = default;
+
+std::pmr::memory_resource* Arena::resource() const
+{
+    return &m_internal->resource;
+}
+
+std::pmr::memory_resource* Arena::current()
+{
+    return (currentResource != nullptr) ? currentResource
+                                        : std::pmr::get_default_resource();
+}
@@ -0,0 +1,138 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_HELPER_ARENA_H__
+#define __UTILS_HELPER_ARENA_H__
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace utils::helper {
+
+/**
+ * @class Arena Arena.h "utils/helper/Arena.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class providing a monotonic memory resource backed by a
+ *        buffer allocated once
+ *
+ * Allocations are served by bumping a pointer in the buffer and
+ * deallocations do nothing: the whole memory is released at once when the
+ * arena is destroyed. If the buffer turns out to be too small, further
+ * buffers are taken from the default memory resource so that an arena
+ * never fails; sizing it properly is what keeps the allocator out of the
+ * hot path.
+ *
+ * An arena can be made the current one of the calling thread with a
+ * @ref Scope. This lets deeply nested code such as Parser::parse() use it
+ * without it being threaded through every interface.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://en.cppreference.com/w/cpp/memory/monotonic_buffer_resource
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class Arena {
+
+public:
+    /**
+     * @class Scope
+     *
+     * @brief Make an arena the current one of the calling thread until the
+     *        end of the scope. Scopes can be nested
+     */
+    class Scope {
+
+    public:
+        /** Class constructor */
+        explicit Scope(const Arena& arena);
+
+        /** Class destructor. The previous arena becomes current again */
+        ~Scope();
+
+        /** Class copy constructor */
+        Scope(const Scope&) = delete;
+
+        /** Class copy-assignment operator */
+        Scope& operator=(const Scope&) = delete;
+
+        /** Class move constructor */
+        Scope(Scope&&) = delete;
+
+        /** Class move-assignment operator */
+        Scope& operator=(Scope&&) = delete;
+
+    private:
+        std::pmr::memory_resource* const m_previous;
+    };
+
+    /**
+     * @brief Class constructor
+     *
+     * @param capacity Size in bytes of the buffer allocated upfront
+     */
+    explicit Arena(std::size_t capacity);
+
+    /** Class destructor. Everything allocated from the arena is released */
+    ~Arena();
+
+    /** Class copy constructor */
+    Arena(const Arena&) = delete;
+
+    /** Class copy-assignment operator */
+    Arena& operator=(const Arena&) = delete;
+
+    /** Class move constructor */
+    Arena(Arena&&) = delete;
+
+    /** Class move-assignment operator */
+    Arena& operator=(Arena&&) = delete;
+
+    /** The memory resource allocating from this arena */
+    [[nodiscard]] std::pmr::memory_resource* resource() const;
+
+    /**
+     * @brief A static member function returning the memory resource of the
+     *        current arena of the calling thread or the default memory
+     *        resource when there is none
+     */
+    [[nodiscard]] static std::pmr::memory_resource* current();
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
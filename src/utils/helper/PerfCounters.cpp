@@ -0,0 +1,204 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sstream>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "PerfCounters.h"
+
+using namespace utils::helper;
+
+namespace {
+
+/* Order matters: it is the one of the fields in PerfCounters::Sample */
+constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, 5> EVENTS
+    = {{{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+        {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+        {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CPU_MIGRATIONS}}};
+
+/* glibc does not provide a wrapper for perf_event_open() */
+int openCounter(std::uint32_t type, std::uint64_t config, bool excludeKernel)
+{
+    struct perf_event_attr attr {};
+    attr.size           = sizeof(attr);
+    attr.type           = type;
+    attr.config         = config;
+    attr.disabled       = 1;
+    attr.inherit        = 1;
+    attr.exclude_kernel = excludeKernel ? 1 : 0;
+    attr.exclude_hv     = 1;
+
+    return static_cast<int>(
+        syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+}
+
+}
+
+struct PerfCounters::Internal {
+    std::array<int, EVENTS.size()> fds {};
+
+    Internal()
+    {
+        for (std::size_t index = 0; index < EVENTS.size(); ++index) {
+            const auto& [type, config] = EVENTS[index];
+
+            // Kernel events are the interesting ones (fork, page tables,
+            // netfilter, ...) but perf_event_paranoid >= 2 forbids them
+            int fd = openCounter(type, config, false);
+            if ((fd == -1) && ((errno == EACCES) || (errno == EPERM))) {
+                fd = openCounter(type, config, true);
+            }
+
+            fds[index] = fd;
+        }
+    }
+
+    ~Internal()
+    {
+        for (int fd : fds) {
+            if (fd != -1) {
+                close(fd);
+            }
+        }
+    }
+
+    Internal(const Internal&) = delete;
+    Internal& operator=(const Internal&) = delete;
+    Internal(Internal&&)                 = delete;
+    Internal& operator=(Internal&&) = delete;
+
+    [[nodiscard]] std::int64_t read(std::size_t index) const
+    {
+        std::uint64_t value = 0;
+        if ((fds[index] == -1)
+            || (::read(fds[index], &value, sizeof(value))
+                != static_cast<ssize_t>(sizeof(value)))) {
+            return NOT_AVAILABLE;
+        }
+
+        return static_cast<std::int64_t>(value);
+    }
+};
+
+bool PerfCounters::Sample::isAvailable() const
+{
+    return (cycles != NOT_AVAILABLE) || (instructions != NOT_AVAILABLE)
+           || (contextSwitches != NOT_AVAILABLE) || (pageFaults != NOT_AVAILABLE)
+           || (cpuMigrations != NOT_AVAILABLE);
+}
+
+PerfCounters::Sample& PerfCounters::Sample::operator+=(const Sample& other)
+{
+    auto add = [](std::int64_t& total, std::int64_t value) {
+        if ((total == NOT_AVAILABLE) || (value == NOT_AVAILABLE)) {
+            total = NOT_AVAILABLE;
+        }
+        else {
+            total += value;
+        }
+    };
+
+    add(cycles, other.cycles);
+    add(instructions, other.instructions);
+    add(contextSwitches, other.contextSwitches);
+    add(pageFaults, other.pageFaults);
+    add(cpuMigrations, other.cpuMigrations);
+
+    return *this;
+}
+
+std::string PerfCounters::Sample::toString() const
+{
+    std::ostringstream stream;
+
+    auto print = [&stream](const char* name, std::int64_t value) {
+        stream << name << " ";
+        if (value == NOT_AVAILABLE) {
+            stream << "n/a";
+        }
+        else {
+            stream << value;
+        }
+    };
+
+    print("cycles", cycles);
+    print(", instructions", instructions);
+    print(", context switches", contextSwitches);
+    print(", page faults", pageFaults);
+    print(", cpu migrations", cpuMigrations);
+
+    return stream.str();
+}
+
+PerfCounters::PerfCounters() : m_internal(std::make_unique<Internal>()) {}
+
+PerfCounters::~PerfCounters() = default;
+
+bool PerfCounters::isAvailable() const
+{
+    for (int fd : m_internal->fds) {
+        if (fd != -1) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PerfCounters::start() const
+{
+    for (int fd : m_internal->fds) {
+        if (fd != -1) {
+            (void)ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            (void)ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+PerfCounters::Sample PerfCounters::stop() const
+{
+    for (int fd : m_internal->fds) {
+        if (fd != -1) {
+            (void)ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    return {m_internal->read(0),
+            m_internal->read(1),
+            m_internal->read(2),
+            m_internal->read(3),
+            m_internal->read(4)};
+}
@@ -0,0 +1,129 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __UTILS_HELPER_PERF_COUNTERS_H__
+#define __UTILS_HELPER_PERF_COUNTERS_H__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace utils::helper {
+
+/**
+ * @class PerfCounters PerfCounters.h "utils/helper/PerfCounters.h"
+ * @ingroup Helper
+ *
+ * @brief A helper class to count hardware and software events (cycles,
+ *        instructions, context switches, ...) of the calling thread using
+ *        perf_event_open().
+ *
+ * Counters are inherited by the child processes created while they are
+ * running so that the cost of spawned programs is included. Each counter
+ * is opened on its own: a counter the kernel refuses (missing PMU, too
+ * restrictive perf_event_paranoid, seccomp, ...) is simply reported as
+ * not available instead of making the whole measurement fail. If kernel
+ * events can't be measured, only user space events are counted.
+ *
+ * @note Copy contructor, copy-assignment operator, move constructor and
+ *       move-assignment operator are defined to be compliant with the
+ *       "Rule of five"
+ *
+ * @see https://man7.org/linux/man-pages/man2/perf_event_open.2.html
+ *
+ * @author Boubacar DIENE <boubacar.diene@gmail.com>
+ * @date October 2026
+ */
+class PerfCounters {
+
+public:
+    /** Value of a counter that could not be opened */
+    static constexpr std::int64_t NOT_AVAILABLE = -1;
+
+    /**
+     * @struct Sample
+     *
+     * @brief Events counted between start() and stop(). A field is set to
+     *        @ref NOT_AVAILABLE when the related counter could not be opened
+     */
+    struct Sample {
+        std::int64_t cycles;          /**< CPU cycles */
+        std::int64_t instructions;    /**< Retired instructions */
+        std::int64_t contextSwitches; /**< Context switches */
+        std::int64_t pageFaults;      /**< Page faults */
+        std::int64_t cpuMigrations;   /**< Migrations to another CPU */
+
+        /** Tell whether at least one field holds a counted value */
+        [[nodiscard]] bool isAvailable() const;
+
+        /** Add "other" to this sample; unavailable counters stay so */
+        Sample& operator+=(const Sample& other);
+
+        /** Human-readable representation of this sample */
+        [[nodiscard]] std::string toString() const;
+    };
+
+    /** Class constructor. Counters are opened but not started */
+    PerfCounters();
+
+    /** Class destructor */
+    ~PerfCounters();
+
+    /** Class copy constructor */
+    PerfCounters(const PerfCounters&) = delete;
+
+    /** Class copy-assignment operator */
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /** Class move constructor */
+    PerfCounters(PerfCounters&&) = delete;
+
+    /** Class move-assignment operator */
+    PerfCounters& operator=(PerfCounters&&) = delete;
+
+    /** Tell whether at least one counter could be opened */
+    [[nodiscard]] bool isAvailable() const;
+
+    /** Reset and start all available counters */
+    void start() const;
+
+    /**
+     * @brief Stop all available counters
+     *
+     * @return The events counted since the last call to start()
+     */
+    [[nodiscard]] Sample stop() const;
+
+private:
+    struct Internal;
+    std::unique_ptr<Internal> m_internal;
+};
+
+}
+
+#endif
@@ -0,0 +1,95 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <json.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "generator/ConfigGenerator.h"
+
+using json = nlohmann::json;
+
+using namespace benchmarking;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ConfigGeneratorTestSuite, generateAValidConfigurationOfTheRequestedSize)
+{
+    const ConfigGenerator generator({4, 3, 50, 2}, "/tmp/layer");
+
+    std::stringstream stream;
+    generator.writeJson(stream);
+    const json config = json::parse(stream.str());
+
+    const json& network = config.at("network");
+    ASSERT_EQ(network.at("interfaceNames"), json::array({"lo"}));
+    ASSERT_EQ(network.at("interfaceCommands").size(),
+              4 * ConfigGenerator::COMMANDS_PER_INTERFACE);
+    ASSERT_EQ(network.at("layerCommands").size(), 3);
+    ASSERT_EQ(network.at("layerCommands")[0].at("pathname"), "/tmp/layer");
+
+    // Rule commands must not be duplicates that optimizers would drop
+    std::set<std::string> commands;
+    ASSERT_EQ(config.at("rules").size(), 50);
+    for (const json& rule : config.at("rules")) {
+        ASSERT_EQ(rule.at("commands").size(), 2);
+        for (const json& command : rule.at("commands")) {
+            commands.insert(command.get<std::string>());
+        }
+    }
+    ASSERT_EQ(commands.size(), 100);
+
+    ASSERT_EQ(generator.nbCommands(), 4 * 3 + 3 + 50 * 2);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ConfigGeneratorTestSuite, generateEmptySections)
+{
+    const ConfigGenerator generator({0, 0, 0, 0});
+
+    std::stringstream stream;
+    generator.writeJson(stream);
+    const json config = json::parse(stream.str());
+
+    ASSERT_TRUE(config.at("network").at("interfaceCommands").empty());
+    ASSERT_TRUE(config.at("network").at("layerCommands").empty());
+    ASSERT_TRUE(config.at("rules").empty());
+    ASSERT_EQ(generator.nbCommands(), 0);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
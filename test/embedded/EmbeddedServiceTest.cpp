@@ -0,0 +1,145 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdlib>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "mocks/MockLogger.h"
+#include "mocks/MockNetwork.h"
+#include "mocks/MockRule.h"
+#include "mocks/MockRuleFactory.h"
+
+#include "embedded/EmbeddedService.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using namespace service;
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::logger;
+using namespace service::plugins::network;
+
+namespace {
+
+class EmbeddedServiceTestFixture : public ::testing::Test {
+
+protected:
+    EmbeddedServiceTestFixture()
+    {
+        // Root privileges are not required when the network and firewall
+        // plugins are replaced
+        m_options.secure      = false;
+        m_options.logger      = &m_mockLogger;
+        m_options.network     = &m_mockNetwork;
+        m_options.ruleFactory = &m_mockRuleFactory;
+
+        ON_CALL(m_mockRuleFactory, createRule).WillByDefault([]() {
+            return std::make_unique<NiceMock<MockRule>>();
+        });
+    }
+
+    NiceMock<MockLogger> m_mockLogger;
+    NiceMock<MockNetwork> m_mockNetwork;
+    NiceMock<MockRuleFactory> m_mockRuleFactory;
+    EmbeddedService::Options m_options;
+
+    const ConfigData m_configData
+        = {{{"eth0"}, {"/sbin/ip link set eth0 up"}, {}},
+           {{"rule1", {"/sbin/iptables -P INPUT DROP"}}}};
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(EmbeddedServiceTestFixture, applyConfigBuiltInMemoryWithCustomPlugins)
+{
+    const EmbeddedService embeddedService(m_options);
+
+    EXPECT_CALL(m_mockNetwork, hasInterface("eth0")).WillOnce(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands(
+                                   m_configData.network.interfaceCommands));
+    EXPECT_CALL(m_mockRuleFactory, createRule("rule1", _, _));
+
+    const NetworkService::Result result = embeddedService.apply(m_configData);
+
+    ASSERT_TRUE(result.succeeded);
+    ASSERT_TRUE(result.error.empty());
+    ASSERT_FALSE(result.rolledBack);
+    ASSERT_EQ(result.nbRules, 1u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(EmbeddedServiceTestFixture, tellWhyApplyingHasFailed)
+{
+    const EmbeddedService embeddedService(m_options);
+
+    EXPECT_CALL(m_mockNetwork, hasInterface("eth0")).WillOnce(Return(false));
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).Times(0);
+
+    const NetworkService::Result result = embeddedService.apply(m_configData);
+
+    ASSERT_FALSE(result.succeeded);
+    ASSERT_EQ(result.error, "NetworkService: No valid interface found for: eth0");
+    ASSERT_TRUE(result.rolledBack);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(EmbeddedServiceTestFixture, loadConfigFilesWithTheDefaultConfigPlugin)
+{
+    const EmbeddedService embeddedService(m_options);
+    const std::string configFile = testing::TempDir() + "EmbeddedServiceTest.json";
+
+    std::ofstream(configFile) << R"({
+        "network": {
+            "interfaceNames": ["lo"],
+            "interfaceCommands": [],
+            "layerCommands": []
+        },
+        "rules": [ { "name": "rule1", "commands": ["/bin/true"] } ]
+    })";
+
+    EXPECT_CALL(m_mockNetwork, hasInterface("lo")).WillOnce(Return(true));
+    EXPECT_CALL(m_mockRuleFactory, createRule("rule1", _, _));
+
+    const NetworkService::Result result = embeddedService.apply(configFile);
+
+    ASSERT_TRUE(result.succeeded);
+    ASSERT_EQ(result.nbRules, 1u);
+
+    ASSERT_FALSE(embeddedService.apply("/nonexistent.json").succeeded);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -61,6 +61,13 @@ public:
                 load,
                 (const std::string& configFile),
                 (const, override));
+
+    MOCK_METHOD(void,
+                stream,
+                (const std::string& configFile,
+                 const NetworkHandler& onNetwork,
+                 const RuleHandler& onRule),
+                (const, override));
 };
 
 }
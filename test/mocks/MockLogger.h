@@ -56,11 +56,18 @@ public:
     /** Class move-assignment operator */
     MockLogger& operator=(MockLogger&&) = delete;
 
+    /** Lazy overloads */
+    using ILogger::debug;
+    using ILogger::error;
+    using ILogger::info;
+    using ILogger::warn;
+
     /** Mocks */
     MOCK_METHOD(void, debug, (const std::string& message), (const, override));
     MOCK_METHOD(void, info, (const std::string& message), (const, override));
     MOCK_METHOD(void, warn, (const std::string& message), (const, override));
     MOCK_METHOD(void, error, (const std::string& message), (const, override));
+    MOCK_METHOD(bool, isEnabled, (Level level), (const, override));
 };
 
 }
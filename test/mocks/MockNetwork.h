@@ -71,6 +71,10 @@ public:
                     service::plugins::config::ConfigData::Network::LayerCommand>&
                      layerCommands),
                 (const, override));
+    MOCK_METHOD(void,
+                joinNamespace,
+                (const std::string& namespacePath),
+                (const, override));
 };
 
 }
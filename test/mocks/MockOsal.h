@@ -58,7 +58,7 @@ public:
 
     /** Mocks */
     MOCK_METHOD(ProcessId, createProcess, (), (const, override));
-    MOCK_METHOD(void, waitChildProcess, (), (const, override));
+    MOCK_METHOD(ResourceUsage, waitChildProcess, (), (const, override));
     MOCK_METHOD(void,
                 executeProgram,
                 (const char* pathname, char* const argv[], char* const envp[]),
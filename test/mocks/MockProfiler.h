@@ -0,0 +1,66 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __TEST_MOCKS_MOCK_PROFILER_H__
+#define __TEST_MOCKS_MOCK_PROFILER_H__
+
+#include "gmock/gmock.h"
+
+#include "service/plugins/IProfiler.h"
+
+namespace service::plugins::profiler {
+
+class MockProfiler : public IProfiler {
+
+public:
+    /** Class constructor */
+    MockProfiler();
+
+    /** Class destructor */
+    ~MockProfiler() override;
+
+    /** Copy constructor */
+    MockProfiler(const MockProfiler&) = delete;
+
+    /** Class copy-assignment operator */
+    MockProfiler& operator=(const MockProfiler&) = delete;
+
+    /** Class move constructor */
+    MockProfiler(MockProfiler&&) = delete;
+
+    /** Class move-assignment operator */
+    MockProfiler& operator=(MockProfiler&&) = delete;
+
+    /** Mocks */
+    MOCK_METHOD(void, startPhase, (const std::string& phaseName), (const, override));
+    MOCK_METHOD(void, stopPhase, (const std::string& phaseName), (const, override));
+};
+
+}
+
+#endif
@@ -0,0 +1,69 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#ifndef __TEST_MOCKS_MOCK_REORDERER_H__
+#define __TEST_MOCKS_MOCK_REORDERER_H__
+
+#include "gmock/gmock.h"
+
+#include "service/plugins/IReorderer.h"
+
+namespace service::plugins::reorderer {
+
+class MockReorderer : public IReorderer {
+
+public:
+    /** Class constructor */
+    MockReorderer();
+
+    /** Class destructor */
+    ~MockReorderer() override;
+
+    /** Copy constructor */
+    MockReorderer(const MockReorderer&) = delete;
+
+    /** Class copy-assignment operator */
+    MockReorderer& operator=(const MockReorderer&) = delete;
+
+    /** Class move constructor */
+    MockReorderer(MockReorderer&&) = delete;
+
+    /** Class move-assignment operator */
+    MockReorderer& operator=(MockReorderer&&) = delete;
+
+    /** Mocks */
+    MOCK_METHOD(void,
+                prepare,
+                (const service::plugins::config::ConfigData& configData),
+                (const, override));
+    MOCK_METHOD(void, reorder, (), (const, override));
+};
+
+}
+
+#endif
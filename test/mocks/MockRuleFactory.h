@@ -59,7 +59,9 @@ public:
     /** Mocks */
     MOCK_METHOD(std::unique_ptr<IRule>,
                 createRule,
-                (const std::string& name, const std::vector<std::string>& commands),
+                (const std::string& name,
+                 const std::vector<std::string>& commands,
+                 const std::vector<config::ConfigData::Rule::AddressSet>& sets),
                 (const, override));
 };
 
@@ -90,6 +90,31 @@ TEST_F(FakeConfigTestFixture, shouldNotGenerateTrueCommands)
     }
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FakeConfigTestFixture, shouldStreamTheDataItLoads)
+{
+    auto configData = m_fakeConfig.load("/fake/path/to/file");
+    std::size_t nbNetworks = 0;
+    std::vector<std::string> ruleNames;
+
+    m_fakeConfig.stream(
+        "/fake/path/to/file",
+        [&nbNetworks, &ruleNames](const ConfigData::Network& network) {
+            ASSERT_TRUE(ruleNames.empty());
+            ASSERT_EQ(network.interfaceNames, std::vector<std::string>({"lo"}));
+            ++nbNetworks;
+        },
+        [&ruleNames](const ConfigData::Rule& rule) {
+            ruleNames.push_back(rule.name);
+        });
+
+    ASSERT_EQ(nbNetworks, 1u);
+    ASSERT_EQ(ruleNames.size(), configData->rules.size());
+    for (std::size_t index = 0; index < ruleNames.size(); ++index) {
+        ASSERT_EQ(ruleNames[index], configData->rules[index].name);
+    }
+}
+
 }
 
 int main(int argc, char** argv)
@@ -26,12 +26,17 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <fstream>
+#include <stdexcept>
+
 #include "gtest/gtest.h"
 
 #include "mocks/MockReader.h"
 
 #include "plugins/config/Config.h"
 
+#include "utils/file/temporary/TemporaryFile.h"
+
 using ::testing::_;
 
 using namespace service::plugins::config;
@@ -44,6 +49,30 @@ class JsonConfigTestFixture : public ::testing::Test {
 protected:
     JsonConfigTestFixture() : m_jsonConfig(m_mockReader) {}
 
+    /* Stream the given content and return the rule names in the order
+     * they have been handed over */
+    std::vector<std::string> stream(const char* configFileContent,
+                                    ConfigData::Network* network = nullptr)
+    {
+        const TemporaryFile configFile;
+        std::ofstream(configFile.pathname()) << configFileContent;
+
+        std::vector<std::string> ruleNames;
+        m_jsonConfig.stream(
+            configFile.pathname(),
+            [&ruleNames, network](ConfigData::Network networkData) {
+                EXPECT_TRUE(ruleNames.empty());
+                if (network != nullptr) {
+                    *network = std::move(networkData);
+                }
+            },
+            [&ruleNames](const ConfigData::Rule& rule) {
+                ruleNames.push_back(rule.name);
+            });
+
+        return ruleNames;
+    }
+
     MockReader m_mockReader;
     Config m_jsonConfig;
 };
@@ -223,6 +252,134 @@ TEST_F(JsonConfigTestFixture, shouldNotSetRulesIfRulesSectionIsMissing)
     ASSERT_EQ(configData->rules.size(), 0);
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(JsonConfigTestFixture, shouldReadAddressSetsWithTheirDefaults)
+{
+    const std::string configFile("/dev/null");
+
+    EXPECT_CALL(m_mockReader, readFromStream(_, _))
+        .WillOnce([]([[maybe_unused]] std::istream& stream, std::string& result) {
+            const char* configFileContent
+                = "{"
+                  "    \"network\": {"
+                  "        \"interfaceNames\": [],"
+                  "        \"interfaceCommands\": [],"
+                  "        \"layerCommands\": []"
+                  "    },"
+
+                  "    \"rules\": ["
+                  "        {"
+                  "            \"name\": \"blocklist\","
+                  "            \"sets\": ["
+                  "                {"
+                  "                    \"name\": \"bad4\","
+                  "                    \"file\": \"/etc/bad4.txt\""
+                  "                },"
+                  "                {"
+                  "                    \"name\": \"bad6\","
+                  "                    \"file\": \"/etc/bad6.txt\","
+                  "                    \"family\": \"inet6\","
+                  "                    \"backend\": \"nft\","
+                  "                    \"table\": \"ip6 filter\""
+                  "                }"
+                  "            ],"
+                  "            \"commands\": ["
+                  "                \"/sbin/iptables -A INPUT -m set "
+                  "--match-set bad4 src -j DROP\""
+                  "            ]"
+                  "        }"
+                  "    ]"
+                  "}";
+            result.assign(configFileContent);
+        });
+
+    auto configData = m_jsonConfig.load(configFile);
+
+    ASSERT_NE(configData, nullptr);
+    ASSERT_EQ(configData->rules.size(), 1);
+
+    const auto& sets = configData->rules[0].sets;
+    ASSERT_EQ(sets.size(), 2);
+    ASSERT_EQ(sets[0].name, "bad4");
+    ASSERT_EQ(sets[0].file, "/etc/bad4.txt");
+    ASSERT_EQ(sets[0].family, "inet");
+    ASSERT_EQ(sets[0].backend, "ipset");
+    ASSERT_EQ(sets[1].name, "bad6");
+    ASSERT_EQ(sets[1].family, "inet6");
+    ASSERT_EQ(sets[1].backend, "nft");
+    ASSERT_EQ(sets[1].table, "ip6 filter");
+}
+
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(JsonConfigTestFixture, shouldStreamNetworkThenRulesInOrder)
+{
+    ConfigData::Network network;
+
+    EXPECT_CALL(m_mockReader, readFromStream(_, _)).Times(0);
+
+    auto ruleNames = stream("{"
+                            "    \"network\": {"
+                            "        \"interfaceNames\": [\"lo\"],"
+                            "        \"interfaceCommands\": [\"/sbin/ip link\"],"
+                            "        \"layerCommands\": ["
+                            "            {\"pathname\": \"/a\", \"value\": \"0\"}"
+                            "        ]"
+                            "    },"
+                            "    \"rules\": ["
+                            "        {\"name\": \"rule 1\", \"commands\": [\"c1\"]},"
+                            "        {\"name\": \"rule 2\", \"commands\": [\"c2\"]},"
+                            "        {\"name\": \"rule 3\", \"commands\": [\"c3\"]}"
+                            "    ]"
+                            "}",
+                            &network);
+
+    ASSERT_EQ(network.interfaceNames, std::vector<std::string>({"lo"}));
+    ASSERT_EQ(network.interfaceCommands,
+              std::vector<std::string>({"/sbin/ip link"}));
+    ASSERT_EQ(network.layerCommands.size(), 1);
+    ASSERT_EQ(network.layerCommands[0].pathname, "/a");
+    ASSERT_EQ(ruleNames, std::vector<std::string>({"rule 1", "rule 2", "rule 3"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(JsonConfigTestFixture, shouldNotStreamRulesIfLayerCommandsSectionIsMissing)
+{
+    auto ruleNames = stream("{"
+                            "    \"network\": {"
+                            "        \"interfaceNames\": [],"
+                            "        \"interfaceCommands\": []"
+                            "    },"
+                            "    \"rules\": ["
+                            "        {\"name\": \"rule 1\", \"commands\": [\"c1\"]}"
+                            "    ]"
+                            "}");
+
+    ASSERT_TRUE(ruleNames.empty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(JsonConfigTestFixture, shouldRaiseAnExceptionIfRulesComeBeforeNetwork)
+{
+    ASSERT_THROW(stream("{"
+                        "    \"rules\": [],"
+                        "    \"network\": {"
+                        "        \"interfaceNames\": [],"
+                        "        \"interfaceCommands\": [],"
+                        "        \"layerCommands\": []"
+                        "    }"
+                        "}"),
+                 std::invalid_argument);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(JsonConfigTestFixture, shouldRaiseAnExceptionIfStreamedConfigIsInvalid)
+{
+    ASSERT_THROW(stream("{}"), std::invalid_argument);
+    ASSERT_ANY_THROW(stream("{\"network\": {}}"));
+    ASSERT_ANY_THROW(stream("{\"network\": "));
+}
+
 }
 
 int main(int argc, char** argv)
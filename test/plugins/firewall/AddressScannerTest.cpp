@@ -0,0 +1,122 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <arpa/inet.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/firewall/set/AddressScanner.h"
+
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+using namespace service::plugins::firewall::set;
+
+namespace {
+
+std::vector<std::string> scan(std::string_view content, int family)
+{
+    AddressScanner scanner(content, family);
+
+    std::vector<std::string> addresses;
+    std::string_view address;
+    while (scanner.next(address)) {
+        addresses.emplace_back(address);
+    }
+
+    return addresses;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AddressScannerTestSuite, skipBlankLinesCommentsAndWhitespaces)
+{
+    const std::string_view content = "# Blocklist\n"
+                                     "10.0.0.1\n"
+                                     "\n"
+                                     "  192.168.0.0/16\t# Private\r\n"
+                                     "   \n"
+                                     "172.16.0.0/12";
+
+    ASSERT_THAT(scan(content, AF_INET),
+                ElementsAre("10.0.0.1", "192.168.0.0/16", "172.16.0.0/12"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AddressScannerTestSuite, acceptIpv6Addresses)
+{
+    ASSERT_THAT(scan("2001:db8::/32\n::1\nfe80::1/128\n", AF_INET6),
+                ElementsAre("2001:db8::/32", "::1", "fe80::1/128"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AddressScannerTestSuite, returnNothingForAnEmptyBuffer)
+{
+    ASSERT_TRUE(scan("", AF_INET).empty());
+    ASSERT_TRUE(scan("\n\n# Nothing\n", AF_INET).empty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AddressScannerTestSuite, throwOnInvalidAddressesWithTheirLineNumber)
+{
+    const std::vector<std::string> invalidEntries = {
+        "10.0.0.256",   "10.0.0.0/33", "10.0.0.0/",  "10.0.0.0/a",
+        "example.com",  "::1",         "10.0.0.1 2", "10.0.0.0/0008",
+        "10.0.0.0/0",   "10.0.0.0/00"};
+
+    for (const std::string& entry : invalidEntries) {
+        const std::string content = "10.0.0.1\n" + entry + "\n";
+        AddressScanner scanner(content, AF_INET);
+
+        std::string_view address;
+        ASSERT_TRUE(scanner.next(address));
+        try {
+            (void)scanner.next(address);
+            FAIL() << entry;
+        }
+        catch (const std::invalid_argument& e) {
+            ASSERT_THAT(e.what(), HasSubstr("line 2: " + entry));
+        }
+    }
+
+    ASSERT_THROW(scan("10.0.0.1", AF_INET6), std::invalid_argument);
+    ASSERT_THROW(scan("::/0", AF_INET6), std::invalid_argument);
+    ASSERT_THROW(AddressScanner("", AF_UNIX), std::invalid_argument);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
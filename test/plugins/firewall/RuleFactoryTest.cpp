@@ -32,6 +32,9 @@
 
 #include "plugins/firewall/RuleFactory.h"
 
+using ::testing::_;
+
+using namespace service::plugins::config;
 using namespace service::plugins::firewall;
 using namespace utils::command;
 
@@ -51,8 +54,56 @@ TEST_F(RuleFactoryTestFixture, createRuleShouldReturnAValidPointer)
 {
     const std::string name("name");
     const std::vector<std::string> commands = {"command1", "command2"};
+    const std::vector<ConfigData::Rule::AddressSet> sets;
+
+    ASSERT_NE(m_ruleFactory.createRule(name, commands, sets), nullptr);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(RuleFactoryTestFixture, storeTokensOnceForRulesAliveAtTheSameTime)
+{
+    const std::string name("name");
+    const std::vector<ConfigData::Rule::AddressSet> sets;
+
+    const std::unique_ptr<IRule> first
+        = m_ruleFactory.createRule(name, {"/sbin/iptables -A INPUT -j DROP"}, sets);
+    const std::unique_ptr<IRule> second
+        = m_ruleFactory.createRule(name, {"/sbin/iptables -A OUTPUT -j DROP"}, sets);
+
+    std::vector<const char*> pathnames;
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .Times(2)
+        .WillRepeatedly([&pathnames](const IExecutor::ProgramParams& params) {
+            pathnames.push_back(params.pathname);
+        });
+
+    first->applyCommands();
+    second->applyCommands();
+
+    ASSERT_EQ(pathnames.size(), 2);
+    ASSERT_EQ(pathnames[0], pathnames[1]);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(RuleFactoryTestFixture, applyRuleOnceItsCommandsAreReleased)
+{
+    const std::string name("name");
+    const std::vector<ConfigData::Rule::AddressSet> sets;
+
+    auto commands = std::make_unique<std::vector<std::string>>(
+        std::vector<std::string>{"/sbin/iptables -A INPUT -j DROP"});
+    const std::unique_ptr<IRule> rule
+        = m_ruleFactory.createRule(name, *commands, sets);
+    commands.reset();
+
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/sbin/iptables");
+            ASSERT_STREQ(params.argv[4], "DROP");
+            ASSERT_EQ(params.argv[5], nullptr);
+        });
 
-    ASSERT_NE(m_ruleFactory.createRule(name, commands), nullptr);
+    rule->applyCommands();
 }
 
 }
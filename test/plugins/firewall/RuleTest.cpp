@@ -26,17 +26,23 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <fstream>
+
 #include "gtest/gtest.h"
 
 #include "mocks/MockExecutor.h"
 
 #include "plugins/firewall/Rule.h"
 #include "utils/command/parser/Parser.h"
+#include "utils/command/table/CommandTable.h"
+#include "utils/file/temporary/TemporaryFile.h"
 
 using ::testing::_;
 
+using namespace service::plugins::config;
 using namespace service::plugins::firewall;
 using namespace utils::command;
+using namespace utils::file;
 
 namespace {
 
@@ -44,6 +50,8 @@ class RuleTestFixture : public ::testing::Test {
 
 protected:
     MockExecutor m_mockExecutor;
+    std::shared_ptr<CommandTable> m_table = std::make_shared<CommandTable>();
+    std::vector<ConfigData::Rule::AddressSet> m_sets;
 };
 
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
@@ -52,7 +60,7 @@ TEST_F(RuleTestFixture, shouldCallExecutorTwice)
     const std::string name("name");
     const std::vector<std::string> commands = {"command1", "command2"};
 
-    Rule rule(name, commands, m_mockExecutor);
+    Rule rule(name, commands, m_sets, m_mockExecutor, m_table);
 
     EXPECT_CALL(m_mockExecutor, executeProgram(_)).Times(2);
     rule.applyCommands();
@@ -64,7 +72,7 @@ TEST_F(RuleTestFixture, shouldCallExecutorWithExpectedValues)
     const std::string name("name");
     const std::vector<std::string> commands = {"command"};
 
-    Rule rule(name, commands, m_mockExecutor);
+    Rule rule(name, commands, m_sets, m_mockExecutor, m_table);
 
     // Parser is deterministic meaning that for the same input, it will
     // always produce the same output so it's fine using it.
@@ -82,6 +90,61 @@ TEST_F(RuleTestFixture, shouldCallExecutorWithExpectedValues)
     rule.applyCommands();
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(RuleTestFixture, storeCommandsInTheGivenTable)
+{
+    const std::string name("name");
+    const std::vector<std::string> commands
+        = {"/sbin/iptables -A INPUT -j DROP", "/sbin/iptables -A OUTPUT -j DROP"};
+
+    Rule rule(name, commands, m_sets, m_mockExecutor, m_table);
+
+    ASSERT_EQ(m_table->size(), 2);
+    ASSERT_EQ(m_table->nbTokens(), 6);
+
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .WillOnce([this](const IExecutor::ProgramParams& params) {
+            ASSERT_EQ(params.argv, m_table->argv(0));
+            ASSERT_STREQ(params.pathname, "/sbin/iptables");
+            ASSERT_STREQ(params.label, "name");
+        })
+        .WillOnce([this](const IExecutor::ProgramParams& params) {
+            ASSERT_EQ(params.argv, m_table->argv(1));
+        });
+
+    rule.applyCommands();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(RuleTestFixture, shouldLoadSetsBeforeApplyingCommands)
+{
+    const TemporaryFile file;
+    {
+        std::ofstream stream(file.pathname());
+        stream << "10.0.0.1\n";
+    }
+
+    const std::string name("name");
+    const std::vector<std::string> commands
+        = {"/sbin/iptables -A INPUT -m set --match-set blocklist src -j DROP"};
+    m_sets.push_back({"blocklist", file.pathname()});
+
+    Rule rule(name, commands, m_sets, m_mockExecutor, m_table);
+
+    ::testing::InSequence sequence;
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/sbin/ipset");
+            ASSERT_STREQ(params.label, "name");
+        });
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/sbin/iptables");
+        });
+
+    rule.applyCommands();
+}
+
 }
 
 int main(int argc, char** argv)
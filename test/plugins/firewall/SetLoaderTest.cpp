@@ -0,0 +1,247 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockExecutor.h"
+
+#include "plugins/firewall/set/SetLoader.h"
+#include "utils/file/temporary/TemporaryFile.h"
+
+using ::testing::_;
+using ::testing::DoDefault;
+using ::testing::ElementsAre;
+
+using namespace service::plugins::config;
+using namespace service::plugins::firewall::set;
+using namespace utils::command;
+using namespace utils::file;
+
+namespace {
+
+class SetLoaderTestFixture : public ::testing::Test {
+
+protected:
+    SetLoaderTestFixture()
+    {
+        ON_CALL(m_mockExecutor, executeProgram(_))
+            .WillByDefault([this](const IExecutor::ProgramParams& params) {
+                record(params);
+            });
+    }
+
+    // Keep the command line and the content of each loaded batch
+    void record(const IExecutor::ProgramParams& params)
+    {
+        std::string command;
+        std::string batchFile;
+        for (char* const* arg = params.argv; *arg != nullptr; ++arg) {
+            const std::size_t last = command.rfind(' ') + 1;
+            if ((command.substr(last) == "-f")
+                || (command.substr(last) == "-file")) {
+                batchFile = *arg;
+            }
+            command += std::string(command.empty() ? "" : " ") + *arg;
+        }
+        m_commands.push_back(command);
+
+        std::ifstream stream(batchFile);
+        std::stringstream content;
+        content << stream.rdbuf();
+        m_batches.push_back(content.str());
+    }
+
+    void writeAddresses(const std::string& content) const
+    {
+        std::ofstream stream(m_file.pathname());
+        stream << content;
+    }
+
+    ::testing::NiceMock<MockExecutor> m_mockExecutor;
+    const TemporaryFile m_file;
+
+    std::vector<std::string> m_commands;
+    std::vector<std::string> m_batches;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, loadIpsetInBoundedBatches)
+{
+    writeAddresses("10.0.0.1\n# comment\n10.0.1.0/24\n10.0.2.0/24\n");
+    const ConfigData::Rule::AddressSet set {"blocklist", m_file.pathname()};
+    const SetLoader loader(m_mockExecutor, 2);
+
+    ASSERT_EQ(loader.load(set, "rule"), 3);
+
+    ASSERT_EQ(m_commands.size(), 2);
+    ASSERT_EQ(m_commands[0].rfind("/sbin/ipset -exist -file /tmp/", 0), 0);
+    ASSERT_EQ(m_commands[0].substr(m_commands[0].size() - 8), " restore");
+    ASSERT_THAT(m_batches,
+                ElementsAre("create blocklist.tmp hash:net family inet hashsize "
+                            "1024 maxelem 65536\n"
+                            "flush blocklist.tmp\n"
+                            "add blocklist.tmp 10.0.0.1\n"
+                            "add blocklist.tmp 10.0.1.0/24\n",
+                            "add blocklist.tmp 10.0.2.0/24\n"
+                            "swap blocklist.tmp blocklist\n"
+                            "destroy blocklist.tmp\n"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, sizeIpsetsFromTheirNumberOfAddresses)
+{
+    std::string content;
+    for (std::size_t index = 0; index < 70000; ++index) {
+        content += "10." + std::to_string(index / 65536) + "."
+                   + std::to_string((index / 256) % 256) + "."
+                   + std::to_string(index % 256) + "\n";
+    }
+    writeAddresses(content);
+    const ConfigData::Rule::AddressSet set {"blocklist", m_file.pathname()};
+    const SetLoader loader(m_mockExecutor, 70000);
+
+    ASSERT_EQ(loader.load(set, "rule"), 70000);
+
+    ASSERT_EQ(m_batches.size(), 1);
+    ASSERT_EQ(m_batches[0].rfind("create blocklist.tmp hash:net family inet "
+                                 "hashsize 131072 maxelem 131072\n",
+                                 0),
+              0);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, renameTheTemporaryIpsetWhenTheSetDoesNotExist)
+{
+    writeAddresses("10.0.0.1\n");
+    const ConfigData::Rule::AddressSet set {"blocklist", m_file.pathname()};
+    const SetLoader loader(m_mockExecutor);
+
+    // The swap fails since there is no set to swap with yet
+    EXPECT_CALL(m_mockExecutor, executeProgram(_))
+        .WillOnce([this](const IExecutor::ProgramParams& params) {
+            record(params);
+            throw std::runtime_error("The set with the given name does not exist");
+        })
+        .WillOnce(DoDefault());
+
+    ASSERT_EQ(loader.load(set, "rule"), 1);
+
+    ASSERT_THAT(m_batches,
+                ElementsAre("create blocklist.tmp hash:net family inet hashsize "
+                            "1024 maxelem 65536\n"
+                            "flush blocklist.tmp\n"
+                            "add blocklist.tmp 10.0.0.1\n"
+                            "swap blocklist.tmp blocklist\n"
+                            "destroy blocklist.tmp\n",
+                            "rename blocklist.tmp blocklist\n"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, loadNftSetsInASingleTransaction)
+{
+    writeAddresses("2001:db8::/32\n::1\nfe80::/10\n");
+    const ConfigData::Rule::AddressSet set {
+        "blocklist6", m_file.pathname(), "inet6", "nft", "ip6 filter"};
+    const SetLoader loader(m_mockExecutor, 2);
+
+    ASSERT_EQ(loader.load(set, "rule"), 3);
+
+    ASSERT_EQ(m_commands.size(), 1);
+    ASSERT_EQ(m_commands[0].rfind("/usr/sbin/nft -f /tmp/", 0), 0);
+    ASSERT_THAT(m_batches,
+                ElementsAre("add table ip6 filter\n"
+                            "add set ip6 filter blocklist6 { type ipv6_addr; "
+                            "flags interval; auto-merge; }\n"
+                            "flush set ip6 filter blocklist6\n"
+                            "add element ip6 filter blocklist6 { 2001:db8::/32,\n"
+                            "::1 }\n"
+                            "add element ip6 filter blocklist6 { fe80::/10 }\n"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, emptyTheSetWhenTheFileHasNoAddress)
+{
+    writeAddresses("# Nothing to block\n");
+    const ConfigData::Rule::AddressSet set {"blocklist", m_file.pathname()};
+    const SetLoader loader(m_mockExecutor, 1);
+
+    ASSERT_EQ(loader.load(set, "rule"), 0);
+
+    ASSERT_THAT(m_batches,
+                ElementsAre("create blocklist.tmp hash:net family inet hashsize "
+                            "1024 maxelem 65536\n"
+                            "flush blocklist.tmp\n"
+                            "swap blocklist.tmp blocklist\n"
+                            "destroy blocklist.tmp\n"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SetLoaderTestFixture, rejectInvalidSetsAndFiles)
+{
+    writeAddresses("10.0.0.1\n");
+    const SetLoader loader(m_mockExecutor);
+
+    const std::vector<ConfigData::Rule::AddressSet> invalidSets = {
+        {"", m_file.pathname()},
+        {"block list", m_file.pathname()},
+        {"a-blocklist-name-of-28-chars", m_file.pathname()},
+        {"blocklist", m_file.pathname(), "inet4"},
+        {"blocklist", m_file.pathname(), "inet", "iptables"},
+        {"blocklist", m_file.pathname(), "inet", "nft", "inet filter; flush"},
+        {"blocklist", m_file.pathname(), "inet6"}};
+
+    for (const ConfigData::Rule::AddressSet& set : invalidSets) {
+        ASSERT_THROW((void)loader.load(set, "rule"), std::invalid_argument);
+    }
+
+    ASSERT_THROW((void)loader.load({"blocklist", "/nonexistent"}, "rule"),
+                 std::runtime_error);
+
+    // Nothing is loaded when an address is invalid, even in a later batch
+    writeAddresses("10.0.0.1\n10.0.0.0/0\n");
+    ASSERT_THROW((void)SetLoader(m_mockExecutor, 1)
+                     .load({"blocklist", m_file.pathname()}, "rule"),
+                 std::invalid_argument);
+    ASSERT_TRUE(m_commands.empty());
+    ASSERT_THROW(SetLoader(m_mockExecutor, 0), std::invalid_argument);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
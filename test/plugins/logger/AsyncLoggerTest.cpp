@@ -0,0 +1,181 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/logger/Logger.h"
+
+using ::testing::HasSubstr;
+
+using namespace service::plugins::logger;
+
+namespace {
+
+class AsyncLoggerTestFixture : public ::testing::Test {
+
+protected:
+    /* Run "logSomething" with "fd" redirected to a temporary file and
+     * return what has been written to it. The logger is destroyed before
+     * reading so that all pending records are flushed */
+    template<typename Function>
+    static std::string capture(int fd, Function&& logSomething)
+    {
+        std::FILE* file = std::tmpfile();
+        EXPECT_NE(file, nullptr);
+
+        const int savedFd = dup(fd);
+        EXPECT_NE(dup2(fileno(file), fd), -1);
+
+        {
+            const Logger logger;
+            logSomething(logger);
+        }
+
+        EXPECT_NE(dup2(savedFd, fd), -1);
+        close(savedFd);
+
+        std::ostringstream content;
+        std::rewind(file);
+        for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) {
+            content << static_cast<char>(c);
+        }
+        std::fclose(file);
+
+        return content.str();
+    }
+};
+
+#ifndef NDEBUG
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, debugLogShouldContainProvidedMessage)
+{
+    std::string message = "A test to print debug message";
+
+    EXPECT_THAT(capture(STDOUT_FILENO,
+                        [&message](const Logger& logger) { logger.debug(message); }),
+                HasSubstr(message));
+}
+#endif
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, infoLogShouldContainProvidedMessage)
+{
+    std::string message = "A test to print info message";
+
+    EXPECT_THAT(capture(STDOUT_FILENO,
+                        [&message](const Logger& logger) { logger.info(message); }),
+                HasSubstr(message));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, warnLogShouldContainProvidedMessage)
+{
+    std::string message = "A test to print warn message";
+
+    EXPECT_THAT(capture(STDOUT_FILENO,
+                        [&message](const Logger& logger) { logger.warn(message); }),
+                HasSubstr(message));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, errorLogShouldContainProvidedMessage)
+{
+    std::string message = "A test to print error message";
+
+    EXPECT_THAT(capture(STDERR_FILENO,
+                        [&message](const Logger& logger) { logger.error(message); }),
+                HasSubstr(message));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, recordsOfAThreadShouldBeWrittenInOrder)
+{
+    constexpr int nbRecords = 10000;
+
+    const std::string output = capture(STDERR_FILENO, [](const Logger& logger) {
+        for (int index = 0; index < nbRecords; ++index) {
+            logger.error("record " + std::to_string(index) + ";");
+        }
+    });
+
+    std::size_t position = 0;
+    for (int index = 0; index < nbRecords; ++index) {
+        position = output.find("record " + std::to_string(index) + ";", position);
+        ASSERT_NE(position, std::string::npos) << "Missing record " << index;
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AsyncLoggerTestFixture, errorsFromConcurrentThreadsShouldNotBeLost)
+{
+    constexpr int nbThreads          = 8;
+    constexpr int nbRecordsPerThread = 2000;
+
+    const std::string output = capture(STDERR_FILENO, [](const Logger& logger) {
+        std::vector<std::thread> threads;
+        for (int id = 0; id < nbThreads; ++id) {
+            threads.emplace_back([&logger, id]() {
+                for (int index = 0; index < nbRecordsPerThread; ++index) {
+                    logger.error("thread " + std::to_string(id));
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+
+    for (int id = 0; id < nbThreads; ++id) {
+        const std::string needle = "thread " + std::to_string(id);
+
+        int count = 0;
+        for (std::size_t position = output.find(needle);
+             position != std::string::npos;
+             position = output.find(needle, position + 1)) {
+            ++count;
+        }
+
+        EXPECT_EQ(count, nbRecordsPerThread) << needle;
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
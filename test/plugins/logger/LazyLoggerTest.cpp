@@ -0,0 +1,161 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/logger/Logger.h"
+
+using namespace service::plugins::logger;
+
+/* Count all dynamic allocations made by the test executable */
+static std::size_t gNbAllocations = 0;
+
+void* operator new(std::size_t size)
+{
+    ++gNbAllocations;
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, [[maybe_unused]] std::size_t size) noexcept
+{
+    std::free(pointer);
+}
+
+namespace {
+
+constexpr int NB_CALLS = 100000;
+
+class LazyLoggerTestFixture : public ::testing::Test {
+
+protected:
+    /* Errors only: debug, info and warn are filtered out at runtime */
+    const Logger m_logger {ILogger::Level::ERROR};
+    const std::string m_interfaceName = "a-long-enough-interface-name-to-allocate";
+
+    /* Run "log" NB_CALLS times and return the number of allocations made.
+     * The time per call is recorded in the test report */
+    template<typename Function>
+    std::size_t countAllocations(const char* name, Function&& log)
+    {
+        const std::size_t nbAllocationsBefore = gNbAllocations;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (int call = 0; call < NB_CALLS; ++call) {
+            log();
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const std::size_t nbAllocations = gNbAllocations - nbAllocationsBefore;
+
+        RecordProperty(
+            name,
+            std::to_string(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()
+                / NB_CALLS)
+                + " ns/call");
+
+        return nbAllocations;
+    }
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(LazyLoggerTestFixture, eagerMessagesAllocateEvenWhenFilteredOut)
+{
+    // Reference: the message is built before the logger can filter it out
+    EXPECT_GE(countAllocations("eager",
+                               [this]() {
+                                   m_logger.info("Check validity of interface: "
+                                                 + m_interfaceName);
+                               }),
+              static_cast<std::size_t>(NB_CALLS));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(LazyLoggerTestFixture, lazyMessagesShouldNotAllocateWhenFilteredOut)
+{
+    EXPECT_EQ(countAllocations("lazyDebug",
+                               [this]() {
+                                   m_logger.debug([this]() {
+                                       return "Check validity of interface: "
+                                              + m_interfaceName;
+                                   });
+                               }),
+              0u);
+
+    EXPECT_EQ(countAllocations("lazyInfo",
+                               [this]() {
+                                   m_logger.info([this]() {
+                                       return "Check validity of interface: "
+                                              + m_interfaceName;
+                                   });
+                               }),
+              0u);
+
+    EXPECT_EQ(countAllocations("constantDebug",
+                               [this]() {
+                                   m_logger.debug(
+                                       "Make sure specified interfaces are valid");
+                               }),
+              0u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(LazyLoggerTestFixture, lazyMessagesShouldNotBeBuiltWhenFilteredOut)
+{
+    bool isBuilt = false;
+
+    m_logger.warn([&isBuilt]() {
+        isBuilt = true;
+        return std::string("message");
+    });
+
+    EXPECT_FALSE(isBuilt);
+    EXPECT_FALSE(m_logger.isEnabled(ILogger::Level::WARN));
+    EXPECT_TRUE(m_logger.isEnabled(ILogger::Level::ERROR));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
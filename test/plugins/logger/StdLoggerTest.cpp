@@ -32,6 +32,7 @@
 #include "plugins/logger/Logger.h"
 
 using ::testing::HasSubstr;
+using ::testing::Not;
 
 using namespace service::plugins::logger;
 
@@ -111,6 +112,25 @@ TEST_F(StdLoggerTestFixture, errorLogShouldContainProvidedMessage)
     std::cerr.rdbuf(previousBuffer);
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(StdLoggerTestFixture, logsBelowMinLevelShouldNotBePrinted)
+{
+    const Logger logger(ILogger::Level::WARN);
+
+    // Set the buffer to stream to and save the original bufferr
+    std::ostringstream buffer;
+    std::streambuf* previousBuffer = std::cout.rdbuf(buffer.rdbuf());
+
+    // Write messages then check result
+    logger.info("An info message");
+    logger.warn([]() { return std::string("A warn message"); });
+    EXPECT_THAT(buffer.str(), Not(HasSubstr("An info message")));
+    EXPECT_THAT(buffer.str(), HasSubstr("A warn message"));
+
+    // Restore the original buffer
+    std::cout.rdbuf(previousBuffer);
+}
+
 }
 
 int main(int argc, char** argv)
@@ -26,6 +26,8 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <sched.h>
+
 #include "gtest/gtest.h"
 
 #include "fakes/MockOS.h"
@@ -157,6 +159,38 @@ TEST_F(NetworkTestFixture, applyLayerCommandsShouldNotFailWithValidParameters)
     m_network.applyLayerCommands(layerCommands);
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkTestFixture, joinNamespaceRaisesExceptionIfOpenFails)
+{
+    EXPECT_CALL(m_mockOS, open).WillOnce(Return(-1));
+    EXPECT_CALL(m_mockOS, setns).Times(0);
+
+    ASSERT_THROW(m_network.joinNamespace("/var/run/netns/fake"),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkTestFixture, joinNamespaceRaisesExceptionIfSetnsFails)
+{
+    EXPECT_CALL(m_mockOS, open).WillOnce(Return(3));
+    EXPECT_CALL(m_mockOS, setns(3, CLONE_NEWNET)).WillOnce(Return(-1));
+    EXPECT_CALL(m_mockOS, close(3)).WillOnce(Return(0));
+
+    ASSERT_THROW(m_network.joinNamespace("/var/run/netns/fake"),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkTestFixture, joinNamespaceShouldNotFailWithValidNamespace)
+{
+    EXPECT_CALL(m_mockOS, open(::testing::StrEq("/proc/42/ns/net"), _))
+        .WillOnce(Return(3));
+    EXPECT_CALL(m_mockOS, setns(3, CLONE_NEWNET)).WillOnce(Return(0));
+    EXPECT_CALL(m_mockOS, close(3)).WillOnce(Return(0));
+
+    ASSERT_NO_THROW(m_network.joinNamespace("/proc/42/ns/net"));
+}
+
 }
 
 int main(int argc, char** argv)
@@ -60,6 +60,9 @@ public:
     /** Mocks */
     MOCK_METHOD(int, getifaddrs, (struct ifaddrs * *ifap));
     MOCK_METHOD(void, freeifaddrs, (struct ifaddrs * ifap));
+    MOCK_METHOD(int, open, (const char* pathname, int flags));
+    MOCK_METHOD(int, setns, (int fd, int nstype));
+    MOCK_METHOD(int, close, (int fd));
 };
 
 }
@@ -26,6 +26,7 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <cstdarg>
 #include <dlfcn.h>
 
 #include "MockOS.h"
@@ -51,4 +52,50 @@ void freeifaddrs(struct ifaddrs* ifa)
 {
     gMockOS->freeifaddrs(ifa);
 }
+
+// NOLINTNEXTLINE(cert-dcl50-cpp)
+int open(const char* pathname, int flags, ...)
+{
+    if (gMockOS != nullptr) {
+        return gMockOS->open(pathname, flags);
+    }
+
+    // Used outside test cases (E.g: by gtest itself) so forward to the real
+    // function with the optional mode
+    va_list args;
+    va_start(args, flags);
+    const auto mode = static_cast<mode_t>(va_arg(args, int));
+    va_end(args);
+
+    using RealOpen_t     = int (*)(const char*, int, ...);
+    static auto realOpen = (RealOpen_t)dlsym(RTLD_NEXT, "open");
+    if (realOpen == nullptr) {
+        errno = ELIBACC;
+        return -1;
+    }
+
+    return realOpen(pathname, flags, mode);
+}
+
+int setns(int fd, int nstype)
+{
+    RETURN_IF_NOT_IN_TESTCASE(-1);
+    return gMockOS->setns(fd, nstype);
+}
+
+int close(int fd)
+{
+    if (gMockOS != nullptr) {
+        return gMockOS->close(fd);
+    }
+
+    using RealClose_t     = int (*)(int);
+    static auto realClose = (RealClose_t)dlsym(RTLD_NEXT, "close");
+    if (realClose == nullptr) {
+        errno = ELIBACC;
+        return -1;
+    }
+
+    return realClose(fd);
+}
 }
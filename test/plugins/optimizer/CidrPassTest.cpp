@@ -0,0 +1,137 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/optimizer/pass/CidrPass.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+const std::string DROP_FROM {"/sbin/iptables -A INPUT -s "};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CidrPassTestSuite, aggregateAdjacentAndCoveredPrefixes)
+{
+    const CidrPass pass;
+
+    ConfigData::Rule rule {"blocklist", {"/sbin/iptables -N BLOCKLIST"}};
+    for (unsigned int index = 0; index < 256; ++index) {
+        rule.commands.push_back(DROP_FROM + "10.1." + std::to_string(index)
+                                + ".0/24 -j DROP");
+    }
+    rule.commands.push_back(DROP_FROM + "10.1.42.7 -j DROP");
+    rule.commands.push_back(DROP_FROM + "172.16.0.0/13,172.24.0.0/13 -j DROP");
+    rule.commands.push_back("/sbin/iptables -A INPUT -j ACCEPT");
+
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes, ElementsAre("259 addresses aggregated into 2 prefixes"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre("/sbin/iptables -N BLOCKLIST",
+                            DROP_FROM + "10.1.0.0/16 -j DROP",
+                            DROP_FROM + "172.16.0.0/12 -j DROP",
+                            "/sbin/iptables -A INPUT -j ACCEPT"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CidrPassTestSuite, aggregateIpv6Destinations)
+{
+    const CidrPass pass;
+
+    ConfigData::Rule rule {
+        "blocklist",
+        {"/sbin/ip6tables -A OUTPUT -d 2001:db8::/33 -p tcp -j REJECT",
+         "/sbin/ip6tables -A OUTPUT -d 2001:db8:8000::/33 -p tcp -j REJECT",
+         "/sbin/ip6tables -A OUTPUT -d 2001:db8::1 -p tcp -j REJECT"}};
+
+    EXPECT_THAT(pass.run(rule),
+                ElementsAre("3 addresses aggregated into 1 prefixes"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre("/sbin/ip6tables -A OUTPUT -d 2001:db8::/32 -p tcp "
+                            "-j REJECT"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CidrPassTestSuite, mergeOnlyDisjointPrefixesOfNonTerminalCommands)
+{
+    const CidrPass pass;
+
+    ConfigData::Rule rule {"log",
+                           {DROP_FROM + "10.0.0.0/25 -j LOG",
+                            DROP_FROM + "10.0.0.128/25 -j LOG"}};
+    EXPECT_THAT(pass.run(rule),
+                ElementsAre("2 addresses aggregated into 1 prefixes"));
+    EXPECT_THAT(rule.commands, ElementsAre(DROP_FROM + "10.0.0.0/24 -j LOG"));
+
+    // A packet from 10.0.0.1 is logged twice
+    rule.commands = {DROP_FROM + "10.0.0.0/24 -j LOG",
+                     DROP_FROM + "10.0.0.1 -j LOG"};
+    const std::vector<std::string> commands = rule.commands;
+
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CidrPassTestSuite, leaveOtherValuesAndCommandsUntouched)
+{
+    const CidrPass pass;
+
+    ConfigData::Rule rule {
+        "other",
+        {DROP_FROM + "example.com -j DROP",
+         DROP_FROM + "10.0.0.0/255.255.255.0 -j DROP",
+         "/sbin/iptables -A INPUT ! -s 10.0.0.0/25 -j DROP",
+         "/sbin/iptables -A INPUT ! -s 10.0.0.128/25 -j DROP",
+         "/sbin/ip6tables -A INPUT -s 10.0.0.0/25 -j DROP",
+         "/sbin/ip6tables -A INPUT -s 10.0.0.128/25 -j DROP",
+         DROP_FROM + "10.0.0.0/24 -j DROP",
+         DROP_FROM + "10.0.1.0/24 -j ACCEPT"}};
+    const std::vector<std::string> commands = rule.commands;
+
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
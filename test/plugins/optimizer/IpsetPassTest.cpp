@@ -0,0 +1,300 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockWriter.h"
+
+#include "plugins/optimizer/pass/IpsetPass.h"
+
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::EndsWith;
+using ::testing::HasSubstr;
+using ::testing::MatchesRegex;
+using ::testing::Not;
+using ::testing::SaveArg;
+using ::testing::StartsWith;
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+using namespace utils::file;
+
+namespace {
+
+std::vector<std::string> blocklist(const std::string& option,
+                                   std::size_t nbAddresses)
+{
+    std::vector<std::string> commands;
+    for (std::size_t index = 0; index < nbAddresses; ++index) {
+        commands.push_back("/sbin/iptables -A INPUT " + option + " 10.0."
+                           + std::to_string(index) + ".0/24 -j DROP");
+    }
+
+    return commands;
+}
+
+/* The file given to "ipset -exist -file <file> restore" */
+std::string restoredFile(const std::string& command)
+{
+    const std::size_t start = command.find(" -file ") + std::strlen(" -file ");
+    return command.substr(start, command.find(' ', start) - start);
+}
+
+/* The set matched by "iptables ... -m set --match-set <set> src|dst" */
+std::string setOf(const std::string& command)
+{
+    const std::size_t start
+        = command.find("--match-set ") + std::strlen("--match-set ");
+    return command.substr(start, command.find(' ', start) - start);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, foldConsecutiveSourceAddressesIntoASet)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+    std::string content;
+
+    EXPECT_CALL(mockWriter, writeToStream(_, _)).WillOnce(SaveArg<1>(&content));
+
+    ConfigData::Rule rule {"blocklist", blocklist("-s", 1000)};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_THAT(changes[0], StartsWith("1000 commands folded into set ns"));
+
+    ASSERT_EQ(rule.commands.size(), 2u);
+    EXPECT_THAT(
+        rule.commands[0],
+        MatchesRegex("/sbin/ipset -exist -file /tmp/networkservice-.* restore"));
+    EXPECT_THAT(rule.commands[1],
+                MatchesRegex("/sbin/iptables -A INPUT -m set --match-set "
+                             "ns[0-9a-f]{16} src -j DROP"));
+
+    const std::string set = setOf(rule.commands[1]);
+    const std::string type
+        = " hash:net family inet hashsize 1024 maxelem 65536\n";
+    EXPECT_THAT(content,
+                AllOf(StartsWith("create " + set + ".tmp" + type + "flush " + set
+                                 + ".tmp\nadd " + set + ".tmp 10.0.0.0/24\n"),
+                      HasSubstr("add " + set + ".tmp 10.0.999.0/24\n")));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, matchDestinationAndIpv6Sets)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+    std::string content;
+
+    EXPECT_CALL(mockWriter, writeToStream(_, _)).WillOnce(SaveArg<1>(&content));
+
+    ConfigData::Rule rule {"v6", {}};
+    for (const char* address :
+         {"2001:db8::1", "2001:db8::2", "2001:db8::/64", "fe80::1"}) {
+        rule.commands.push_back(std::string("ip6tables -A OUTPUT --destination ")
+                                + address + " -j REJECT");
+    }
+
+    (void)pass.run(rule);
+
+    ASSERT_EQ(rule.commands.size(), 2u);
+    EXPECT_THAT(rule.commands[0], StartsWith("ipset -exist -file "));
+    EXPECT_THAT(rule.commands[1], HasSubstr("-m set --match-set ns"));
+    EXPECT_THAT(rule.commands[1], HasSubstr(" dst -j REJECT"));
+    EXPECT_THAT(content, HasSubstr("family inet6"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, leaveShortListsUntouched)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(0);
+
+    ConfigData::Rule rule {"short", blocklist("-s", IpsetPass::MIN_ADDRESSES - 1)};
+    const std::vector<std::string> expected = rule.commands;
+
+    ASSERT_TRUE(pass.run(rule).empty());
+    ASSERT_EQ(rule.commands, expected);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, onlyFoldConsecutiveCommandsWithSameVerdict)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(2);
+
+    std::vector<std::string> commands = blocklist("-s", 4);
+    commands.emplace_back("/sbin/iptables -A INPUT -s 10.1.0.0/16 -j ACCEPT");
+    for (const std::string& command : blocklist("-s", 4)) {
+        commands.push_back(command);
+    }
+
+    ConfigData::Rule rule {"interleaved", commands};
+
+    ASSERT_EQ(pass.run(rule).size(), 2u);
+    ASSERT_EQ(rule.commands.size(), 5u);
+    EXPECT_EQ(rule.commands[2], "/sbin/iptables -A INPUT -s 10.1.0.0/16 -j ACCEPT");
+    EXPECT_NE(rule.commands[1], rule.commands[4]);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, leaveNegatedAddressesAndNonAppendCommandsUntouched)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(0);
+
+    ConfigData::Rule rule {"untouched", {}};
+    for (int index = 0; index < 5; ++index) {
+        const std::string address = "10.0." + std::to_string(index) + ".1";
+        rule.commands.push_back("/sbin/iptables -A INPUT ! -s " + address
+                                + " -j DROP");
+        rule.commands.push_back("/sbin/iptables -D INPUT -s " + address
+                                + " -j DROP");
+    }
+    const std::vector<std::string> expected = rule.commands;
+
+    ASSERT_TRUE(pass.run(rule).empty());
+    ASSERT_EQ(rule.commands, expected);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, nameSetsTheSameWayFromOneRunToTheOther)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(2);
+
+    ConfigData::Rule first {"blocklist", blocklist("-d", 10)};
+    ConfigData::Rule second {"blocklist", blocklist("-d", 10)};
+
+    ASSERT_EQ(pass.run(first), pass.run(second));
+    ASSERT_EQ(first.commands[1], second.commands[1]);
+}
+
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, sizeSetsLargerThanTheDefaultMaxelem)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+    std::string small;
+    std::string large;
+
+    EXPECT_CALL(mockWriter, writeToStream(_, _))
+        .WillOnce(SaveArg<1>(&small))
+        .WillOnce(SaveArg<1>(&large));
+
+    ConfigData::Rule smallRule {"blocklist", blocklist("-s", 65536)};
+    ConfigData::Rule largeRule {"blocklist", blocklist("-s", 65537)};
+    (void)pass.run(smallRule);
+    (void)pass.run(largeRule);
+
+    // A set created with another maxelem couldn't be swapped into
+    const std::string set = setOf(largeRule.commands[1]);
+    ASSERT_NE(setOf(smallRule.commands[1]), set);
+
+    const std::string type
+        = " hash:net family inet hashsize 131072 maxelem 131072\n";
+    EXPECT_THAT(small, HasSubstr(" hashsize 65536 maxelem 65536\n"));
+    EXPECT_THAT(large,
+                AllOf(StartsWith("create " + set + ".tmp" + type),
+                      HasSubstr("add " + set + ".tmp 10.0.65536.0/24\n"),
+                      HasSubstr("create " + set + type)));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, swapTheNewAddressesIntoTheSetInUse)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+    std::string content;
+
+    EXPECT_CALL(mockWriter, writeToStream(_, _))
+        .Times(2)
+        .WillRepeatedly(SaveArg<1>(&content));
+
+    ConfigData::Rule first {"blocklist", blocklist("-s", 10)};
+    (void)pass.run(first);
+
+    // Applied again, the set in use must keep its addresses until the swap
+    ConfigData::Rule second {"blocklist", blocklist("-s", 10)};
+    (void)pass.run(second);
+
+    const std::string set = setOf(second.commands[1]);
+    ASSERT_EQ(setOf(first.commands[1]), set);
+    ASSERT_THAT(content, Not(HasSubstr("flush " + set + "\n")));
+    ASSERT_THAT(content,
+                EndsWith("add " + set + ".tmp 10.0.9.0/24\n"
+                         "create " + set
+                         + " hash:net family inet hashsize 1024 maxelem 65536\n"
+                         "swap " + set + ".tmp " + set + "\n"
+                         "destroy " + set + ".tmp\n"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IpsetPassTestSuite, removeFilesOfPreviousRunsOnReset)
+{
+    const MockWriter mockWriter;
+    const IpsetPass pass(mockWriter);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(2);
+
+    ConfigData::Rule first {"blocklist", blocklist("-s", 10)};
+    (void)pass.run(first);
+    const std::string firstFile = restoredFile(first.commands[0]);
+    ASSERT_EQ(access(firstFile.c_str(), F_OK), 0);
+
+    pass.reset();
+    ASSERT_NE(access(firstFile.c_str(), F_OK), 0);
+
+    ConfigData::Rule second {"blocklist", blocklist("-s", 10)};
+    (void)pass.run(second);
+    ASSERT_EQ(access(restoredFile(second.commands[0]).c_str(), F_OK), 0);
+}
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,233 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/optimizer/pass/IptablesPass.h"
+
+using ::testing::ElementsAre;
+using ::testing::IsEmpty;
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+const std::string IPTABLES {"/sbin/iptables"};
+
+std::vector<std::string> portList(std::size_t nbPorts, const std::string& target)
+{
+    std::vector<std::string> commands;
+    for (std::size_t index = 0; index < nbPorts; ++index) {
+        commands.push_back(IPTABLES + " -A INPUT -p tcp --dport "
+                           + std::to_string(1000 + index) + " -j " + target);
+    }
+
+    return commands;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, dropDuplicatesOfTerminalCommands)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {
+        "dedupe",
+        {IPTABLES + " -A INPUT -s 10.0.0.1 -p udp -j DROP",
+         IPTABLES + " -A INPUT -i eth0 -j ACCEPT",
+         IPTABLES + " -A INPUT --protocol udp --source 10.0.0.1 --jump DROP",
+         IPTABLES + " -t filter -A INPUT -i eth0 -j ACCEPT"}};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes,
+                ElementsAre("command 3 duplicates command 1, dropped",
+                            "command 4 duplicates command 2, dropped"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre(IPTABLES + " -A INPUT -s 10.0.0.1 -p udp -j DROP",
+                            IPTABLES + " -A INPUT -i eth0 -j ACCEPT"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, dropCommandsShadowedByMoreGeneralOnes)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {
+        "shadowing",
+        {IPTABLES + " -A FORWARD -s 10.0.0.0/8 -j DROP",
+         IPTABLES + " -A FORWARD -s 10.0.0.0/8 -p tcp --dport 22 -j ACCEPT",
+         IPTABLES + " -A FORWARD -s 10.0.0.0/8 -i eth1 -j LOG",
+         IPTABLES + " -A OUTPUT -s 10.0.0.0/8 -j ACCEPT"}};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes,
+                ElementsAre("command 2 is shadowed by command 1, dropped",
+                            "command 3 is shadowed by command 1, dropped"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre(IPTABLES + " -A FORWARD -s 10.0.0.0/8 -j DROP",
+                            IPTABLES + " -A OUTPUT -s 10.0.0.0/8 -j ACCEPT"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, keepCommandsThatMayStillBeReached)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {
+        "reachable",
+        {// Non-terminal commands are evaluated each time
+         IPTABLES + " -A INPUT -p tcp -j LOG",
+         IPTABLES + " -A INPUT -p tcp -j LOG",
+         // Stateful matches may not match the next time
+         IPTABLES + " -A INPUT -m limit --limit 5/s -j ACCEPT",
+         IPTABLES + " -A INPUT -m limit --limit 5/s -j ACCEPT",
+         // Negations and other tables are different conditions
+         IPTABLES + " -A INPUT ! -s 10.0.0.1 -j DROP",
+         IPTABLES + " -A INPUT -s 10.0.0.1 -j DROP",
+         IPTABLES + " -t nat -A INPUT -s 10.0.0.1 -j DROP",
+         "/sbin/ip6tables -A INPUT -s 10.0.0.1 -j DROP"}};
+
+    const std::vector<std::string> commands = rule.commands;
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, stopShadowingAfterACommandModifyingPackets)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {
+        "barrier",
+        {IPTABLES + " -t mangle -A PREROUTING -m mark --mark 1 -j ACCEPT",
+         IPTABLES + " -t mangle -A PREROUTING -i eth0 -j MARK --set-mark 1",
+         IPTABLES + " -t mangle -A PREROUTING -m mark --mark 1 -j ACCEPT"}};
+
+    const std::vector<std::string> commands = rule.commands;
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, leaveChainsWhoseOrderIsUnknownUntouched)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {"reordered",
+                           {IPTABLES + " -A INPUT -s 10.0.0.1 -j DROP",
+                            IPTABLES + " -A INPUT -s 10.0.0.1 -j DROP",
+                            IPTABLES + " -D INPUT 1"}};
+
+    const std::vector<std::string> commands = rule.commands;
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+
+    rule.commands.back() = IPTABLES + " -F";
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+
+    // Old negation syntax can't be read so nothing is changed
+    rule.commands.back() = IPTABLES + " -A INPUT -p tcp --dport ! 22 -j MARK";
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, mergePortsIntoMultiportLists)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {"ports", portList(20, "ACCEPT")};
+    rule.commands.push_back(IPTABLES + " -A INPUT -p udp --dport 53 -j ACCEPT");
+
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes,
+                ElementsAre("15 commands merged into -m multiport --dports "
+                            "1000,1001,1002,1003,1004,1005,1006,1007,1008,1009,"
+                            "1010,1011,1012,1013,1014",
+                            "5 commands merged into -m multiport --dports "
+                            "1015,1016,1017,1018,1019"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre(IPTABLES + " -A INPUT -p tcp -m multiport --dports "
+                                       "1000,1001,1002,1003,1004,1005,1006,"
+                                       "1007,1008,1009,1010,1011,1012,1013,"
+                                       "1014 -j ACCEPT",
+                            IPTABLES + " -A INPUT -p tcp -m multiport --dports "
+                                       "1015,1016,1017,1018,1019 -j ACCEPT",
+                            IPTABLES + " -A INPUT -p udp --dport 53 -j ACCEPT"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, countRangesAsTwoPortsAndKeepThemForNonTerminals)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {"ranges",
+                           {IPTABLES + " -A INPUT -p tcp --sport 1:1023 -j DROP",
+                            IPTABLES + " -A INPUT -p tcp --sport 2049 -j DROP",
+                            IPTABLES + " -A INPUT -p tcp --dport 20:21 -j LOG",
+                            IPTABLES + " -A INPUT -p tcp --dport 21 -j LOG"}};
+
+    EXPECT_THAT(pass.run(rule),
+                ElementsAre("2 commands merged into -m multiport --sports "
+                            "1:1023,2049"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre(IPTABLES + " -A INPUT -p tcp -m multiport --sports "
+                                       "1:1023,2049 -j DROP",
+                            IPTABLES + " -A INPUT -p tcp --dport 20:21 -j LOG",
+                            IPTABLES + " -A INPUT -p tcp --dport 21 -j LOG"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(IptablesPassTestSuite, mergePortsOnceShadowedCommandsAreDropped)
+{
+    const IptablesPass pass;
+
+    ConfigData::Rule rule {"both",
+                           {IPTABLES + " -A INPUT -p tcp --dport 22 -j ACCEPT",
+                            IPTABLES + " -A INPUT -p tcp --dport 22 -j ACCEPT",
+                            IPTABLES + " -A INPUT -p tcp --dport 80 -j ACCEPT"}};
+
+    EXPECT_THAT(pass.run(rule),
+                ElementsAre("command 2 duplicates command 1, dropped",
+                            "2 commands merged into -m multiport --dports 22,80"));
+    EXPECT_THAT(rule.commands,
+                ElementsAre(IPTABLES + " -A INPUT -p tcp -m multiport --dports "
+                                       "22,80 -j ACCEPT"));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,280 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/optimizer/pass/NftVmapPass.h"
+
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::StartsWith;
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+const std::string HEAD {"/usr/sbin/nft add rule inet filter input tcp dport"};
+
+std::string verdictOf(std::size_t port)
+{
+    return (port % 3 == 0) ? "accept" : (port % 3 == 1) ? "drop" : "jump web";
+}
+
+std::vector<std::string> portDispatch(std::size_t nbPorts)
+{
+    std::vector<std::string> commands;
+    for (std::size_t port = 1; port <= nbPorts; ++port) {
+        commands.push_back(HEAD + " " + std::to_string(port) + " "
+                           + verdictOf(port));
+    }
+
+    return commands;
+}
+
+/* Verdict of a "vmap { key : verdict, ... }" command for a port */
+std::optional<std::string> lookupVmap(const std::string& command,
+                                      const std::string& port)
+{
+    const std::size_t open  = command.find('{');
+    const std::size_t close = command.rfind('}');
+    const std::string body  = command.substr(open + 1, close - open - 1);
+
+    std::map<std::string, std::string> map;
+    std::size_t start = 0;
+    while (start < body.size()) {
+        std::size_t end = body.find(',', start);
+        end             = (end == std::string::npos) ? body.size() : end;
+
+        const std::string element = body.substr(start, end - start);
+        const std::size_t colon   = element.find(" : ");
+        const std::size_t keyPos  = element.find_first_not_of(' ');
+        const std::size_t verdictEnd = element.find_last_not_of(' ');
+        map.emplace(element.substr(keyPos, colon - keyPos),
+                    element.substr(colon + 3, verdictEnd - colon - 2));
+
+        start = end + 1;
+    }
+
+    const auto it = map.find(port);
+    return (it == map.end()) ? std::nullopt : std::optional {it->second};
+}
+
+/* Verdicts applied to a port by a chain made of these commands, in both
+ * linear and vmap forms. The chains jumped to are assumed to return, so
+ * evaluation goes on with the next command after a jump or a continue
+ * and only stops on accept, drop, return or goto */
+std::vector<std::string> evaluate(const std::vector<std::string>& commands,
+                                  const std::string& port)
+{
+    std::vector<std::string> trace;
+
+    for (const std::string& command : commands) {
+        std::optional<std::string> verdict;
+        const std::string prefix = HEAD + " " + port + " ";
+        if (command.rfind(HEAD + " vmap {", 0) == 0) {
+            verdict = lookupVmap(command, port);
+        }
+        else if (command.rfind(prefix, 0) == 0) {
+            verdict = command.substr(prefix.size());
+        }
+
+        if (!verdict) {
+            continue;
+        }
+
+        trace.push_back(*verdict);
+        if ((verdict->rfind("jump ", 0) != 0) && (*verdict != "continue")) {
+            break;
+        }
+    }
+
+    return trace;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, compilePortDispatchIntoOneLookup)
+{
+    const NftVmapPass pass;
+
+    ConfigData::Rule rule {"dispatch", portDispatch(500)};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0], "500 commands compiled into one vmap lookup on tcp dport");
+
+    ASSERT_EQ(rule.commands.size(), 1u);
+    EXPECT_THAT(rule.commands[0],
+                StartsWith(HEAD + " vmap { 1 : drop, 2 : jump web, 3 : accept, "));
+    EXPECT_THAT(rule.commands[0], HasSubstr(", 500 : jump web }"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, vmapIsEquivalentToTheLinearForm)
+{
+    const NftVmapPass pass;
+
+    std::vector<std::string> linear = portDispatch(500);
+    // A port matched again later is shadowed by the first match
+    linear.push_back(HEAD + " 42 drop");
+    linear.push_back(HEAD + " 7 accept");
+
+    ConfigData::Rule rule {"dispatch", linear};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_THAT(changes[0], HasSubstr("(2 unreachable branch(es) dropped)"));
+    ASSERT_EQ(rule.commands.size(), 1u);
+
+    // Every matched port and a few misses fall through the same way
+    for (std::size_t port = 0; port <= 510; ++port) {
+        const std::string key = std::to_string(port);
+        EXPECT_EQ(evaluate(rule.commands, key), evaluate(linear, key))
+            << "port " << key;
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, endGroupOnValueMatchedAgainAfterNonTerminalVerdict)
+{
+    const NftVmapPass pass;
+
+    // Port 2 jumps to "web" then, once back, is matched again
+    std::vector<std::string> linear = portDispatch(4);
+    linear.push_back(HEAD + " 2 accept");
+    for (std::size_t port = 10; port <= 13; ++port) {
+        linear.push_back(HEAD + " " + std::to_string(port) + " " + verdictOf(port));
+    }
+
+    ConfigData::Rule rule {"dispatch", linear};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes,
+                ElementsAre(StartsWith("4 commands compiled"),
+                            StartsWith("5 commands compiled")));
+    EXPECT_THAT(
+        rule.commands,
+        ElementsAre(HEAD + " vmap { 1 : drop, 2 : jump web, 3 : accept, 4 : drop }",
+                    HEAD
+                        + " vmap { 2 : accept, 10 : drop, 11 : jump web, "
+                          "12 : accept, 13 : drop }"));
+
+    EXPECT_THAT(evaluate(rule.commands, "2"), ElementsAre("jump web", "accept"));
+    for (std::size_t port = 0; port <= 15; ++port) {
+        const std::string key = std::to_string(port);
+        EXPECT_EQ(evaluate(rule.commands, key), evaluate(linear, key))
+            << "port " << key;
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, keepCommandsAroundTheDispatchInOrder)
+{
+    const NftVmapPass pass;
+
+    std::vector<std::string> commands {"/usr/sbin/nft add table inet filter"};
+    for (const std::string& command : portDispatch(4)) {
+        commands.push_back(command);
+    }
+    commands.push_back(HEAD + " 8080 counter accept");
+
+    ConfigData::Rule rule {"dispatch", commands};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_THAT(
+        rule.commands,
+        ElementsAre("/usr/sbin/nft add table inet filter",
+                    HEAD + " vmap { 1 : drop, 2 : jump web, 3 : accept, 4 : drop }",
+                    HEAD + " 8080 counter accept"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, keepTooFewBranchesUntouched)
+{
+    const NftVmapPass pass;
+
+    ConfigData::Rule rule {"dispatch", portDispatch(NftVmapPass::MIN_BRANCHES - 1)};
+    const std::vector<std::string> commands = rule.commands;
+
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, keepRangesSetsAndNegationsUntouched)
+{
+    const NftVmapPass pass;
+
+    ConfigData::Rule rule {"dispatch",
+                           {HEAD + " 1-1024 accept", HEAD + " { 22, 80 } accept",
+                            HEAD + " != 443 drop",
+                            "/usr/sbin/nft add rule inet filter input ip saddr "
+                            "10.0.0.0/8 drop"}};
+    const std::vector<std::string> commands = rule.commands;
+
+    EXPECT_THAT(pass.run(rule), IsEmpty());
+    EXPECT_EQ(rule.commands, commands);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(NftVmapPassTestSuite, splitGroupsOnDifferentSelectorsOrChains)
+{
+    const NftVmapPass pass;
+
+    std::vector<std::string> commands = portDispatch(4);
+    for (std::size_t index = 1; index <= 4; ++index) {
+        commands.push_back("/usr/sbin/nft add rule inet filter forward iifname eth"
+                           + std::to_string(index) + " jump lan");
+    }
+
+    ConfigData::Rule rule {"dispatch", commands};
+    const std::vector<std::string> changes = pass.run(rule);
+
+    EXPECT_THAT(changes,
+                ElementsAre(HasSubstr("on tcp dport"), HasSubstr("on iifname")));
+    ASSERT_EQ(rule.commands.size(), 2u);
+    EXPECT_EQ(rule.commands[1],
+              "/usr/sbin/nft add rule inet filter forward iifname vmap { eth1 : "
+              "jump lan, eth2 : jump lan, eth3 : jump lan, eth4 : jump lan }");
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <unistd.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockWriter.h"
+
+#include "plugins/optimizer/Optimizer.h"
+
+using ::testing::AllOf;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+
+using namespace service::plugins::config;
+using namespace service::plugins::optimizer;
+using namespace utils::file;
+
+namespace {
+
+ConfigData blocklistConfig()
+{
+    ConfigData configData {{},
+                           {{"blocklist", {}}, {"other", {"/sbin/iptables -L"}}}};
+    for (int index = 0; index < 8; ++index) {
+        configData.rules[0].commands.push_back("/sbin/iptables -A INPUT -s 10.0.0."
+                                               + std::to_string(index) + " -j DROP");
+    }
+
+    return configData;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(OptimizerTestSuite, leaveConfigUntouchedWithoutPass)
+{
+    const MockWriter mockWriter;
+    const Optimizer optimizer(mockWriter);
+
+    ConfigData configData = blocklistConfig();
+    optimizer.optimize(configData);
+
+    ASSERT_EQ(configData.rules[0].commands, blocklistConfig().rules[0].commands);
+    ASSERT_THAT(optimizer.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(OptimizerTestSuite, runEnabledPassesOnEachRuleAndReportChanges)
+{
+    const MockWriter mockWriter;
+    const Optimizer optimizer(mockWriter, Optimizer::Passes::IPSET);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(1);
+
+    ConfigData configData = blocklistConfig();
+    optimizer.optimize(configData);
+
+    ASSERT_EQ(configData.rules[0].commands.size(), 2u);
+    ASSERT_EQ(configData.rules[1].commands, blocklistConfig().rules[1].commands);
+    ASSERT_THAT(optimizer.toString(),
+                HasSubstr("ipset: blocklist: 8 commands folded into set ns"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(OptimizerTestSuite, runPassesInTheOrderOfTheEnumeration)
+{
+    const MockWriter mockWriter;
+    const Optimizer optimizer(
+        mockWriter,
+        static_cast<Optimizer::Passes>(Optimizer::Passes::IPTABLES
+                                       | Optimizer::Passes::IPSET));
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(1);
+
+    // The duplicate is dropped first so that the set is not split
+    ConfigData configData = blocklistConfig();
+    auto& commands        = configData.rules[0].commands;
+    commands.insert(commands.begin() + 4, commands[0]);
+    optimizer.optimize(configData);
+
+    ASSERT_EQ(configData.rules[0].commands.size(), 2u);
+    ASSERT_THAT(optimizer.toString(),
+                AllOf(HasSubstr("iptables: blocklist: command 5 duplicates "
+                                "command 1"),
+                      HasSubstr("ipset: blocklist: 8 commands folded into set ns")));
+}
+
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(OptimizerTestSuite, onlyKeepWhatWasDoneToTheLastConfig)
+{
+    const MockWriter mockWriter;
+    const Optimizer optimizer(mockWriter, Optimizer::Passes::IPSET);
+
+    EXPECT_CALL(mockWriter, writeToStream).Times(2);
+
+    ConfigData first = blocklistConfig();
+    optimizer.optimize(first);
+    const std::string& restore = first.rules[0].commands[0];
+    const std::string firstFile
+        = restore.substr(restore.find("/tmp/"),
+                         restore.rfind(" restore") - restore.find("/tmp/"));
+    ASSERT_EQ(access(firstFile.c_str(), F_OK), 0);
+
+    // A resident service optimizes each submitted configuration
+    ConfigData second = blocklistConfig();
+    optimizer.optimize(second);
+
+    ASSERT_NE(access(firstFile.c_str(), F_OK), 0);
+    const std::string report = optimizer.toString();
+    ASSERT_EQ(report.find("ipset: blocklist"), report.rfind("ipset: blocklist"));
+}
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
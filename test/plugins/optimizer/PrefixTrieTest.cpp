@@ -0,0 +1,122 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <arpa/inet.h>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "plugins/optimizer/pass/PrefixTrie.h"
+
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+using Prefix = PrefixTrie::Prefix;
+
+Prefix toPrefix(const std::string& address, unsigned int length)
+{
+    Prefix prefix;
+    const int family = address.find(':') == std::string::npos ? AF_INET : AF_INET6;
+    EXPECT_EQ(inet_pton(family, address.c_str(), prefix.bytes.data()), 1);
+    prefix.length = length;
+
+    return prefix;
+}
+
+std::vector<std::string> toStrings(const std::vector<Prefix>& prefixes, int family)
+{
+    std::vector<std::string> strings;
+    for (const Prefix& prefix : prefixes) {
+        char address[INET6_ADDRSTRLEN] = {};
+        (void)inet_ntop(family, prefix.bytes.data(), address, sizeof(address));
+        strings.push_back(std::string(address) + "/"
+                          + std::to_string(prefix.length));
+    }
+
+    return strings;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PrefixTrieTestSuite, mergeAdjacentHalvesUpToTheLargestPrefix)
+{
+    PrefixTrie trie(32);
+
+    for (unsigned int index = 0; index < 4; ++index) {
+        const std::string address = "10.0." + std::to_string(index) + ".0";
+        ASSERT_FALSE(trie.insert(toPrefix(address, 24)));
+    }
+    ASSERT_FALSE(trie.insert(toPrefix("10.0.5.0", 24)));
+
+    ASSERT_EQ(toStrings(trie.prefixes(), AF_INET),
+              (std::vector<std::string> {"10.0.0.0/22", "10.0.5.0/24"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PrefixTrieTestSuite, dropPrefixesCoveredByALargerOne)
+{
+    PrefixTrie trie(32);
+
+    ASSERT_FALSE(trie.insert(toPrefix("192.168.1.1", 32)));
+    ASSERT_FALSE(trie.insert(toPrefix("192.168.2.0", 24)));
+    ASSERT_TRUE(trie.insert(toPrefix("192.168.0.0", 16)));
+    ASSERT_TRUE(trie.insert(toPrefix("192.168.3.0", 24)));
+    ASSERT_TRUE(trie.insert(toPrefix("192.168.0.0", 16)));
+
+    ASSERT_EQ(toStrings(trie.prefixes(), AF_INET),
+              (std::vector<std::string> {"192.168.0.0/16"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PrefixTrieTestSuite, handleIpv6AndTheWholeAddressSpace)
+{
+    PrefixTrie trie(128);
+
+    ASSERT_FALSE(trie.insert(toPrefix("2001:db8::", 33)));
+    ASSERT_FALSE(trie.insert(toPrefix("2001:db8:8000::", 33)));
+    ASSERT_FALSE(trie.insert(toPrefix("::1", 128)));
+    ASSERT_EQ(toStrings(trie.prefixes(), AF_INET6),
+              (std::vector<std::string> {"::1/128", "2001:db8::/32"}));
+
+    ASSERT_TRUE(trie.insert(toPrefix("::", 0)));
+    ASSERT_TRUE(trie.insert(toPrefix("fe80::", 10)));
+    ASSERT_EQ(toStrings(trie.prefixes(), AF_INET6),
+              (std::vector<std::string> {"::/0"}));
+
+    ASSERT_THROW(trie.insert(toPrefix("::", 129)), std::invalid_argument);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "gtest/gtest.h"
+
+#include "plugins/optimizer/pass/Tokens.h"
+
+using namespace service::plugins::optimizer::pass;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TokensTestSuite, splitOnSpacesAndIgnoreEmptyTokens)
+{
+    const std::vector<std::string> expected = {"/sbin/iptables", "-A", "INPUT"};
+
+    ASSERT_EQ(Tokens::split("  /sbin/iptables  -A INPUT "), expected);
+    ASSERT_TRUE(Tokens::split("   ").empty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TokensTestSuite, joinWithSingleSpaces)
+{
+    ASSERT_EQ(Tokens::join({"/sbin/iptables", "-A", "INPUT"}),
+              "/sbin/iptables -A INPUT");
+    ASSERT_EQ(Tokens::join({}), "");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TokensTestSuite, recognizeIptablesAppendCommands)
+{
+    ASSERT_EQ(Tokens::program({"/usr/sbin/ip6tables"}), "ip6tables");
+    ASSERT_EQ(Tokens::program({"iptables"}), "iptables");
+
+    ASSERT_TRUE(Tokens::isIptables({"/sbin/iptables", "-L"}));
+    ASSERT_TRUE(Tokens::isIptables({"ip6tables", "-L"}));
+    ASSERT_FALSE(Tokens::isIptables({"/sbin/ip", "link"}));
+    ASSERT_FALSE(Tokens::isIptables({}));
+
+    ASSERT_TRUE(Tokens::isAppend({"iptables", "--append", "INPUT"}));
+    ASSERT_FALSE(Tokens::isAppend({"iptables", "-I", "INPUT"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TokensTestSuite, recognizeTerminalTargets)
+{
+    ASSERT_TRUE(Tokens::isTerminal({"iptables", "-A", "INPUT", "-j", "DROP"}));
+    ASSERT_TRUE(Tokens::isTerminal({"iptables", "-A", "INPUT", "--jump", "ACCEPT"}));
+    ASSERT_FALSE(Tokens::isTerminal({"iptables", "-A", "INPUT", "-j", "LOG"}));
+    ASSERT_FALSE(Tokens::isTerminal({"iptables", "-A", "INPUT", "-j"}));
+    ASSERT_FALSE(Tokens::isTerminal({"iptables", "-A", "INPUT"}));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
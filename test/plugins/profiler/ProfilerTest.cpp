@@ -0,0 +1,149 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+#include "mocks/MockOsal.h"
+
+#include "plugins/profiler/Profiler.h"
+
+#include "utils/helper/AllocationCounter.h"
+
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::NiceMock;
+using ::testing::Not;
+using ::testing::Return;
+
+using namespace service::plugins::profiler;
+using namespace utils::command::osal;
+using namespace utils::helper;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ProfilerTestSuite, disabledProfilerShouldNotReportAnything)
+{
+    const Profiler profiler(false);
+
+    profiler.startPhase("phase");
+    profiler.stopPhase("phase");
+
+    EXPECT_THAT(profiler.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ProfilerTestSuite, reportPhasesInTheOrderTheyWereStarted)
+{
+    const Profiler profiler;
+
+    profiler.startPhase("second");
+    profiler.stopPhase("second");
+    profiler.startPhase("first");
+    profiler.stopPhase("first");
+
+    const std::string report = profiler.toString();
+    ASSERT_THAT(report, Not(IsEmpty()));
+    EXPECT_LT(report.find("second"), report.find("first"));
+    EXPECT_THAT(report, HasSubstr("wall"));
+    EXPECT_THAT(report, Not(HasSubstr("allocation(s)")));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ProfilerTestSuite, aggregateRunsOfTheSamePhase)
+{
+    const Profiler profiler;
+
+    for (int run = 0; run < 3; ++run) {
+        profiler.startPhase("phase");
+        profiler.stopPhase("phase");
+    }
+
+    EXPECT_THAT(profiler.toString(), HasSubstr("phase: 3 run(s)"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ProfilerTestSuite, ignoreStopOfAPhaseThatIsNotMeasured)
+{
+    const Profiler profiler;
+
+    profiler.startPhase("phase");
+    profiler.stopPhase("other");
+    profiler.stopPhase("phase");
+    profiler.stopPhase("phase");
+
+    const std::string report = profiler.toString();
+    EXPECT_THAT(report, HasSubstr("phase: 1 run(s)"));
+    EXPECT_THAT(report, Not(HasSubstr("other")));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ProfilerTestSuite, countAllocationsAndSystemCallsPerPhase)
+{
+    const NiceMock<MockOsal> mockOsal;
+    const CountingOsal osal(mockOsal);
+    const Profiler profiler(true, &osal, &AllocationCounter::count);
+
+    ON_CALL(mockOsal, createProcess())
+        .WillByDefault(Return(IOsal::ProcessId::PARENT));
+
+    std::vector<std::unique_ptr<int>> pointers;
+    pointers.reserve(3);
+
+    profiler.startPhase("allocate");
+    for (int index = 0; index < 3; ++index) {
+        pointers.push_back(std::make_unique<int>(index));
+    }
+    profiler.stopPhase("allocate");
+
+    profiler.startPhase("spawn");
+    for (int index = 0; index < 2; ++index) {
+        (void)osal.createProcess();
+        (void)osal.waitChildProcess();
+    }
+    profiler.stopPhase("spawn");
+
+    const std::string report = profiler.toString();
+    const std::string allocate = report.substr(report.find("allocate:"));
+    const std::string spawn    = report.substr(report.find("spawn:"));
+
+    EXPECT_THAT(allocate, HasSubstr(" 3 allocation(s), 0 fork(s)"));
+    EXPECT_THAT(spawn, HasSubstr("2 fork(s), 0 exec(s), 2 wait(s), 0 close(s)"));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
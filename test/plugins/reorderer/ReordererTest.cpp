@@ -0,0 +1,329 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <fstream>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockExecutor.h"
+#include "mocks/MockWriter.h"
+
+#include "plugins/reorderer/Reorderer.h"
+
+using ::testing::_;
+using ::testing::HasSubstr;
+using ::testing::IsEmpty;
+using ::testing::SaveArg;
+
+using namespace service::plugins::config;
+using namespace service::plugins::reorderer;
+using namespace utils::command;
+using namespace utils::file;
+
+namespace {
+
+/* Make "<program>-save -c -f <file>" write "dump" into <file> */
+auto save(const std::string& program, const std::string& dump)
+{
+    return [program, dump](const IExecutor::ProgramParams& params) {
+        ASSERT_EQ(params.pathname, program + "-save");
+        ASSERT_STREQ(params.argv[1], "-c");
+        ASSERT_STREQ(params.argv[2], "-f");
+        std::ofstream(params.argv[3]) << dump;
+    };
+}
+
+auto restore(const std::string& program)
+{
+    return [program](const IExecutor::ProgramParams& params) {
+        ASSERT_EQ(params.pathname, program + "-restore");
+        ASSERT_STREQ(params.argv[1], "-c");
+        ASSERT_NE(params.argv[2], nullptr);
+    };
+}
+
+const ConfigData IPV4_CONFIG {{}, {{"rule", {"/sbin/iptables -A INPUT -j DROP"}}}};
+
+/* Record the families then reorder them, as the service does */
+void reorder(const Reorderer& reorderer, const ConfigData& configData)
+{
+    reorderer.prepare(configData);
+    reorderer.reorder();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, disabledReordererShouldDoNothing)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter, false);
+
+    EXPECT_CALL(mockExecutor, executeProgram).Times(0);
+
+    reorder(reorderer, IPV4_CONFIG);
+    ASSERT_THAT(reorderer.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, onlyReadCountersOfFamiliesUsedByRules)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram).Times(0);
+    reorder(reorderer, {{}, {{"rule", {"/sbin/ip link set eth0 up"}}}});
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("ip6tables", "*filter\n:INPUT ACCEPT [0:0]\nCOMMIT\n"))
+        .WillOnce(save("/sbin/iptables", "*filter\n:INPUT ACCEPT [0:0]\nCOMMIT\n"));
+    reorder(reorderer,
+            {{},
+             {{"rule1", {"/sbin/iptables -A INPUT -j DROP"}},
+              {"rule2", {"ip6tables -A INPUT -j DROP"}}}});
+
+    ASSERT_THAT(reorderer.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, reorderFamiliesRecordedBeforeCommandsAreReleased)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    ConfigData configData = IPV4_CONFIG;
+    reorderer.prepare(configData);
+    configData.rules.front().commands.clear();
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables", "*filter\n:INPUT ACCEPT [0:0]\nCOMMIT\n"));
+    reorderer.reorder();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, moveHotRulesUpPastDisjointRules)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+    std::string content;
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables",
+                       "# Generated by iptables-save\n"
+                       "*filter\n"
+                       ":INPUT ACCEPT [0:0]\n"
+                       ":FORWARD DROP [0:0]\n"
+                       "[1:60] -A INPUT -p udp -m udp --dport 53 -j ACCEPT\n"
+                       "[2:120] -A INPUT -p tcp -m tcp --dport 22 -j DROP\n"
+                       "[900:54000] -A INPUT -p tcp -m tcp --dport 443 -j ACCEPT\n"
+                       "[100:6000] -A FORWARD -i eth0 -j DROP\n"
+                       "[500:30000] -A FORWARD -i eth1 -j LOG\n"
+                       "COMMIT\n"
+                       "# Completed\n"))
+        .WillOnce(restore("/sbin/iptables"));
+    EXPECT_CALL(mockWriter, writeToStream(_, _)).WillOnce(SaveArg<1>(&content));
+
+    reorder(reorderer, IPV4_CONFIG);
+
+    ASSERT_EQ(content,
+              "*filter\n"
+              ":INPUT ACCEPT [0:0]\n"
+              ":FORWARD DROP [0:0]\n"
+              "[900:54000] -A INPUT -p tcp -m tcp --dport 443 -j ACCEPT\n"
+              "[2:120] -A INPUT -p tcp -m tcp --dport 22 -j DROP\n"
+              "[1:60] -A INPUT -p udp -m udp --dport 53 -j ACCEPT\n"
+              "[500:30000] -A FORWARD -i eth1 -j LOG\n"
+              "[100:6000] -A FORWARD -i eth0 -j DROP\n"
+              "COMMIT\n");
+    ASSERT_EQ(reorderer.toString(),
+              "Reordering:\n"
+              "  iptables filter INPUT: 2 rules moved, 2705 -> 907 rule "
+              "evaluations (-66%)\n"
+              "  iptables filter FORWARD: 2 rules moved, 1100 -> 700 rule "
+              "evaluations (-36%)\n");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, onlyReportChangesOfTheLastConfig)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables",
+                       "*filter\n"
+                       ":INPUT ACCEPT [0:0]\n"
+                       "[1:60] -A INPUT -p udp -m udp --dport 53 -j ACCEPT\n"
+                       "[900:54000] -A INPUT -p tcp -m tcp --dport 443 -j ACCEPT\n"
+                       "COMMIT\n"))
+        .WillOnce(restore("/sbin/iptables"))
+        .WillOnce(save("/sbin/iptables", "*filter\n:INPUT ACCEPT [0:0]\nCOMMIT\n"));
+
+    reorder(reorderer, IPV4_CONFIG);
+    ASSERT_THAT(reorderer.toString(), HasSubstr("iptables filter INPUT"));
+
+    // A resident service reorders again after each apply
+    reorder(reorderer, IPV4_CONFIG);
+    ASSERT_THAT(reorderer.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, moveRulesPastNegationsAndSameVerdicts)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+    std::string content;
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables",
+                       "*mangle\n"
+                       ":PREROUTING ACCEPT [0:0]\n"
+                       "[1:60] -A PREROUTING -i eth+ -j MARK --set-xmark 0x1\n"
+                       "[9:540] -A PREROUTING -i eth1 -j MARK --set-xmark 0x2\n"
+                       "COMMIT\n"
+                       "*filter\n"
+                       ":OUTPUT ACCEPT [0:0]\n"
+                       "[1:60] -A OUTPUT -o lo -j ACCEPT\n"
+                       "[8:480] -A OUTPUT -d 127.0.0.0/8 -j ACCEPT\n"
+                       "[2:120] -A OUTPUT ! -o eth0 -j DROP\n"
+                       "[9:540] -A OUTPUT -o eth0 -j REJECT\n"
+                       "COMMIT\n"))
+        .WillOnce(restore("/sbin/iptables"));
+    EXPECT_CALL(mockWriter, writeToStream(_, _)).WillOnce(SaveArg<1>(&content));
+
+    reorder(reorderer, IPV4_CONFIG);
+
+    // Rules of the mangle table overlap ("eth+" matches eth1)
+    ASSERT_EQ(content,
+              "*filter\n"
+              ":OUTPUT ACCEPT [0:0]\n"
+              "[8:480] -A OUTPUT -d 127.0.0.0/8 -j ACCEPT\n"
+              "[9:540] -A OUTPUT -o eth0 -j REJECT\n"
+              "[1:60] -A OUTPUT -o lo -j ACCEPT\n"
+              "[2:120] -A OUTPUT ! -o eth0 -j DROP\n"
+              "COMMIT\n");
+    ASSERT_THAT(reorderer.toString(),
+                HasSubstr("iptables filter OUTPUT: 4 rules moved, 59 -> 37 rule "
+                          "evaluations (-37%)"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, keepOverlappingAndStatefulRulesInPlace)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables",
+                       "*filter\n"
+                       ":INPUT ACCEPT [0:0]\n"
+                       "[1:60] -A INPUT -s 10.0.0.0/8 -j DROP\n"
+                       "[900:54000] -A INPUT -s 10.1.0.0/16 -p tcp -j ACCEPT\n"
+                       "[5:300] -A INPUT -m limit --limit 5/sec -j ACCEPT\n"
+                       "[50:3000] -A INPUT -s 192.168.0.0/16 -j ACCEPT\n"
+                       "[70:4200] -A INPUT -i eth0 -m comment --comment \"a b\" "
+                       "-j DROP\n"
+                       "[80:4800] -A INPUT -p 6 -j DROP\n"
+                       "[90:5400] -A INPUT -p tcp -j ACCEPT\n"
+                       "COMMIT\n"));
+    EXPECT_CALL(mockWriter, writeToStream).Times(0);
+
+    reorder(reorderer, IPV4_CONFIG);
+    ASSERT_THAT(reorderer.toString(), IsEmpty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, restoreEachFamilyWithItsOwnTool)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/ip6tables",
+                       "*filter\n"
+                       ":INPUT ACCEPT [0:0]\n"
+                       "[1:80] -A INPUT -s 2001:db8::/32 -j DROP\n"
+                       "[7:560] -A INPUT -s 2001:db9::/32 -j ACCEPT\n"
+                       "COMMIT\n"))
+        .WillOnce(restore("/sbin/ip6tables"));
+    EXPECT_CALL(mockWriter, writeToStream);
+
+    reorder(reorderer, {{}, {{"rule", {"/sbin/ip6tables -A INPUT -j DROP"}}}});
+    ASSERT_THAT(reorderer.toString(),
+                HasSubstr("ip6tables filter INPUT: 2 rules moved, 15 -> 9 rule "
+                          "evaluations (-40%)"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, useTheToolsNextToTheConfiguredProgram)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/usr/sbin/iptables",
+                       "*filter\n"
+                       ":INPUT ACCEPT [0:0]\n"
+                       "[1:60] -A INPUT -s 10.0.0.0/8 -j DROP\n"
+                       "[7:420] -A INPUT -s 192.168.0.0/16 -j DROP\n"
+                       "COMMIT\n"))
+        .WillOnce(restore("/usr/sbin/iptables"));
+    EXPECT_CALL(mockWriter, writeToStream);
+
+    reorder(reorderer, {{}, {{"rule", {"/usr/sbin/iptables -A INPUT -j DROP"}}}});
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ReordererTestSuite, throwOnUnexpectedOutput)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Reorderer reorderer(mockExecutor, mockWriter);
+
+    EXPECT_CALL(mockExecutor, executeProgram)
+        .WillOnce(save("/sbin/iptables", "[1:60] -A INPUT -j DROP\n"));
+
+    ASSERT_THROW(reorder(reorderer, IPV4_CONFIG), std::runtime_error);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
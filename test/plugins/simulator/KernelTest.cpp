@@ -0,0 +1,354 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "plugins/simulator/kernel/Kernel.h"
+
+using namespace service::plugins::simulator::kernel;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+class KernelTestFixture : public ::testing::Test {
+
+protected:
+    /* Split the command on spaces then execute it */
+    void execute(const std::string& command) const
+    {
+        std::vector<std::string> arguments;
+        std::size_t start = 0;
+        while (start < command.size()) {
+            const std::size_t end = command.find(' ', start);
+            arguments.push_back(command.substr(start, end - start));
+            start = (end == std::string::npos) ? command.size() : end + 1;
+        }
+
+        std::vector<const char*> argv;
+        for (const std::string& argument : arguments) {
+            argv.push_back(argument.c_str());
+        }
+
+        m_kernel.execute(static_cast<int>(argv.size()), argv.data());
+    }
+
+    /* Write a file removed at the end of the test */
+    std::string writeFile(const std::string& name, const std::string& content)
+    {
+        const std::string pathname = ::testing::TempDir() + name;
+        std::ofstream(pathname) << content;
+        m_files.push_back(pathname);
+
+        return pathname;
+    }
+
+    void TearDown() override
+    {
+        for (const std::string& pathname : m_files) {
+            (void)std::remove(pathname.c_str());
+        }
+    }
+
+    static CostModel costModel()
+    {
+        CostModel model;
+        model.spawn       = 100us;
+        model.netlink     = 10us;
+        model.sysctl      = 5us;
+        model.ruleRewrite = 1us;
+        model.restoreRule = 50ns;
+        model.setEntry    = 2ns;
+        model.writeByte   = 1ns;
+
+        return model;
+    }
+
+    const Kernel m_kernel = Kernel(costModel());
+
+private:
+    std::vector<std::string> m_files;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldManageInterfacesAndTheirAddresses)
+{
+    ASSERT_TRUE(m_kernel.hasInterface("lo"));
+    ASSERT_FALSE(m_kernel.hasInterface("dummy0"));
+
+    execute("/sbin/ip link add dummy0 type dummy");
+    execute("/sbin/ip addr add 10.0.0.1/24 dev dummy0");
+    execute("/sbin/ip -6 a add fd00::1/64 dev dummy0");
+    execute("/sbin/ip link set dev dummy0 up");
+
+    ASSERT_TRUE(m_kernel.hasInterface("dummy0"));
+    ASSERT_EQ(m_kernel.addresses("dummy0"),
+              std::vector<std::string>({"10.0.0.1/24", "fd00::1/64"}));
+
+    execute("/sbin/ip address del 10.0.0.1/24 dev dummy0");
+    ASSERT_EQ(m_kernel.addresses("dummy0"),
+              std::vector<std::string>({"fd00::1/64"}));
+
+    execute("/sbin/ip link delete dummy0");
+    ASSERT_FALSE(m_kernel.hasInterface("dummy0"));
+
+    ASSERT_EQ(m_kernel.nbPrograms(), 6);
+    ASSERT_EQ(m_kernel.elapsed(), 6 * (100us + 10us));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldFailLikeIpWhenTheInterfaceIsInvalid)
+{
+    ASSERT_THROW(execute("/sbin/ip link set dev dummy0 up"), std::runtime_error);
+    ASSERT_THROW(execute("/sbin/ip addr add 10.0.0.1/24 dev dummy0"),
+                 std::runtime_error);
+    ASSERT_THROW(execute("/sbin/ip link add lo type dummy"), std::runtime_error);
+
+    // Failing programs are paid too
+    ASSERT_EQ(m_kernel.elapsed(), 3 * 100us);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldEditChainsLikeIptables)
+{
+    execute("/sbin/iptables -A INPUT -s 10.0.0.1 -j DROP");
+    execute("/sbin/iptables -w -A INPUT -s 10.0.0.3 -j DROP");
+    execute("/sbin/iptables -I INPUT 2 -s 10.0.0.2 -j DROP");
+    execute("/sbin/iptables -I INPUT -i lo -j ACCEPT");
+
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>({"-i lo -j ACCEPT",
+                                        "-s 10.0.0.1 -j DROP",
+                                        "-s 10.0.0.2 -j DROP",
+                                        "-s 10.0.0.3 -j DROP"}));
+
+    execute("/sbin/iptables -D INPUT -s 10.0.0.2 -j DROP");
+    execute("/sbin/iptables -D INPUT 1");
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>(
+                  {"-s 10.0.0.1 -j DROP", "-s 10.0.0.3 -j DROP"}));
+
+    execute("/sbin/iptables -t nat -N CUSTOM");
+    execute("/sbin/iptables -t nat -A CUSTOM -j RETURN");
+    ASSERT_EQ(m_kernel.rules("iptables", "nat", "CUSTOM").size(), 1);
+    ASSERT_TRUE(m_kernel.rules("ip6tables", "filter", "INPUT").empty());
+
+    execute("/sbin/iptables -t nat -F");
+    execute("/sbin/iptables -t nat -X CUSTOM");
+    ASSERT_TRUE(m_kernel.rules("iptables", "nat", "CUSTOM").empty());
+    ASSERT_THROW(execute("/sbin/iptables -t nat -A CUSTOM -j RETURN"),
+                 std::runtime_error);
+    ASSERT_THROW(execute("/sbin/iptables -D INPUT -j ACCEPT"), std::runtime_error);
+    ASSERT_THROW(execute("/sbin/iptables -t unknown -L"), std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldRejectInsertionsOutsideTheChain)
+{
+    ASSERT_THROW(execute("/sbin/iptables -I INPUT 0 -j DROP"), std::runtime_error);
+    ASSERT_THROW(execute("/sbin/iptables -I INPUT 2 -j DROP"), std::runtime_error);
+    ASSERT_TRUE(m_kernel.rules("iptables", "filter", "INPUT").empty());
+
+    execute("/sbin/iptables -I INPUT 1 -j DROP");
+    execute("/sbin/iptables -I INPUT 2 -j ACCEPT");
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>({"-j DROP", "-j ACCEPT"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldReplaceTablesRestoredByIptablesRestore)
+{
+    execute("/sbin/iptables -A INPUT -j ACCEPT");
+    execute("/sbin/iptables -A OUTPUT -j ACCEPT");
+
+    const std::string file = writeFile("filter.rules",
+                                       "# Generated\n"
+                                       "*filter\n"
+                                       ":INPUT ACCEPT [0:0]\n"
+                                       ":CUSTOM - [0:0]\n"
+                                       "[1:60] -A INPUT -j CUSTOM\n"
+                                       "-A CUSTOM -s 10.0.0.1 -j DROP\n"
+                                       "-I CUSTOM 1 -s 10.0.0.2 -j DROP\n"
+                                       "COMMIT\n");
+
+    const std::chrono::nanoseconds before = m_kernel.elapsed();
+    execute("/sbin/iptables-restore -c " + file);
+
+    // A single rewrite of the 3 rules plus the parsing of each one
+    ASSERT_EQ(m_kernel.elapsed() - before, 100us + 3 * 1us + 3 * 50ns);
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>({"-j CUSTOM"}));
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "CUSTOM"),
+              std::vector<std::string>(
+                  {"-s 10.0.0.2 -j DROP", "-s 10.0.0.1 -j DROP"}));
+    ASSERT_TRUE(m_kernel.rules("iptables", "filter", "OUTPUT").empty());
+
+    // Rules are added to the current ones with --noflush
+    execute("/sbin/iptables-restore --noflush "
+            + writeFile("more.rules", "*filter\n-A INPUT -j DROP\nCOMMIT\n"));
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>({"-j CUSTOM", "-j DROP"}));
+
+    // Nothing is committed from an invalid table
+    ASSERT_THROW(execute("/sbin/iptables-restore "
+                         + writeFile("invalid.rules",
+                                     "*filter\n-A INPUT -j ACCEPT\n"
+                                     "-A UNKNOWN -j DROP\nCOMMIT\n")),
+                 std::runtime_error);
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT").size(), 2);
+    ASSERT_THROW(execute("/sbin/iptables-restore /nonexistent"), std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldLoadSetsRestoredByIpset)
+{
+    const std::string file = writeFile("blocklist.ipset",
+                                       "create blocklist hash:net family inet\n"
+                                       "flush blocklist\n"
+                                       "add blocklist 10.0.0.0/8\n"
+                                       "add blocklist 192.168.0.0/16\n"
+                                       "add blocklist 10.0.0.0/8\n");
+
+    const std::chrono::nanoseconds before = m_kernel.elapsed();
+    execute("/sbin/ipset -exist -file " + file + " restore");
+    ASSERT_EQ(m_kernel.elapsed() - before, 100us + 3 * 2ns);
+    ASSERT_EQ(m_kernel.setSize("blocklist"), 2);
+
+    // Restoring again only works because of -exist
+    ASSERT_THROW(execute("/sbin/ipset -file " + file + " restore"),
+                 std::runtime_error);
+    ASSERT_THROW(execute("/sbin/ipset restore"), std::runtime_error);
+
+    execute("/sbin/ipset create blocklist-new hash:net");
+    execute("/sbin/ipset add blocklist-new 172.16.0.0/12");
+    execute("/sbin/ipset swap blocklist-new blocklist");
+    ASSERT_EQ(m_kernel.setSize("blocklist"), 1);
+    ASSERT_EQ(m_kernel.setSize("blocklist-new"), 2);
+
+    ASSERT_THROW(execute("/sbin/ipset rename blocklist-new blocklist"),
+                 std::runtime_error);
+    execute("/sbin/ipset rename blocklist-new allowlist");
+    ASSERT_EQ(m_kernel.setSize("allowlist"), 2);
+    ASSERT_THROW(execute("/sbin/ipset add blocklist-new 10.0.0.1"),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldApplyNftScriptsAsOneTransaction)
+{
+    const std::string file
+        = writeFile("filter.nft",
+                    "add table inet filter\n"
+                    "add chain inet filter input { type filter hook input "
+                    "priority 0; policy accept; }\n"
+                    "add set inet filter blocked { type ipv4_addr; flags "
+                    "interval; }\n"
+                    "add element inet filter blocked { 10.0.0.1,\n"
+                    "10.0.0.2,\n10.0.0.0/24 }\n"
+                    "add rule inet filter input ip saddr @blocked drop; "
+                    "add rule inet filter input tcp dport 22 accept\n");
+
+    const std::chrono::nanoseconds before = m_kernel.elapsed();
+    execute("/usr/sbin/nft -f " + file);
+
+    ASSERT_EQ(m_kernel.elapsed() - before, 100us + 10us + 2 * 50ns + 3 * 2ns);
+    ASSERT_EQ(m_kernel.rules("nft", "inet filter", "input"),
+              std::vector<std::string>(
+                  {"ip saddr @blocked drop", "tcp dport 22 accept"}));
+    ASSERT_EQ(m_kernel.nftSetSize("inet filter", "blocked"), 3);
+
+    execute("/usr/sbin/nft insert rule inet filter input iifname lo accept");
+    ASSERT_EQ(m_kernel.rules("nft", "inet filter", "input").front(),
+              "iifname lo accept");
+
+    // A failing statement leaves the ruleset untouched
+    ASSERT_THROW(execute("/usr/sbin/nft -f "
+                         + writeFile("invalid.nft",
+                                     "flush chain inet filter input\n"
+                                     "add rule inet filter unknown drop\n")),
+                 std::runtime_error);
+    ASSERT_EQ(m_kernel.rules("nft", "inet filter", "input").size(), 3);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldChargeTheWholeTableForEachIptablesInvocation)
+{
+    constexpr std::size_t NB_RULES = 100;
+
+    for (std::size_t index = 0; index < NB_RULES; ++index) {
+        execute("/sbin/iptables -A INPUT -j DROP");
+    }
+
+    // 0 + 1 + ... + 99 rules rewritten
+    ASSERT_EQ(m_kernel.elapsed(),
+              NB_RULES * 100us + (NB_RULES * (NB_RULES - 1) / 2) * 1us);
+
+    // Other tables are not rewritten
+    const std::chrono::nanoseconds before = m_kernel.elapsed();
+    execute("/sbin/ip6tables -A INPUT -j DROP");
+    ASSERT_EQ(m_kernel.elapsed() - before, 100us);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(KernelTestFixture, shouldManageSysctlsSetsAndWrites)
+{
+    ASSERT_FALSE(m_kernel.sysctl("/proc/sys/net/ipv4/ip_forward").has_value());
+    m_kernel.writeSysctl("/proc/sys/net/ipv4/ip_forward", "1");
+    ASSERT_EQ(m_kernel.sysctl("/proc/sys/net/ipv4/ip_forward"), "1");
+
+    m_kernel.loadSet("blocklist", 1000);
+    ASSERT_EQ(m_kernel.setSize("blocklist"), 1000);
+
+    execute("/sbin/ipset create allowlist hash:net");
+    execute("/sbin/ipset add allowlist 10.0.0.0/8");
+    ASSERT_EQ(m_kernel.setSize("allowlist"), 1);
+    ASSERT_THROW(execute("/sbin/ipset add unknown 10.0.0.0/8"), std::runtime_error);
+
+    m_kernel.write(4096);
+
+    // Programs that are not modelled only cost a spawn
+    execute("/sbin/tc qdisc show");
+
+    ASSERT_EQ(m_kernel.nbPrograms(), 4);
+    ASSERT_EQ(m_kernel.elapsed(), 5us + 1000 * 2ns + 4 * 100us + 2ns + 4096ns);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,86 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "plugins/simulator/SimulatedNetwork.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+
+namespace {
+
+class SimulatedNetworkTestFixture : public ::testing::Test {
+
+protected:
+    const Kernel m_kernel = Kernel(CostModel());
+    const SimulatedNetwork m_network = SimulatedNetwork(m_kernel);
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SimulatedNetworkTestFixture, shouldApplyInterfaceCommandsToTheKernel)
+{
+    ASSERT_FALSE(m_network.hasInterface("dummy0"));
+
+    m_network.applyInterfaceCommands({"/sbin/ip link add dummy0 type dummy",
+                                      "/sbin/ip addr add 10.0.0.1/32 dev dummy0"});
+
+    ASSERT_TRUE(m_network.hasInterface("dummy0"));
+    ASSERT_EQ(m_kernel.addresses("dummy0"),
+              std::vector<std::string>({"10.0.0.1/32"}));
+    ASSERT_EQ(m_kernel.nbPrograms(), 2);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SimulatedNetworkTestFixture, shouldFailWhenAnInterfaceCommandFails)
+{
+    ASSERT_THROW(m_network.applyInterfaceCommands({"/sbin/ip link set dummy0 up"}),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SimulatedNetworkTestFixture, shouldSetSysctlsInsteadOfWritingFiles)
+{
+    const std::string pathname("/proc/sys/net/ipv4/ip_forward");
+
+    m_network.applyLayerCommands({{pathname, "1"}});
+
+    ASSERT_EQ(m_kernel.sysctl(pathname), "1");
+    ASSERT_EQ(m_kernel.nbPrograms(), 0);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <fstream>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "plugins/simulator/SimulatedRuleFactory.h"
+#include "utils/file/temporary/TemporaryFile.h"
+
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::simulator;
+using namespace service::plugins::simulator::kernel;
+using namespace utils::file;
+
+namespace {
+
+class SimulatedRuleTestFixture : public ::testing::Test {
+
+protected:
+    const Kernel m_kernel = Kernel(CostModel());
+    const SimulatedRuleFactory m_ruleFactory = SimulatedRuleFactory(m_kernel);
+    std::vector<ConfigData::Rule::AddressSet> m_sets;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SimulatedRuleTestFixture, shouldApplyCommandsToTheKernel)
+{
+    const std::vector<std::string> commands
+        = {"/sbin/iptables -A INPUT -s 10.0.0.1 -j DROP",
+           "/sbin/iptables -A INPUT -s 10.0.0.2 -j DROP"};
+
+    const std::unique_ptr<IRule> rule
+        = m_ruleFactory.createRule("rule", commands, m_sets);
+    rule->applyCommands();
+
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT"),
+              std::vector<std::string>(
+                  {"-s 10.0.0.1 -j DROP", "-s 10.0.0.2 -j DROP"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(SimulatedRuleTestFixture, shouldLoadOneSetEntryPerAddressLine)
+{
+    const TemporaryFile file;
+    {
+        std::ofstream stream(file.pathname());
+        stream << "# Blocklist\n10.0.0.1\n\n  10.0.1.0/24\n  # Comment\n10.0.2.1";
+    }
+
+    m_sets.push_back({"blocklist", file.pathname()});
+    const std::vector<std::string> commands
+        = {"/sbin/iptables -A INPUT -m set --match-set blocklist src -j DROP"};
+
+    const std::unique_ptr<IRule> rule
+        = m_ruleFactory.createRule("rule", commands, m_sets);
+    rule->applyCommands();
+
+    ASSERT_EQ(m_kernel.setSize("blocklist"), 3);
+    ASSERT_EQ(m_kernel.rules("iptables", "filter", "INPUT").size(), 1);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
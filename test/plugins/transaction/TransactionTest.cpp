@@ -0,0 +1,335 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "fakes/MockOS.h"
+#include "mocks/MockExecutor.h"
+#include "mocks/MockWriter.h"
+
+#include "plugins/transaction/Transaction.h"
+
+using ::testing::_;
+using ::testing::ElementsAre;
+using ::testing::Return;
+using ::testing::Sequence;
+using ::testing::StartsWith;
+using ::testing::StrEq;
+using ::testing::Throw;
+
+using namespace service::plugins::config;
+using namespace service::plugins::transaction;
+using namespace utils::command;
+using namespace utils::file;
+
+MockOS* gMockOS = nullptr;
+
+namespace {
+
+constexpr const char* const IPTABLES = "/sbin/iptables -A INPUT -j DROP";
+
+class TransactionTestFixture : public ::testing::Test {
+
+protected:
+    TransactionTestFixture() : m_transaction(m_mockExecutor, m_mockWriter) {}
+
+    void SetUp() override
+    {
+        gMockOS = &m_mockOS;
+
+        std::ofstream(m_forwardPathname) << "0\n";
+        std::ofstream(m_portRangePathname) << "32768\t60999\n";
+    }
+
+    void TearDown() override
+    {
+        gMockOS = nullptr;
+
+        (void)std::remove(m_forwardPathname.c_str());
+        (void)std::remove(m_portRangePathname.c_str());
+    }
+
+    MockExecutor m_mockExecutor;
+    MockWriter m_mockWriter;
+    Transaction m_transaction;
+
+    MockOS m_mockOS;
+
+    const std::string m_forwardPathname
+        = ::testing::TempDir() + "TransactionTest_ip_forward";
+    const std::string m_portRangePathname
+        = ::testing::TempDir() + "TransactionTest_port_range";
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TransactionTestSuite, disabledTransactionShouldDoNothing)
+{
+    const MockExecutor mockExecutor;
+    const MockWriter mockWriter;
+    const Transaction transaction(mockExecutor, mockWriter, false);
+
+    EXPECT_CALL(mockExecutor, executeProgram).Times(0);
+    EXPECT_CALL(mockWriter, writeToStream).Times(0);
+
+    transaction.begin({{{}, {"command"}, {{"/does/not/exist", "1"}}},
+                       {{"rule", {"command"}}}});
+    transaction.rollback();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, saveFirewallOnlyWhenThereAreRules)
+{
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/sbin/iptables-save");
+            ASSERT_STREQ(params.argv[1], "-f");
+            ASSERT_NE(params.argv[2], nullptr);
+        });
+
+    m_transaction.begin({{}, {{"rule", {IPTABLES}}}});
+    m_transaction.begin({{}, {{"rule", {"/bin/true"}}}});
+    m_transaction.begin({{}, {}});
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, saveEachFirewallWithTheConfiguredBinaries)
+{
+    std::vector<std::string> pathnames;
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .Times(4)
+        .WillRepeatedly([&pathnames](const IExecutor::ProgramParams& params) {
+            pathnames.emplace_back(params.pathname);
+        });
+    EXPECT_CALL(m_mockWriter,
+                writeToStream(_, StartsWith("exec /opt/nft list ruleset > ")));
+
+    ConfigData::Rule rule = {"rule",
+                             {"/opt/nft add rule inet filter input drop",
+                              "/usr/sbin/ip6tables -A INPUT -j DROP",
+                              "/usr/sbin/iptables -A INPUT -j DROP"}};
+    rule.sets.push_back({"blocklist", "/path/to/blocklist"});
+    m_transaction.begin({{}, {rule}});
+
+    // In the order of the restore, sets last
+    ASSERT_THAT(pathnames,
+                ElementsAre("/usr/sbin/iptables-save",
+                            "/usr/sbin/ip6tables-save",
+                            "/bin/sh",
+                            "/sbin/ipset"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackRestoresFirewallWithASingleCommand)
+{
+    std::string savedPathname;
+
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce([&savedPathname](const IExecutor::ProgramParams& params) {
+            savedPathname = params.argv[2];
+        })
+        .WillOnce([&savedPathname](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/usr/sbin/iptables-restore");
+            ASSERT_EQ(params.argv[1], savedPathname);
+            ASSERT_EQ(params.argv[2], nullptr);
+        });
+
+    const std::string iptables = "/usr/sbin/iptables -A INPUT -j DROP";
+    m_transaction.begin({{}, {{"rule1", {iptables}}, {"rule2", {iptables}}}});
+    m_transaction.rollback();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackWritesSavedValuesBackInReverseOrder)
+{
+    {
+        Sequence seq;
+
+        EXPECT_CALL(m_mockWriter, writeToStream(_, "32768\t60999")).InSequence(seq);
+        EXPECT_CALL(m_mockWriter, writeToStream(_, "0")).InSequence(seq);
+    }
+
+    m_transaction.begin(
+        {{{}, {}, {{m_forwardPathname, "1"}, {m_portRangePathname, "1 2"}}}, {}});
+    m_transaction.rollback();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, beginFailsWhenAValueCannotBeSaved)
+{
+    ASSERT_THROW(m_transaction.begin({{{}, {}, {{"/does/not/exist", "1"}}}, {}}),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackDeletesCreatedInterfacesInOneBatch)
+{
+    char lo[]    = "lo";
+    char tap10[] = "tap10";
+    char tap11[] = "tap11";
+
+    struct if_nameindex before[] = {{1, static_cast<char*>(lo)}, {0, nullptr}};
+    struct if_nameindex after[]  = {{1, static_cast<char*>(lo)},
+                                   {2, static_cast<char*>(tap10)},
+                                   {3, static_cast<char*>(tap11)},
+                                   {0, nullptr}};
+
+    EXPECT_CALL(m_mockOS, if_nameindex)
+        .WillOnce(Return(static_cast<struct if_nameindex*>(before)))
+        .WillOnce(Return(static_cast<struct if_nameindex*>(after)));
+    EXPECT_CALL(m_mockOS, if_freenameindex).Times(2);
+
+    // tap11 has been created by someone else meanwhile
+    EXPECT_CALL(m_mockWriter, writeToStream(_, "link delete tap10\n"));
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/usr/sbin/ip");
+            ASSERT_STREQ(params.argv[1], "-force");
+            ASSERT_STREQ(params.argv[2], "-batch");
+        });
+
+    m_transaction.begin({{{}, {"/usr/sbin/ip tuntap add tap10 mode tap"}, {}}, {}});
+    m_transaction.rollback();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackReplacesTheNftRulesetInOneTransaction)
+{
+    std::string savedPathname;
+    EXPECT_CALL(m_mockWriter, writeToStream(_, StartsWith("exec /usr/sbin/nft")))
+        .WillOnce([&savedPathname](std::ostream& /*stream*/,
+                                   const std::string& data) {
+            savedPathname = data.substr(data.rfind(' ') + 1);
+            savedPathname.pop_back();
+        });
+    EXPECT_CALL(m_mockWriter, writeToStream(_, StartsWith("flush ruleset\n")))
+        .WillOnce([&savedPathname](std::ostream& /*stream*/,
+                                   const std::string& data) {
+            ASSERT_EQ(data, "flush ruleset\ninclude \"" + savedPathname + "\"\n");
+        });
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/bin/sh");
+        })
+        .WillOnce([](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.pathname, "/usr/sbin/nft");
+            ASSERT_STREQ(params.argv[1], "-f");
+        });
+
+    ConfigData::Rule rule = {"rule", {}};
+    rule.sets.push_back({"blocklist", "/path/to/blocklist", "inet", "nft"});
+    m_transaction.begin({{}, {rule}});
+    m_transaction.rollback();
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackSwapsSavedSetsBackAndDestroysNewOnes)
+{
+    // "ipset save" writes to the file following "-file"
+    auto save = [](const std::string& content) {
+        return [content](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.argv[3], "save");
+            std::ofstream(params.argv[2]) << content;
+        };
+    };
+
+    std::string batch;
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce(save("create blocklist hash:net family inet maxelem 65536\n"
+                       "add blocklist 10.0.0.0/8\n"
+                       "create allowlist hash:ip family inet\n"))
+        .WillOnce(save("create blocklist hash:net family inet maxelem 131072\n"
+                       "add blocklist 10.0.0.0/8\n"
+                       "add blocklist 10.1.0.0/16\n"
+                       "create blocklist.tmp hash:net family inet\n"))
+        .WillOnce([&batch](const IExecutor::ProgramParams& params) {
+            ASSERT_STREQ(params.argv[3], "restore");
+            std::stringstream content;
+            content << std::ifstream(params.argv[2]).rdbuf();
+            batch = content.str();
+        });
+
+    m_transaction.begin(
+        {{}, {{"rule", {"/sbin/ipset -exist -file /tmp/blocklist restore"}}}});
+    m_transaction.rollback();
+
+    ASSERT_EQ(batch,
+              "create networkservice-rollback hash:net family inet maxelem 65536\n"
+              "add networkservice-rollback 10.0.0.0/8\n"
+              "swap networkservice-rollback blocklist\n"
+              "destroy networkservice-rollback\n"
+              "create allowlist hash:ip family inet\n"
+              "destroy blocklist.tmp\n");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackRestoresEverythingEvenIfAPartFails)
+{
+    EXPECT_CALL(m_mockExecutor, executeProgram)
+        .WillOnce(Return())
+        .WillOnce(Throw(std::runtime_error("iptables-restore failed")));
+    EXPECT_CALL(m_mockWriter, writeToStream(_, "0")).Times(1);
+
+    m_transaction.begin(
+        {{{}, {}, {{m_forwardPathname, "1"}}}, {{"rule", {IPTABLES}}}});
+
+    try {
+        m_transaction.rollback();
+        FAIL() << "Should fail because iptables-restore has failed";
+    }
+    catch (const std::runtime_error& e) {
+        EXPECT_THAT(e.what(), ::testing::HasSubstr("iptables-restore failed"));
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(TransactionTestFixture, rollbackAfterCommitShouldDoNothing)
+{
+    EXPECT_CALL(m_mockExecutor, executeProgram).Times(1);
+    EXPECT_CALL(m_mockWriter, writeToStream).Times(0);
+
+    m_transaction.begin(
+        {{{}, {}, {{m_forwardPathname, "1"}}}, {{"rule", {IPTABLES}}}});
+    m_transaction.commit();
+    m_transaction.rollback();
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
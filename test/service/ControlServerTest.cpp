@@ -0,0 +1,415 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <grp.h>
+#include <iterator>
+#include <memory>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockLogger.h"
+
+#include "service/ControlServer.h"
+
+using ::testing::NiceMock;
+using ::testing::StartsWith;
+
+using namespace service;
+using namespace service::plugins::logger;
+
+namespace {
+
+class ControlServerTestFixture : public ::testing::Test {
+
+protected:
+    ControlServerTestFixture()
+        : m_socketPath("/tmp/ControlServerTest-" + std::to_string(getpid()))
+    {}
+
+    void TearDown() override
+    {
+        if (m_clientFd != -1) {
+            (void)close(m_clientFd);
+        }
+
+        if (m_server) {
+            m_server->stop();
+            m_thread.join();
+        }
+    }
+
+    /* Start serving and connect a client */
+    void start(ControlServer::Apply apply, ControlServer::Report report = nullptr)
+    {
+        m_server = std::make_unique<ControlServer>(
+            m_logger, std::move(apply), m_socketPath, "", std::move(report));
+        m_thread = std::thread([this]() { m_server->run(); });
+
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        m_socketPath.copy(address.sun_path, m_socketPath.size());
+
+        m_clientFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ASSERT_NE(m_clientFd, -1);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        ASSERT_EQ(connect(m_clientFd,
+                          reinterpret_cast<sockaddr*>(&address),
+                          sizeof(address)),
+                  0);
+    }
+
+    void send(const std::string& requests) const
+    {
+        ASSERT_EQ(::send(m_clientFd, requests.data(), requests.size(), 0),
+                  static_cast<ssize_t>(requests.size()));
+    }
+
+    /* Wait for the next response. Empty if none comes in time */
+    std::string receive() const
+    {
+        constexpr int timeoutMs = 5000;
+        std::string line;
+        char byte = 0;
+
+        pollfd pollFd {m_clientFd, POLLIN, 0};
+        while ((poll(&pollFd, 1, timeoutMs) == 1)
+               && (read(m_clientFd, &byte, 1) == 1)) {
+            if (byte == '\n') {
+                return line;
+            }
+            line += byte;
+        }
+
+        return {};
+    }
+
+    NiceMock<MockLogger> m_logger;
+    std::string m_socketPath;
+    std::unique_ptr<ControlServer> m_server;
+    std::thread m_thread;
+    int m_clientFd = -1;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, applyConfigFileSubmittedByPath)
+{
+    std::promise<std::string> appliedFile;
+
+    start([&appliedFile](const std::string& configFile) {
+        appliedFile.set_value(configFile);
+        return EXIT_SUCCESS;
+    });
+
+    send("apply /etc/networkservice.json\n");
+
+    ASSERT_EQ(receive(), "1 ok");
+    ASSERT_EQ(appliedFile.get_future().get(), "/etc/networkservice.json");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, applyConfigSubmittedInline)
+{
+    std::promise<std::string> appliedContent;
+
+    start([&appliedContent](const std::string& configFile) {
+        std::ifstream stream(configFile);
+        appliedContent.set_value(std::string(std::istreambuf_iterator<char>(stream),
+                                             std::istreambuf_iterator<char>()));
+        return EXIT_SUCCESS;
+    });
+
+    send("apply-json {\"network\": {}}\n");
+
+    ASSERT_EQ(receive(), "1 ok");
+    ASSERT_EQ(appliedContent.get_future().get(), "{\"network\": {}}");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, reportConfigsThatFailToBeApplied)
+{
+    start([](const std::string& configFile) {
+        if (configFile == "throw") {
+            throw std::runtime_error("Exception");
+        }
+        return EXIT_FAILURE;
+    });
+
+    send("apply fail\n");
+    ASSERT_EQ(receive(), "1 failed");
+
+    send("apply throw\n");
+    ASSERT_EQ(receive(), "2 failed");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, applyOnlyTheLatestConfigSubmittedWhileApplying)
+{
+    std::promise<void> started;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<std::string> appliedFiles;
+
+    start([&](const std::string& configFile) {
+        appliedFiles.push_back(configFile);
+        if (appliedFiles.size() == 1) {
+            started.set_value();
+            released.wait();
+        }
+        return EXIT_SUCCESS;
+    });
+
+    send("apply a\n");
+    started.get_future().wait();
+
+    // Requests are pipelined: responses are matched by their number
+    send("apply b\napply c\nstatus\n");
+    ASSERT_EQ(receive(), "2 superseded");
+    ASSERT_EQ(receive(), "4 status state=applying pending=1 last=none");
+
+    release.set_value();
+    ASSERT_EQ(receive(), "1 ok");
+    ASSERT_EQ(receive(), "3 ok");
+
+    send("metrics\n");
+    ASSERT_THAT(receive(),
+                StartsWith("5 metrics requests=5 applied=2 failed=0 superseded=1"));
+    ASSERT_EQ(appliedFiles, std::vector<std::string>({"a", "c"}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, answerStatusOfAnIdleService)
+{
+    start([](const std::string& /*configFile*/) { return EXIT_SUCCESS; });
+
+    send("status\r\n");
+    ASSERT_EQ(receive(), "1 status state=idle pending=0 last=none");
+
+    send("apply a\n");
+    ASSERT_EQ(receive(), "2 ok");
+
+    send("status\n");
+    ASSERT_EQ(receive(), "3 status state=idle pending=0 last=ok");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, reportWhatTheLastApplyDid)
+{
+    std::string lastFile;
+
+    start(
+        [&lastFile](const std::string& configFile) {
+            lastFile = configFile;
+            return EXIT_SUCCESS;
+        },
+        [&lastFile]() {
+            return lastFile == "a" ? "Optimizations:\n  ipset: a: 4 commands\n"
+                                   : "";
+        });
+
+    send("report\napply a\n");
+    ASSERT_EQ(receive(), "1 report none");
+    ASSERT_EQ(receive(), "2 ok");
+
+    send("report\napply b\n");
+    ASSERT_EQ(receive(), "3 report Optimizations: | ipset: a: 4 commands");
+    ASSERT_EQ(receive(), "4 ok");
+
+    send("report\n");
+    ASSERT_EQ(receive(), "5 report none");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, rejectInvalidRequests)
+{
+    start([](const std::string& /*configFile*/) { return EXIT_SUCCESS; });
+
+    send("apply\nrestart\n");
+
+    ASSERT_EQ(receive(), "1 error invalid request");
+    ASSERT_EQ(receive(), "2 error invalid request");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, closeConnectionsOfOtherUsers)
+{
+    if (geteuid() != 0) {
+        GTEST_SKIP() << "Connecting as another user requires root";
+    }
+
+    constexpr uid_t nobody  = 65534;
+    constexpr int timeoutMs = 5000;
+
+    start([](const std::string& /*configFile*/) { return EXIT_SUCCESS; });
+
+    // Let anybody connect so that only the credentials are checked
+    ASSERT_EQ(chmod(m_socketPath.c_str(), ACCESSPERMS), 0);
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    m_socketPath.copy(address.sun_path, m_socketPath.size());
+
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        if ((setgid(nobody) == -1) || (setuid(nobody) == -1)) {
+            _exit(2);
+        }
+
+        const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address))
+            == -1) {
+            _exit(3);
+        }
+        (void)::send(fd, "status\n", 7, MSG_NOSIGNAL);
+
+        // Closed before the request is read: the connection may be reset
+        char byte     = 0;
+        pollfd pollFd = {fd, POLLIN, 0};
+        const bool isClosed
+            = (poll(&pollFd, 1, timeoutMs) == 1) && (read(fd, &byte, 1) <= 0);
+        _exit(isClosed ? 0 : 1);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    // Connections of the user of the service are still served
+    send("status\n");
+    ASSERT_THAT(receive(), StartsWith("1 status"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, replaceStaleSocketAndRemoveItWhenDestroyed)
+{
+    struct stat status {};
+
+    // Bound then closed without being removed, as after a crash
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    m_socketPath.copy(address.sun_path, m_socketPath.size());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ASSERT_NE(fd, -1);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    ASSERT_EQ(bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    ASSERT_EQ(close(fd), 0);
+
+    {
+        const ControlServer server(
+            m_logger, [](const std::string&) { return EXIT_SUCCESS; }, m_socketPath);
+        ASSERT_EQ(lstat(m_socketPath.c_str(), &status), 0);
+    }
+
+    ASSERT_EQ(lstat(m_socketPath.c_str(), &status), -1);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, refuseToReplaceSocketOfARunningInstance)
+{
+    struct stat status {};
+
+    const ControlServer first(
+        m_logger, [](const std::string&) { return EXIT_SUCCESS; }, m_socketPath);
+    ASSERT_THROW(ControlServer(m_logger,
+                               [](const std::string&) { return EXIT_SUCCESS; },
+                               m_socketPath),
+                 std::runtime_error);
+
+    ASSERT_EQ(lstat(m_socketPath.c_str(), &status), 0);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, createSocketOnlyAccessibleToItsUser)
+{
+    struct stat status {};
+
+    const ControlServer server(
+        m_logger, [](const std::string&) { return EXIT_SUCCESS; }, m_socketPath);
+
+    ASSERT_EQ(lstat(m_socketPath.c_str(), &status), 0);
+    ASSERT_EQ(status.st_mode & ALLPERMS, S_IRUSR | S_IWUSR);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, giveAccessToTheSocketToAGroup)
+{
+    struct stat status {};
+    const group* const entry = getgrgid(getegid());
+    ASSERT_NE(entry, nullptr);
+
+    const ControlServer server(
+        m_logger, [](const std::string&) { return EXIT_SUCCESS; }, m_socketPath,
+        entry->gr_name);
+
+    ASSERT_EQ(lstat(m_socketPath.c_str(), &status), 0);
+    ASSERT_EQ(status.st_mode & ALLPERMS, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+    ASSERT_EQ(status.st_gid, getegid());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, raiseAnExceptionIfGroupDoesNotExist)
+{
+    ASSERT_THROW(ControlServer(m_logger,
+                               [](const std::string&) { return EXIT_SUCCESS; },
+                               m_socketPath,
+                               "no-such-group-for-control-server"),
+                 std::invalid_argument);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ControlServerTestFixture, raiseAnExceptionIfSocketPathIsTooLong)
+{
+    ASSERT_THROW(ControlServer(m_logger,
+                               [](const std::string&) { return EXIT_SUCCESS; },
+                               "/tmp/" + std::string(256, 'x')),
+                 std::invalid_argument);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,258 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "plugins/config/Config.h"
+#include "plugins/firewall/RuleFactory.h"
+#include "plugins/logger/Logger.h"
+#include "plugins/network/Network.h"
+#include "plugins/optimizer/Optimizer.h"
+#include "plugins/reorderer/Reorderer.h"
+#include "plugins/transaction/Transaction.h"
+
+#include "service/NetworkService.h"
+
+#include "utils/command/executor/Executor.h"
+#include "utils/command/executor/osal/CountingOsal.h"
+#include "utils/file/reader/Reader.h"
+#include "utils/file/temporary/TemporaryFile.h"
+#include "utils/file/writer/Writer.h"
+#include "utils/helper/AllocationCounter.h"
+
+using namespace service;
+using namespace service::plugins::config;
+using namespace service::plugins::firewall;
+using namespace service::plugins::logger;
+using namespace service::plugins::network;
+using namespace service::plugins::optimizer;
+using namespace service::plugins::profiler;
+using namespace service::plugins::reorderer;
+using namespace service::plugins::transaction;
+using namespace utils::command;
+using namespace utils::command::osal;
+using namespace utils::file;
+using namespace utils::helper;
+
+namespace {
+
+/* Spawn nothing, as if each program was executed instantly. Mocks are not used
+ * since they allocate on each call */
+class FakeOsal : public IOsal {
+
+public:
+    ProcessId createProcess() const override { return ProcessId::PARENT; }
+
+    ResourceUsage waitChildProcess() const override { return {}; }
+
+    void executeProgram([[maybe_unused]] const char* pathname,
+                        [[maybe_unused]] char* const argv[],
+                        [[maybe_unused]] char* const envp[]) const override
+    {}
+
+    void reseedPRNG() const override {}
+
+    void sanitizeFiles() const override {}
+
+    void dropPrivileges() const override {}
+};
+
+/* Sum the allocations and the system calls of each phase. Snapshots are taken
+ * as close as possible to the phase so that recording them is not counted */
+class BudgetProfiler : public IProfiler {
+
+public:
+    struct Cost {
+        std::size_t allocations;
+        CountingOsal::Counters syscalls;
+    };
+
+    explicit BudgetProfiler(const CountingOsal& osal) : m_osal(osal) {}
+
+    void startPhase(const std::string& phaseName) const override
+    {
+        Cost& start       = m_starts[phaseName];
+        start.syscalls    = m_osal.counters();
+        start.allocations = AllocationCounter::count();
+    }
+
+    void stopPhase(const std::string& phaseName) const override
+    {
+        const std::size_t allocations         = AllocationCounter::count();
+        const CountingOsal::Counters syscalls = m_osal.counters();
+
+        const Cost& start = m_starts[phaseName];
+        Cost& cost        = m_costs[phaseName];
+        cost.allocations += allocations - start.allocations;
+        cost.syscalls += syscalls - start.syscalls;
+    }
+
+    [[nodiscard]] Cost cost(const std::string& phaseName) const
+    {
+        return m_costs[phaseName];
+    }
+
+private:
+    const CountingOsal& m_osal;
+    mutable std::map<std::string, Cost> m_starts;
+    mutable std::map<std::string, Cost> m_costs;
+};
+
+/* The real plugins wired as in main() to an OS abstraction layer that spawns
+ * nothing, so that only what the service itself costs is measured */
+class NetworkServiceBudgetTest : public ::testing::Test {
+
+protected:
+    static constexpr std::size_t NB_INTERFACE_COMMANDS = 9;
+    static constexpr std::size_t NB_LAYER_COMMANDS     = 8;
+    static constexpr std::size_t NB_RULES              = 16;
+    static constexpr std::size_t COMMANDS_PER_RULE     = 4;
+
+    /* Apply a configuration whose rules only differ by their source address
+     * so that they are eligible to the ipset pass */
+    void apply(Optimizer::Passes passes)
+    {
+        {
+            std::ofstream stream(m_configFile.pathname());
+            writeConfig(stream);
+        }
+
+        const Optimizer optimizer = Optimizer(m_writer, passes);
+        const NetworkService service({m_logger,
+                                      m_config,
+                                      m_network,
+                                      m_ruleFactory,
+                                      m_profiler,
+                                      m_transaction,
+                                      optimizer,
+                                      m_reorderer});
+
+        ASSERT_EQ(service.applyConfig(m_configFile.pathname()), EXIT_SUCCESS);
+    }
+
+    [[nodiscard]] BudgetProfiler::Cost cost(const std::string& phaseName) const
+    {
+        return m_profiler.cost(phaseName);
+    }
+
+private:
+    void writeConfig(std::ostream& stream) const
+    {
+        stream << R"({"network": {"interfaceNames": ["lo"], "interfaceCommands": [)";
+        for (std::size_t index = 0; index < NB_INTERFACE_COMMANDS; ++index) {
+            stream << (index == 0 ? "" : ", ") << "\"/sbin/ip link set dev lo up\"";
+        }
+        stream << R"(], "layerCommands": [)";
+        for (std::size_t index = 0; index < NB_LAYER_COMMANDS; ++index) {
+            stream << (index == 0 ? "" : ", ") << R"({"pathname": ")"
+                   << m_layerFile.pathname() << R"(", "value": "1"})";
+        }
+        stream << R"(]}, "rules": [)";
+        for (std::size_t rule = 0; rule < NB_RULES; ++rule) {
+            stream << (rule == 0 ? "" : ", ") << R"({"name": "rule )" << rule
+                   << R"(", "commands": [)";
+            for (std::size_t command = 0; command < COMMANDS_PER_RULE; ++command) {
+                stream << (command == 0 ? "" : ", ")
+                       << "\"/sbin/iptables -A INPUT -s 10.0." << rule << "."
+                       << command << " -p tcp --dport " << 1 + rule << " -j DROP\"";
+            }
+            stream << "]}";
+        }
+        stream << "]}";
+    }
+
+    const FakeOsal m_fakeOsal;
+    const CountingOsal m_osal        = CountingOsal(m_fakeOsal);
+    const BudgetProfiler m_profiler  = BudgetProfiler(m_osal);
+    const Executor m_executor        = Executor(m_osal);
+    const Logger m_logger            = Logger(ILogger::Level::ERROR);
+    const Reader m_reader            = Reader();
+    const Writer m_writer            = Writer();
+    const Network m_network          = Network(m_executor, m_writer);
+    const RuleFactory m_ruleFactory  = RuleFactory(m_executor);
+    const Config m_config            = Config(m_reader);
+    const Transaction m_transaction  = Transaction(m_executor, m_writer, false);
+    const Reorderer m_reorderer      = Reorderer(m_executor, m_writer, false);
+    const TemporaryFile m_configFile = TemporaryFile();
+    const TemporaryFile m_layerFile  = TemporaryFile();
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceBudgetTest, doNotAllocateWhileApplying)
+{
+    apply(Optimizer::Passes::NONE);
+
+    ASSERT_EQ(cost("checkInterfaces").allocations, 0);
+    ASSERT_EQ(cost("applyLayerCommands").allocations, 0);
+    ASSERT_EQ(cost("applyInterfaceCommands").allocations, 0);
+    ASSERT_EQ(cost("applyRules").allocations, 0);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceBudgetTest, doNotAllocateWhileApplyingOptimizedRules)
+{
+    apply(Optimizer::Passes::IPSET);
+
+    ASSERT_EQ(cost("applyRules").allocations, 0);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceBudgetTest, spawnAndWaitOnceForEachCommand)
+{
+    apply(Optimizer::Passes::NONE);
+
+    /* Layer commands are written to files, not executed */
+    ASSERT_EQ(cost("applyLayerCommands").syscalls.forks, 0);
+    ASSERT_EQ(cost("applyInterfaceCommands").syscalls.forks, NB_INTERFACE_COMMANDS);
+    ASSERT_EQ(cost("applyInterfaceCommands").syscalls.waits, NB_INTERFACE_COMMANDS);
+    ASSERT_EQ(cost("applyRules").syscalls.forks, NB_RULES * COMMANDS_PER_RULE);
+    ASSERT_EQ(cost("applyRules").syscalls.waits, NB_RULES * COMMANDS_PER_RULE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceBudgetTest, spawnTwiceForEachRuleMergedByIpsetPass)
+{
+    apply(Optimizer::Passes::IPSET);
+
+    /* One "ipset restore" and one iptables command matching the set */
+    ASSERT_EQ(cost("applyRules").syscalls.forks, 2 * NB_RULES);
+    ASSERT_EQ(cost("applyRules").syscalls.waits, 2 * NB_RULES);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -26,31 +26,58 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <array>
+#include <unistd.h>
+
 #include "gtest/gtest.h"
 
 #include "mocks/MockConfig.h"
 #include "mocks/MockLogger.h"
 #include "mocks/MockNetwork.h"
+#include "mocks/MockOptimizer.h"
+#include "mocks/MockProfiler.h"
+#include "mocks/MockReorderer.h"
 #include "mocks/MockRule.h"
 #include "mocks/MockRuleFactory.h"
+#include "mocks/MockTransaction.h"
 
 #include "service/NetworkService.h"
+#include "utils/concurrency/FiberScheduler.h"
 
 using ::testing::_;
 using ::testing::AtLeast;
 using ::testing::ByMove;
+using ::testing::IsEmpty;
+using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::Sequence;
+using ::testing::SizeIs;
 using ::testing::Throw;
 
 using namespace service;
 using namespace service::plugins::logger;
 using namespace service::plugins::config;
 using namespace service::plugins::network;
+using namespace service::plugins::optimizer;
 using namespace service::plugins::firewall;
+using namespace service::plugins::profiler;
+using namespace service::plugins::reorderer;
+using namespace service::plugins::transaction;
+using namespace utils::concurrency;
+
+using AddressSets = std::vector<ConfigData::Rule::AddressSet>;
 
 namespace {
 
+/* A rule telling when it is destroyed, so when its commands are released */
+class ReleasedRule : public MockRule {
+
+public:
+    ~ReleasedRule() override { release(); }
+
+    MOCK_METHOD(void, release, ());
+};
+
 class NetworkServiceTestFixture : public ::testing::Test {
 
 private:
@@ -59,7 +86,14 @@ private:
 protected:
     NetworkServiceTestFixture()
         : m_networkServiceParams(
-            {m_mockLogger, m_mockConfig, m_mockNetwork, m_mockRuleFactory}),
+            {m_mockLogger,
+             m_mockConfig,
+             m_mockNetwork,
+             m_mockRuleFactory,
+             m_mockProfiler,
+             m_mockTransaction,
+             m_mockOptimizer,
+             m_mockReorderer}),
           m_networkService(m_networkServiceParams),
           m_configFile("/path/to/configFile")
     {
@@ -68,6 +102,19 @@ protected:
         EXPECT_CALL(m_mockLogger, info).Times(AtLeast(0));
         EXPECT_CALL(m_mockLogger, warn).Times(AtLeast(0));
         EXPECT_CALL(m_mockLogger, error).Times(AtLeast(0));
+        EXPECT_CALL(m_mockLogger, isEnabled).WillRepeatedly(Return(true));
+
+        // Profiling is not what most tests are about
+        EXPECT_CALL(m_mockProfiler, startPhase).Times(AtLeast(0));
+        EXPECT_CALL(m_mockProfiler, stopPhase).Times(AtLeast(0));
+
+        // Neither is the transaction
+        EXPECT_CALL(m_mockTransaction, begin).Times(AtLeast(0));
+        EXPECT_CALL(m_mockTransaction, commit).Times(AtLeast(0));
+        EXPECT_CALL(m_mockTransaction, rollback).Times(AtLeast(0));
+        EXPECT_CALL(m_mockOptimizer, optimize).Times(AtLeast(0));
+        EXPECT_CALL(m_mockReorderer, prepare).Times(AtLeast(0));
+        EXPECT_CALL(m_mockReorderer, reorder).Times(AtLeast(0));
 
         // Prepare returned values
         ConfigData configData
@@ -78,12 +125,21 @@ protected:
 
         ON_CALL(m_mockConfig, load(_))
             .WillByDefault(Return(ByMove(std::make_unique<ConfigData>(configData))));
+
+        // Rules are created before anything is applied
+        ON_CALL(m_mockRuleFactory, createRule).WillByDefault([]() {
+            return std::make_unique<NiceMock<MockRule>>();
+        });
     }
 
     MockLogger m_mockLogger;
     MockConfig m_mockConfig;
     MockNetwork m_mockNetwork;
     MockRuleFactory m_mockRuleFactory;
+    MockProfiler m_mockProfiler;
+    MockTransaction m_mockTransaction;
+    MockOptimizer m_mockOptimizer;
+    MockReorderer m_mockReorderer;
     NetworkService m_networkService;
 
     const std::string m_configFile;
@@ -163,11 +219,13 @@ TEST_F(NetworkServiceTestFixture, returnFailureWhenCreateRuleRaisesAnException)
 TEST_F(NetworkServiceTestFixture, returnFailureWhenCreateRuleReturnNull)
 {
     EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
-    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
-    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands);
-    EXPECT_CALL(m_mockNetwork, applyLayerCommands);
 
-    EXPECT_CALL(m_mockRuleFactory, createRule);
+    // Rules are created before anything is applied
+    EXPECT_CALL(m_mockNetwork, hasInterface).Times(0);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).Times(0);
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(0);
+
+    EXPECT_CALL(m_mockRuleFactory, createRule).WillOnce(Return(ByMove(nullptr)));
 
     ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
 }
@@ -186,7 +244,12 @@ TEST_F(NetworkServiceTestFixture, hasInterfaceShouldBeCalledTwice)
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
 TEST_F(NetworkServiceTestFixture, setupNetworkBeforeFirewall)
 {
+    auto rule          = std::make_unique<MockRule>();
+    MockRule& mockRule  = *rule;
+
     EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce(Return(ByMove(std::move(rule))));
 
     {
         Sequence seq1;
@@ -197,14 +260,7 @@ TEST_F(NetworkServiceTestFixture, setupNetworkBeforeFirewall)
             .WillRepeatedly(Return(true));
         EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).InSequence(seq1);
         EXPECT_CALL(m_mockNetwork, applyLayerCommands).InSequence(seq2);
-        EXPECT_CALL(m_mockRuleFactory, createRule)
-            .InSequence(seq2)
-            .WillOnce([]([[maybe_unused]] const std::string& name,
-                         [[maybe_unused]] const std::vector<std::string>& commands) {
-                auto rule = std::make_unique<MockRule>();
-                EXPECT_CALL(*rule, applyCommands);
-                return rule;
-            });
+        EXPECT_CALL(mockRule, applyCommands).InSequence(seq1, seq2);
     }
 
     ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
@@ -213,30 +269,504 @@ TEST_F(NetworkServiceTestFixture, setupNetworkBeforeFirewall)
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
 TEST_F(NetworkServiceTestFixture, applyLayerBeforeInterfaceCommands)
 {
+    auto rule          = std::make_unique<MockRule>();
+    MockRule& mockRule  = *rule;
+
     EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce(Return(ByMove(std::move(rule))));
 
     {
-        Sequence seq1;
-        Sequence seq2;
+        Sequence seq;
 
         EXPECT_CALL(m_mockNetwork, hasInterface)
-            .InSequence(seq1, seq2)
+            .InSequence(seq)
             .WillRepeatedly(Return(true));
-        EXPECT_CALL(m_mockNetwork, applyLayerCommands).InSequence(seq1);
-        EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).InSequence(seq1);
+        EXPECT_CALL(m_mockNetwork, applyLayerCommands).InSequence(seq);
+        EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).InSequence(seq);
+        EXPECT_CALL(mockRule, applyCommands).InSequence(seq);
+    }
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, profileEachPhaseInOrder)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce([]([[maybe_unused]] const std::string& name,
+                     [[maybe_unused]] const std::vector<std::string>& commands,
+                     [[maybe_unused]] const AddressSets& sets) {
+            auto rule = std::make_unique<MockRule>();
+            EXPECT_CALL(*rule, applyCommands);
+            return rule;
+        });
+
+    {
+        Sequence seq;
+
+        for (const char* phaseName : {"load",
+                                      "optimize",
+                                      "createRules",
+                                      "snapshot",
+                                      "checkInterfaces",
+                                      "applyLayerCommands",
+                                      "applyInterfaceCommands",
+                                      "applyRules",
+                                      "reorder"}) {
+            EXPECT_CALL(m_mockProfiler, startPhase(phaseName)).InSequence(seq);
+            EXPECT_CALL(m_mockProfiler, stopPhase(phaseName)).InSequence(seq);
+        }
+    }
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, stopPhaseEvenWhenItFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    {
+        Sequence seq;
+
+        EXPECT_CALL(m_mockProfiler, startPhase("load")).InSequence(seq);
+        EXPECT_CALL(m_mockProfiler, stopPhase("load")).InSequence(seq);
+    }
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, applyOptimizedRules)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands);
+
+    EXPECT_CALL(m_mockOptimizer, optimize).WillOnce([](ConfigData& configData) {
+        configData.rules = {{"optimized", {"command"}}};
+    });
+    EXPECT_CALL(m_mockRuleFactory, createRule("optimized", _, _))
+        .WillOnce([]([[maybe_unused]] const std::string& name,
+                     [[maybe_unused]] const std::vector<std::string>& commands,
+                     [[maybe_unused]] const AddressSets& sets) {
+            auto rule = std::make_unique<MockRule>();
+            EXPECT_CALL(*rule, applyCommands);
+            return rule;
+        });
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, takeSnapshotBeforeApplyingAndCommitAfter)
+{
+    auto rule          = std::make_unique<MockRule>();
+    MockRule& mockRule  = *rule;
+
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+
+    {
+        Sequence seq;
+
         EXPECT_CALL(m_mockRuleFactory, createRule)
-            .InSequence(seq2)
-            .WillOnce([]([[maybe_unused]] const std::string& name,
-                         [[maybe_unused]] const std::vector<std::string>& commands) {
-                auto rule = std::make_unique<MockRule>();
-                EXPECT_CALL(*rule, applyCommands);
-                return rule;
-            });
+            .InSequence(seq)
+            .WillOnce(Return(ByMove(std::move(rule))));
+        EXPECT_CALL(m_mockReorderer, prepare).InSequence(seq);
+        EXPECT_CALL(m_mockTransaction, begin).InSequence(seq);
+        EXPECT_CALL(m_mockNetwork, hasInterface)
+            .InSequence(seq)
+            .WillRepeatedly(Return(true));
+        EXPECT_CALL(m_mockNetwork, applyLayerCommands).InSequence(seq);
+        EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).InSequence(seq);
+        EXPECT_CALL(mockRule, applyCommands).InSequence(seq);
+        EXPECT_CALL(m_mockReorderer, reorder).InSequence(seq);
+        EXPECT_CALL(m_mockTransaction, commit).InSequence(seq);
     }
+    EXPECT_CALL(m_mockTransaction, rollback).Times(0);
 
     ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, releaseCommandsOnceRulesAreCreated)
+{
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockRuleFactory, createRule("ruleName", _, _));
+
+    const ConfigData* applied = nullptr;
+    EXPECT_CALL(m_mockReorderer, prepare).WillOnce([](const ConfigData& configData) {
+        ASSERT_THAT(configData.rules.front().commands, SizeIs(2));
+    });
+    EXPECT_CALL(m_mockTransaction, begin)
+        .WillOnce([&applied](const ConfigData& configData) {
+            ASSERT_THAT(configData.rules.front().commands, SizeIs(2));
+            applied = &configData;
+        });
+    EXPECT_CALL(m_mockReorderer, reorder).WillOnce([&applied]() {
+        ASSERT_THAT(applied->rules, SizeIs(1));
+        ASSERT_THAT(applied->rules.front().commands, IsEmpty());
+    });
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, rollbackWhenApplyingFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    EXPECT_CALL(m_mockTransaction, begin);
+    EXPECT_CALL(m_mockTransaction, rollback);
+    EXPECT_CALL(m_mockTransaction, commit).Times(0);
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, rollbackWhenReorderingFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce([]([[maybe_unused]] const std::string& name,
+                     [[maybe_unused]] const std::vector<std::string>& commands,
+                     [[maybe_unused]] const AddressSets& sets) {
+            auto rule = std::make_unique<MockRule>();
+            EXPECT_CALL(*rule, applyCommands);
+            return rule;
+        });
+
+    EXPECT_CALL(m_mockReorderer, reorder)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockTransaction, rollback);
+    EXPECT_CALL(m_mockTransaction, commit).Times(0);
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, returnFailureWhenRollbackFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillOnce(Return(false));
+
+    EXPECT_CALL(m_mockTransaction, rollback)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, doNotApplyAnythingWhenSnapshotFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockTransaction, begin)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    EXPECT_CALL(m_mockNetwork, hasInterface).Times(0);
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(0);
+    EXPECT_CALL(m_mockTransaction, rollback).Times(0);
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, createRulesOnceAndApplyThemInEachNamespace)
+{
+    const std::vector<std::string> namespaces = {"/var/run/netns/ns1",
+                                                 "/var/run/netns/ns2",
+                                                 "/proc/42/ns/net"};
+    const int nbNamespaces = static_cast<int>(namespaces.size());
+
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    for (const std::string& ns : namespaces) {
+        EXPECT_CALL(m_mockNetwork, joinNamespace(ns)).Times(1);
+    }
+    EXPECT_CALL(m_mockReorderer, reorder).Times(0);
+    EXPECT_CALL(m_mockNetwork, hasInterface)
+        .Times(2 * nbNamespaces)
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(nbNamespaces);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).Times(nbNamespaces);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce([nbNamespaces](
+                      [[maybe_unused]] const std::string& name,
+                      [[maybe_unused]] const std::vector<std::string>& commands,
+                      [[maybe_unused]] const AddressSets& sets) {
+            auto rule = std::make_unique<MockRule>();
+            EXPECT_CALL(*rule, applyCommands).Times(nbNamespaces);
+            return rule;
+        });
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile, namespaces, 2),
+              EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, configureOtherNamespacesWhenOneFails)
+{
+    const std::vector<std::string> namespaces = {"/var/run/netns/ns1",
+                                                 "/var/run/netns/invalid",
+                                                 "/var/run/netns/ns2"};
+
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockNetwork, joinNamespace(_)).Times(AtLeast(0));
+    EXPECT_CALL(m_mockNetwork, joinNamespace("/var/run/netns/invalid"))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(2);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).Times(2);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce([]([[maybe_unused]] const std::string& name,
+                     [[maybe_unused]] const std::vector<std::string>& commands,
+                     [[maybe_unused]] const AddressSets& sets) {
+            auto rule = std::make_unique<MockRule>();
+            EXPECT_CALL(*rule, applyCommands).Times(2);
+            return rule;
+        });
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile, namespaces, 0),
+              EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, configureNamespacesOfAJobConcurrently)
+{
+    const std::vector<std::string> namespaces = {"/var/run/netns/ns1",
+                                                 "/var/run/netns/ns2"};
+    std::vector<std::string> joinedNamespaces;
+    std::array<int, 2> fds {};
+    ASSERT_EQ(pipe(fds.data()), 0);
+
+    EXPECT_CALL(m_mockNetwork, joinNamespace)
+        .WillRepeatedly([&joinedNamespaces](const std::string& namespacePath) {
+            joinedNamespaces.push_back(namespacePath);
+        });
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(2);
+
+    // The first namespace waits until the second one has been configured
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands)
+        .WillOnce([&fds]([[maybe_unused]] const std::vector<std::string>& commands) {
+            FiberScheduler::awaitReadable(fds[0]);
+        })
+        .WillOnce([&fds]([[maybe_unused]] const std::vector<std::string>& commands) {
+            ASSERT_EQ(write(fds[1], "x", 1), 1);
+        });
+
+    ASSERT_EQ(m_networkService.applyConfigAsync(m_configFile, namespaces, 1),
+              EXIT_SUCCESS);
+
+    // The first namespace is joined again when it is resumed
+    const std::vector<std::string> expectedNamespaces
+        = {namespaces[0], namespaces[1], namespaces[0]};
+    ASSERT_EQ(joinedNamespaces, expectedNamespaces);
+
+    (void)close(fds[0]);
+    (void)close(fds[1]);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, configureOtherNamespacesOfAJobWhenOneFails)
+{
+    const std::vector<std::string> namespaces = {"/var/run/netns/invalid",
+                                                 "/var/run/netns/ns1"};
+
+    EXPECT_CALL(m_mockNetwork, joinNamespace("/var/run/netns/ns1"));
+    EXPECT_CALL(m_mockNetwork, joinNamespace("/var/run/netns/invalid"))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyLayerCommands).Times(1);
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).Times(1);
+
+    ASSERT_EQ(m_networkService.applyConfigAsync(m_configFile, namespaces, 1),
+              EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, doNotJoinAnyNamespaceWhenCreateRuleFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile)).Times(1);
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockNetwork, joinNamespace).Times(0);
+
+    ASSERT_EQ(m_networkService.applyConfig(m_configFile, {"/var/run/netns/ns1"}),
+              EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, applyNetworkThenEachRuleWhileStreaming)
+{
+    auto rule1          = std::make_unique<MockRule>();
+    auto rule2          = std::make_unique<MockRule>();
+    MockRule& mockRule1 = *rule1;
+    MockRule& mockRule2 = *rule2;
+
+    EXPECT_CALL(m_mockConfig, load).Times(0);
+    EXPECT_CALL(m_mockOptimizer, optimize).Times(0);
+    EXPECT_CALL(m_mockTransaction, begin).Times(0);
+    EXPECT_CALL(m_mockReorderer, reorder).Times(0);
+    EXPECT_CALL(m_mockConfig, stream(m_configFile, _, _))
+        .WillOnce([](const std::string& /*configFile*/,
+                     const IConfig::NetworkHandler& onNetwork,
+                     const IConfig::RuleHandler& onRule) {
+            onNetwork({{"interfaceName1"}, {"interfaceCommand1"}, {}});
+            onRule({"rule1", {"command1"}});
+            onRule({"rule2", {"command2"}});
+        });
+
+    {
+        Sequence seq;
+
+        EXPECT_CALL(m_mockNetwork, hasInterface("interfaceName1"))
+            .InSequence(seq)
+            .WillOnce(Return(true));
+        EXPECT_CALL(m_mockNetwork, applyLayerCommands).InSequence(seq);
+        EXPECT_CALL(m_mockNetwork, applyInterfaceCommands).InSequence(seq);
+        EXPECT_CALL(m_mockRuleFactory, createRule("rule1", _, _))
+            .InSequence(seq)
+            .WillOnce(Return(ByMove(std::move(rule1))));
+        EXPECT_CALL(mockRule1, applyCommands).InSequence(seq);
+        EXPECT_CALL(m_mockRuleFactory, createRule("rule2", _, _))
+            .InSequence(seq)
+            .WillOnce(Return(ByMove(std::move(rule2))));
+        EXPECT_CALL(mockRule2, applyCommands).InSequence(seq);
+    }
+
+    ASSERT_EQ(m_networkService.applyConfigPipelined(m_configFile, 1), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, releaseEachStreamedRuleBeforeCreatingTheNextOne)
+{
+    auto rule1              = std::make_unique<ReleasedRule>();
+    auto rule2              = std::make_unique<ReleasedRule>();
+    ReleasedRule& mockRule1 = *rule1;
+    ReleasedRule& mockRule2 = *rule2;
+
+    EXPECT_CALL(m_mockConfig, stream(m_configFile, _, _))
+        .WillOnce([](const std::string& /*configFile*/,
+                     const IConfig::NetworkHandler& onNetwork,
+                     const IConfig::RuleHandler& onRule) {
+            onNetwork({});
+            onRule({"rule1", {"command1"}});
+            onRule({"rule2", {"command2"}});
+        });
+
+    {
+        Sequence seq;
+
+        EXPECT_CALL(m_mockRuleFactory, createRule("rule1", _, _))
+            .InSequence(seq)
+            .WillOnce(Return(ByMove(std::move(rule1))));
+        EXPECT_CALL(mockRule1, applyCommands).InSequence(seq);
+        EXPECT_CALL(mockRule1, release).InSequence(seq);
+        EXPECT_CALL(m_mockRuleFactory, createRule("rule2", _, _))
+            .InSequence(seq)
+            .WillOnce(Return(ByMove(std::move(rule2))));
+        EXPECT_CALL(mockRule2, applyCommands).InSequence(seq);
+        EXPECT_CALL(mockRule2, release).InSequence(seq);
+    }
+
+    ASSERT_EQ(m_networkService.applyConfigPipelined(m_configFile, 1), EXIT_SUCCESS);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, returnFailureWhenStreamRaisesAnException)
+{
+    EXPECT_CALL(m_mockConfig, stream(m_configFile, _, _))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockNetwork, hasInterface).Times(0);
+
+    ASSERT_EQ(m_networkService.applyConfigPipelined(m_configFile, 1), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, stopStreamingWhenApplyingARuleFails)
+{
+    auto rule          = std::make_unique<MockRule>();
+    MockRule& mockRule = *rule;
+
+    EXPECT_CALL(m_mockConfig, stream(m_configFile, _, _))
+        .WillOnce([](const std::string& /*configFile*/,
+                     const IConfig::NetworkHandler& onNetwork,
+                     const IConfig::RuleHandler& onRule) {
+            onNetwork({});
+
+            // Would never end if the failure did not stop the loader
+            for (;;) {
+                onRule({"rule", {"command"}});
+            }
+        });
+    EXPECT_CALL(m_mockRuleFactory, createRule)
+        .WillOnce(Return(ByMove(std::move(rule))));
+    EXPECT_CALL(mockRule, applyCommands)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    ASSERT_EQ(m_networkService.applyConfigPipelined(m_configFile, 1), EXIT_FAILURE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, applyConfigDataWithoutLoadingAnything)
+{
+    EXPECT_CALL(m_mockConfig, load).Times(0);
+    EXPECT_CALL(m_mockNetwork, hasInterface("eth0")).WillOnce(Return(true));
+    EXPECT_CALL(m_mockRuleFactory, createRule).Times(2);
+
+    const NetworkService::Result result = m_networkService.apply(
+        ConfigData{{{"eth0"}, {}, {}}, {{"rule1", {"a"}}, {"rule2", {"b"}}}});
+
+    ASSERT_TRUE(result.succeeded);
+    ASSERT_TRUE(result.error.empty());
+    ASSERT_FALSE(result.rolledBack);
+    ASSERT_EQ(result.nbRules, 2u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, reportTheErrorAndTheRollback)
+{
+    EXPECT_CALL(m_mockNetwork, hasInterface).WillRepeatedly(Return(true));
+    EXPECT_CALL(m_mockNetwork, applyInterfaceCommands)
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockTransaction, rollback);
+
+    const NetworkService::Result result = m_networkService.apply(m_configFile);
+
+    ASSERT_FALSE(result.succeeded);
+    ASSERT_EQ(result.error, "Exception");
+    ASSERT_TRUE(result.rolledBack);
+    ASSERT_EQ(result.nbRules, 0u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(NetworkServiceTestFixture, doNotRollbackWhenLoadFails)
+{
+    EXPECT_CALL(m_mockConfig, load(m_configFile))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+    EXPECT_CALL(m_mockTransaction, rollback).Times(0);
+
+    const NetworkService::Result result = m_networkService.apply(m_configFile);
+
+    ASSERT_FALSE(result.succeeded);
+    ASSERT_EQ(result.error, "Exception");
+    ASSERT_FALSE(result.rolledBack);
+}
+
 }
 
 int main(int argc, char** argv)
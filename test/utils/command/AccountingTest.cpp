@@ -0,0 +1,134 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/command/accounting/Accounting.h"
+
+using ::testing::HasSubstr;
+
+using namespace utils::command;
+using namespace utils::command::osal;
+
+namespace {
+
+class AccountingTestFixture : public ::testing::Test {
+
+protected:
+    Accounting m_accounting;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AccountingTestFixture, nothingRecordedShouldGiveEmptyReport)
+{
+    EXPECT_TRUE(m_accounting.totalsPerLabel().empty());
+    EXPECT_TRUE(m_accounting.totalsPerBinary().empty());
+    EXPECT_TRUE(m_accounting.toString().empty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AccountingTestFixture, usageShouldBeAggregatedPerLabelAndPerBinary)
+{
+    m_accounting.record("rule1", "/sbin/iptables", {1, 2, 100, 4, 5, 6, 7});
+    m_accounting.record("rule1", "/sbin/ip", {10, 20, 50, 40, 50, 60, 70});
+    m_accounting.record("rule2", "/sbin/iptables", {100, 200, 300, 1, 1, 1, 1});
+
+    const auto& perLabel  = m_accounting.totalsPerLabel();
+    const auto& perBinary = m_accounting.totalsPerBinary();
+
+    ASSERT_EQ(perLabel.size(), 2u);
+    ASSERT_EQ(perBinary.size(), 2u);
+
+    const Accounting::Total& rule1 = perLabel.at("rule1");
+    EXPECT_EQ(rule1.nbPrograms, 2u);
+    EXPECT_EQ(rule1.usage.userTimeUs, 11);
+    EXPECT_EQ(rule1.usage.systemTimeUs, 22);
+    EXPECT_EQ(rule1.usage.maxResidentSetKb, 100); // Max, not sum
+    EXPECT_EQ(rule1.usage.minorPageFaults, 44);
+    EXPECT_EQ(rule1.usage.majorPageFaults, 55);
+    EXPECT_EQ(rule1.usage.voluntaryContextSwitches, 66);
+    EXPECT_EQ(rule1.usage.involuntaryContextSwitches, 77);
+
+    const Accounting::Total& iptables = perBinary.at("/sbin/iptables");
+    EXPECT_EQ(iptables.nbPrograms, 2u);
+    EXPECT_EQ(iptables.usage.userTimeUs, 101);
+    EXPECT_EQ(iptables.usage.maxResidentSetKb, 300);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AccountingTestFixture, programsWithoutLabelShouldBeGroupedTogether)
+{
+    m_accounting.record(nullptr, "/sbin/ip", {1, 1, 1, 1, 1, 1, 1});
+    m_accounting.record(nullptr, "/sbin/ip", {1, 1, 1, 1, 1, 1, 1});
+
+    const auto& perLabel = m_accounting.totalsPerLabel();
+    ASSERT_EQ(perLabel.size(), 1u);
+    EXPECT_EQ(perLabel.at("(none)").nbPrograms, 2u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AccountingTestFixture, reportShouldListMostExpensiveGroupFirst)
+{
+    m_accounting.record("cheap", "/bin/true", {1, 1, 1, 1, 1, 1, 1});
+    m_accounting.record("expensive", "/sbin/iptables", {500, 500, 1, 1, 1, 1, 1});
+
+    const std::string report = m_accounting.toString();
+    EXPECT_THAT(report, HasSubstr("Resource usage per rule"));
+    EXPECT_THAT(report, HasSubstr("Resource usage per binary"));
+    EXPECT_LT(report.find("expensive"), report.find("cheap"));
+    EXPECT_LT(report.find("/sbin/iptables"), report.find("/bin/true"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(AccountingTestFixture, perfCountersShouldBeReportedOnlyWhenAlwaysAvailable)
+{
+    constexpr std::int64_t NA = utils::helper::PerfCounters::NOT_AVAILABLE;
+
+    m_accounting.record("rule1", "/sbin/iptables", {}, {1, 2, 3, 4, 5});
+    m_accounting.record("rule1", "/sbin/iptables", {}, {10, 20, 30, 40, 50});
+    m_accounting.record("rule2", "/sbin/ip", {}, {1, NA, 3, 4, 5});
+    m_accounting.record("rule3", "/sbin/ip", {});
+
+    const auto& perLabel = m_accounting.totalsPerLabel();
+    EXPECT_EQ(perLabel.at("rule1").counters.cycles, 11);
+    EXPECT_EQ(perLabel.at("rule1").counters.cpuMigrations, 55);
+    EXPECT_EQ(perLabel.at("rule2").counters.instructions, NA);
+    EXPECT_FALSE(perLabel.at("rule3").counters.isAvailable());
+    EXPECT_FALSE(m_accounting.totalsPerBinary().at("/sbin/ip").counters.isAvailable());
+
+    EXPECT_THAT(m_accounting.toString(), HasSubstr("instructions 22"));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/command/parser/Parser.h"
+#include "utils/command/table/CommandTable.h"
+
+using namespace utils::command;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CommandTableTest, splitCommandsLikeTheParser)
+{
+    CommandTable table;
+
+    for (const std::string command :
+         {"/sbin/iptables -P OUTPUT ACCEPT", "/sbin/ip  link ", "", "/bin/true"}) {
+        const CommandTable::Id id = table.add(command);
+        const auto& parsedCommand = Parser::parse(command);
+
+        ASSERT_EQ(table.argc(id), parsedCommand->argc);
+        ASSERT_STREQ(table.pathname(id), parsedCommand->pathname);
+        for (int index = 0; index <= parsedCommand->argc; ++index) {
+            ASSERT_STREQ(table.argv(id)[index], parsedCommand->argv[index]);
+        }
+    }
+
+    ASSERT_EQ(table.size(), 4);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CommandTableTest, storeEachTokenOnlyOnce)
+{
+    CommandTable table;
+
+    const CommandTable::Id first  = table.add("/sbin/iptables -A INPUT -j DROP");
+    const CommandTable::Id second = table.add("/sbin/iptables -A OUTPUT -j DROP");
+
+    ASSERT_EQ(table.nbTokens(), 6);
+    ASSERT_EQ(table.argv(first)[0], table.argv(second)[0]);
+    ASSERT_EQ(table.argv(first)[4], table.argv(second)[4]);
+    ASSERT_NE(table.argv(first)[2], table.argv(second)[2]);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CommandTableTest, buildCommandsBackAsTheyWereAdded)
+{
+    CommandTable table;
+
+    ASSERT_EQ(table.command(table.add("/sbin/ip link set dev lo up")),
+              "/sbin/ip link set dev lo up");
+    ASSERT_EQ(table.command(table.add("/sbin/ip  link")), "/sbin/ip  link");
+    ASSERT_EQ(table.command(table.add("")), "");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CommandTableTest, compareAndHashCommandsByTheirTokens)
+{
+    CommandTable table;
+
+    const CommandTable::Id first  = table.add("/sbin/iptables -A INPUT -j DROP");
+    const CommandTable::Id second = table.add("/sbin/iptables -A INPUT -j ACCEPT");
+    const CommandTable::Id third  = table.add("/sbin/iptables -A INPUT -j DROP");
+    const CommandTable::Id prefix = table.add("/sbin/iptables -A INPUT");
+
+    ASSERT_TRUE(table.equal(first, third));
+    ASSERT_EQ(table.hash(first), table.hash(third));
+    ASSERT_FALSE(table.equal(first, second));
+    ASSERT_FALSE(table.equal(first, prefix));
+    ASSERT_FALSE(table.equal(prefix, first));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CommandTableTest, keepTokensInPlaceWhenTheTableGrows)
+{
+    CommandTable table;
+
+    const CommandTable::Id first = table.add("/sbin/iptables -A INPUT -j DROP");
+    const char* const program    = table.pathname(first);
+
+    const std::string longToken(100 * 1024, 'x');
+    for (int index = 0; index < 1000; ++index) {
+        (void)table.add("/sbin/iptables -s 10.0.0." + std::to_string(index));
+    }
+    (void)table.add(longToken);
+
+    ASSERT_EQ(table.pathname(first), program);
+    ASSERT_STREQ(table.pathname(table.size() - 1), longToken.c_str());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -35,6 +35,7 @@
 using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::Sequence;
+using ::testing::Throw;
 
 using namespace utils::command;
 using namespace utils::command::osal;
@@ -309,6 +310,96 @@ TEST_F(ExecutorTestFixture, defaultIsWaitCommandFlagSet)
     executor.executeProgram(params);
 }
 
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ExecutorTestFixture, resourceUsageShouldBeRecordedWhenCommandIsWaited)
+{
+    Accounting accounting;
+    const Executor::ProgramParams params
+        = {"/sbin/iptables", nullptr, nullptr, "rule"};
+
+    /* Instantiate an executor */
+    Executor executor(
+        m_mockOsal, Executor::Flags::WAIT_COMMAND, {&accounting, nullptr});
+
+    /* In parent process
+     * - createProcess() must return ProcessId::PARENT
+     * - waitChildProcess() must be called and its result recorded */
+    {
+        InSequence seq;
+
+        EXPECT_CALL(m_mockOsal, createProcess)
+            .WillOnce(Return(IOsal::ProcessId::PARENT));
+        EXPECT_CALL(m_mockOsal, waitChildProcess)
+            .WillOnce(Return(IOsal::ResourceUsage {10, 20, 30, 40, 50, 60, 70}));
+    }
+
+    executor.executeProgram(params);
+
+    const auto& perLabel  = accounting.totalsPerLabel();
+    const auto& perBinary = accounting.totalsPerBinary();
+
+    ASSERT_EQ(perLabel.count("rule"), 1u);
+    ASSERT_EQ(perBinary.count("/sbin/iptables"), 1u);
+    EXPECT_EQ(perLabel.at("rule").nbPrograms, 1u);
+    EXPECT_EQ(perLabel.at("rule").usage.userTimeUs, 10);
+    EXPECT_EQ(perBinary.at("/sbin/iptables").usage.systemTimeUs, 20);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ExecutorTestFixture, resourceUsageShouldNotBeRecordedWhenCommandIsNotWaited)
+{
+    Accounting accounting;
+    const Executor::ProgramParams params = {"/sbin/iptables", nullptr, nullptr};
+
+    /* Instantiate an executor */
+    Executor executor(
+        m_mockOsal, Executor::Flags::RESEED_PRNG, {&accounting, nullptr});
+
+    EXPECT_CALL(m_mockOsal, createProcess)
+        .WillOnce(Return(IOsal::ProcessId::PARENT));
+    EXPECT_CALL(m_mockOsal, reseedPRNG).Times(1);
+
+    executor.executeProgram(params);
+
+    EXPECT_TRUE(accounting.totalsPerLabel().empty());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(ExecutorTestFixture, flightRecorderShouldTrackEachCommand)
+{
+    FlightRecorder flightRecorder;
+    const Executor::ProgramParams params = {"/sbin/iptables", nullptr, nullptr};
+
+    /* Instantiate an executor */
+    Executor executor(
+        m_mockOsal, Executor::Flags::WAIT_COMMAND, {nullptr, &flightRecorder});
+
+    /* The first command succeeds, the second one fails */
+    EXPECT_CALL(m_mockOsal, createProcess)
+        .Times(2)
+        .WillRepeatedly(Return(IOsal::ProcessId::PARENT));
+    EXPECT_CALL(m_mockOsal, waitChildProcess)
+        .WillOnce(Return(IOsal::ResourceUsage {}))
+        .WillOnce(Throw(std::runtime_error("Exception")));
+
+    executor.executeProgram(params);
+    EXPECT_THROW(executor.executeProgram(params), std::runtime_error);
+
+    const std::vector<FlightRecorder::Event> events = flightRecorder.events();
+    ASSERT_EQ(events.size(), 4u);
+
+    EXPECT_EQ(events[0].type, FlightRecorder::COMMAND_STARTED);
+    EXPECT_EQ(events[0].commandIndex, 1u);
+    EXPECT_EQ(events[1].type, FlightRecorder::COMMAND_SUCCEEDED);
+    EXPECT_EQ(events[1].commandIndex, 1u);
+    EXPECT_EQ(events[2].type, FlightRecorder::COMMAND_STARTED);
+    EXPECT_EQ(events[2].commandIndex, 2u);
+    EXPECT_EQ(events[3].type, FlightRecorder::COMMAND_FAILED);
+    EXPECT_EQ(events[3].commandIndex, 2u);
+    EXPECT_LE(events[0].timestampNs, events[3].timestampNs);
+}
+
 }
 
 int main(int argc, char** argv)
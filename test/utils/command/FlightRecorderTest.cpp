@@ -0,0 +1,218 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/command/recorder/FlightRecorder.h"
+
+using namespace utils::command;
+
+namespace {
+
+class FlightRecorderTestFixture : public ::testing::Test {
+
+protected:
+    FlightRecorderTestFixture()
+    {
+        std::array<char, 32> pathname = {"/tmp/FlightRecorderTestXXXXXX"};
+        int fd = mkstemp(pathname.data());
+        EXPECT_NE(fd, -1);
+        close(fd);
+
+        m_pathname = pathname.data();
+    }
+
+    ~FlightRecorderTestFixture() override { std::remove(m_pathname.c_str()); }
+
+    FlightRecorderTestFixture(const FlightRecorderTestFixture&) = delete;
+    FlightRecorderTestFixture& operator=(const FlightRecorderTestFixture&) = delete;
+    FlightRecorderTestFixture(FlightRecorderTestFixture&&)                 = delete;
+    FlightRecorderTestFixture& operator=(FlightRecorderTestFixture&&) = delete;
+
+    FlightRecorder m_flightRecorder;
+    std::string m_pathname;
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, eventsShouldCarryTheCommandIndexOfTheThread)
+{
+    EXPECT_EQ(m_flightRecorder.startCommand(), 1u);
+    m_flightRecorder.record(FlightRecorder::PROCESS_CREATED, 1234);
+    m_flightRecorder.record(FlightRecorder::PROCESS_EXITED, 1234, 256, 0);
+    EXPECT_EQ(m_flightRecorder.startCommand(), 2u);
+    m_flightRecorder.record(FlightRecorder::PROCESS_CREATED, -1, 0, EAGAIN);
+
+    const std::vector<FlightRecorder::Event> events = m_flightRecorder.events();
+    ASSERT_EQ(events.size(), 5u);
+
+    EXPECT_EQ(events[1].type, FlightRecorder::PROCESS_CREATED);
+    EXPECT_EQ(events[1].commandIndex, 1u);
+    EXPECT_EQ(events[1].pid, 1234);
+    EXPECT_EQ(events[2].status, 256);
+    EXPECT_EQ(events[4].commandIndex, 2u);
+    EXPECT_EQ(events[4].errnum, EAGAIN);
+    EXPECT_EQ(events[4].threadId, events[0].threadId);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, eventsShouldCarryTheIdOfTheirThread)
+{
+    std::int32_t otherThreadId = 0;
+    std::thread thread([this, &otherThreadId]() {
+        m_flightRecorder.record(FlightRecorder::PROCESS_CREATED);
+        otherThreadId = static_cast<std::int32_t>(syscall(SYS_gettid));
+    });
+    thread.join();
+    m_flightRecorder.record(FlightRecorder::PROCESS_CREATED);
+
+    const std::vector<FlightRecorder::Event> events = m_flightRecorder.events();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].threadId, otherThreadId);
+    EXPECT_EQ(events[1].threadId, static_cast<std::int32_t>(syscall(SYS_gettid)));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, eventsBeingWrittenShouldNotBeReadTorn)
+{
+    std::atomic<bool> isStopped(false);
+    std::thread writer([this, &isStopped]() {
+        for (int value = 0; !isStopped.load(); ++value) {
+            m_flightRecorder.record(
+                FlightRecorder::PROCESS_EXITED, value, value, value);
+        }
+    });
+
+    // Joined before asserting anything
+    using Events             = std::vector<FlightRecorder::Event>;
+    std::size_t nbTornEvents = 0;
+    auto countTornEvents     = [&nbTornEvents](const Events& events) {
+        for (const FlightRecorder::Event& event : events) {
+            if ((event.status != event.pid) || (event.errnum != event.pid)) {
+                ++nbTornEvents;
+            }
+        }
+    };
+
+    bool isDumped = true;
+    for (int round = 0; round < 100; ++round) {
+        countTornEvents(m_flightRecorder.events());
+        isDumped = isDumped && m_flightRecorder.dump(m_pathname.c_str());
+        countTornEvents(FlightRecorder::read(m_pathname));
+    }
+
+    isStopped = true;
+    writer.join();
+
+    ASSERT_TRUE(isDumped);
+    ASSERT_EQ(nbTornEvents, 0u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, onlyTheMostRecentEventsShouldBeKept)
+{
+    const std::size_t nbEvents = FlightRecorder::NB_EVENTS + 10;
+    for (std::size_t index = 0; index < nbEvents; ++index) {
+        m_flightRecorder.record(
+            FlightRecorder::PROCESS_CREATED, static_cast<int>(index));
+    }
+
+    const std::vector<FlightRecorder::Event> events = m_flightRecorder.events();
+    ASSERT_EQ(events.size(), FlightRecorder::NB_EVENTS);
+    EXPECT_EQ(events.front().pid, 10);
+    EXPECT_EQ(events.back().pid, static_cast<int>(nbEvents - 1));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, dumpedEventsShouldBeReadBackOldestFirst)
+{
+    const std::size_t nbEvents = FlightRecorder::NB_EVENTS + 10;
+    for (std::size_t index = 0; index < nbEvents; ++index) {
+        m_flightRecorder.record(
+            FlightRecorder::PROCESS_EXITED, static_cast<int>(index), 0, 0);
+    }
+
+    ASSERT_TRUE(m_flightRecorder.dump(m_pathname.c_str()));
+
+    const std::vector<FlightRecorder::Event> events
+        = FlightRecorder::read(m_pathname);
+    const std::vector<FlightRecorder::Event> expected = m_flightRecorder.events();
+
+    ASSERT_EQ(events.size(), expected.size());
+    for (std::size_t index = 0; index < events.size(); ++index) {
+        EXPECT_EQ(events[index].pid, expected[index].pid);
+        EXPECT_EQ(events[index].timestampNs, expected[index].timestampNs);
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, readShouldRejectInvalidFiles)
+{
+    FILE* file = std::fopen(m_pathname.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a flight record", file);
+    std::fclose(file);
+
+    EXPECT_THROW((void)FlightRecorder::read(m_pathname), std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(FlightRecorderTestFixture, fatalSignalShouldDumpEvents)
+{
+    EXPECT_EXIT(
+        {
+            m_flightRecorder.record(FlightRecorder::PROCESS_CREATED, 4321);
+            m_flightRecorder.dumpOnFatalSignals(m_pathname);
+            std::abort();
+        },
+        ::testing::KilledBySignal(SIGABRT),
+        "");
+
+    const std::vector<FlightRecorder::Event> events
+        = FlightRecorder::read(m_pathname);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].pid, 4321);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
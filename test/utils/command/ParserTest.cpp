@@ -26,6 +26,11 @@
 //                                                                                //
 //\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
 
+#include <array>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "utils/command/parser/Parser.h"
@@ -57,6 +62,52 @@ TEST(ParserTest, returnSplittedStringIfValidDelimiter)
     ASSERT_STREQ(result->argv[1], "-P");
     ASSERT_STREQ(result->argv[2], "OUTPUT");
     ASSERT_STREQ(result->argv[3], "ACCEPT");
+    ASSERT_EQ(result->argv[4], nullptr);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ParserTest, keepEmptySubstringsExceptAfterATrailingDelimiter)
+{
+    auto result = Parser::parse("/sbin/ip  link ");
+
+    ASSERT_STREQ(result->pathname, "/sbin/ip");
+    ASSERT_EQ(result->argc, 3);
+    ASSERT_STREQ(result->argv[0], "/sbin/ip");
+    ASSERT_STREQ(result->argv[1], "");
+    ASSERT_STREQ(result->argv[2], "link");
+    ASSERT_EQ(result->argv[3], nullptr);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ParserTest, returnNoArgumentIfEmptyString)
+{
+    auto result = Parser::parse("");
+
+    ASSERT_STREQ(result->pathname, "");
+    ASSERT_EQ(result->argc, 0);
+    ASSERT_EQ(result->argv[0], nullptr);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ParserTest, fitCommandsIntoTheirFootprint)
+{
+    const std::array<std::string, 4> commands
+        = {"/sbin/ip link set dev lo up", "", "/bin/true ", "/sbin/iptables -F"};
+
+    std::size_t footprint = 0;
+    for (const std::string& command : commands) {
+        footprint += Parser::footprint(command);
+    }
+
+    // A resource that can't grow: parsing more than the footprint throws
+    std::vector<std::max_align_t> buffer(footprint / sizeof(std::max_align_t) + 1);
+    std::pmr::monotonic_buffer_resource resource(
+        buffer.data(), footprint, std::pmr::null_memory_resource());
+
+    for (const std::string& command : commands) {
+        ASSERT_NO_THROW((void)Parser::parse(command, ' ', &resource));
+    }
+    ASSERT_THROW((void)Parser::parse("/bin/true", ' ', &resource), std::bad_alloc);
 }
 
 }
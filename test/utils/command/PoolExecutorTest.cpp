@@ -0,0 +1,203 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <sched.h>
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/command/executor/PoolExecutor.h"
+#include "utils/concurrency/FiberScheduler.h"
+
+#include "mocks/MockExecutor.h"
+
+using namespace utils::command;
+using namespace utils::concurrency;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Throw;
+
+namespace {
+
+PoolExecutor::Options withWorkers(std::size_t nbWorkers,
+                                  std::vector<unsigned int> cpus = {})
+{
+    PoolExecutor::Options options;
+    options.nbWorkers = nbWorkers;
+    options.cpus      = std::move(cpus);
+    return options;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, executeProgramsOnAWorkerThread)
+{
+    MockExecutor mockExecutor;
+    const PoolExecutor poolExecutor(mockExecutor, withWorkers(2));
+    const std::thread::id callerId = std::this_thread::get_id();
+    std::thread::id workerId       = callerId;
+
+    EXPECT_CALL(mockExecutor, executeProgram(_))
+        .WillOnce(Invoke([&workerId](const IExecutor::ProgramParams&) {
+            workerId = std::this_thread::get_id();
+        }));
+
+    ASSERT_EQ(poolExecutor.nbWorkers(), 2u);
+    poolExecutor.executeProgram({"/bin/true", nullptr, nullptr});
+
+    ASSERT_NE(workerId, callerId);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, executeProgramsOfACallerInOrder)
+{
+    MockExecutor mockExecutor;
+    const PoolExecutor poolExecutor(mockExecutor, withWorkers(4));
+    std::mutex mutex;
+    std::vector<std::string> executed;
+    std::vector<std::string> submitted;
+
+    EXPECT_CALL(mockExecutor, executeProgram(_))
+        .Times(50)
+        .WillRepeatedly(
+            Invoke([&mutex, &executed](const IExecutor::ProgramParams& params) {
+                std::lock_guard<std::mutex> lock(mutex);
+                executed.emplace_back(params.pathname);
+            }));
+
+    for (int index = 0; index < 50; ++index) {
+        submitted.push_back("/bin/program" + std::to_string(index));
+        poolExecutor.executeProgram({submitted.back().c_str(), nullptr, nullptr});
+    }
+
+    ASSERT_EQ(executed, submitted);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, rethrowExceptionOfTheExecutor)
+{
+    MockExecutor mockExecutor;
+    const PoolExecutor poolExecutor(mockExecutor, withWorkers(1));
+
+    EXPECT_CALL(mockExecutor, executeProgram(_))
+        .WillOnce(Throw(std::runtime_error("Exception")))
+        .WillOnce(Invoke([](const IExecutor::ProgramParams&) {}));
+
+    ASSERT_THROW(poolExecutor.executeProgram({"/bin/false", nullptr, nullptr}),
+                 std::runtime_error);
+
+    // The worker is still usable
+    ASSERT_NO_THROW(poolExecutor.executeProgram({"/bin/true", nullptr, nullptr}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, pinWorkersToTheirCpu)
+{
+    MockExecutor mockExecutor;
+    const PoolExecutor poolExecutor(mockExecutor, withWorkers(2, {0}));
+    std::mutex mutex;
+    std::vector<int> cpus;
+
+    EXPECT_CALL(mockExecutor, executeProgram(_))
+        .Times(10)
+        .WillRepeatedly(Invoke([&mutex, &cpus](const IExecutor::ProgramParams&) {
+            std::lock_guard<std::mutex> lock(mutex);
+            cpus.push_back(sched_getcpu());
+        }));
+
+    for (int index = 0; index < 10; ++index) {
+        poolExecutor.executeProgram({"/bin/true", nullptr, nullptr});
+    }
+
+    ASSERT_EQ(cpus, std::vector<int>(10, 0));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, throwWhenACpuDoesNotExist)
+{
+    MockExecutor mockExecutor;
+
+    ASSERT_THROW(PoolExecutor(mockExecutor, withWorkers(2, {CPU_SETSIZE - 1})),
+                 std::runtime_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, stopMoreWorkersThanTheQueueCanHold)
+{
+    MockExecutor mockExecutor;
+    PoolExecutor::Options options = withWorkers(8);
+    options.queueCapacity         = 1;
+
+    EXPECT_CALL(mockExecutor, executeProgram(_)).Times(1);
+    {
+        const PoolExecutor poolExecutor(mockExecutor, options);
+        poolExecutor.executeProgram({"/bin/true", nullptr, nullptr});
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PoolExecutorTestSuite, executeProgramsOfSeveralTasksConcurrently)
+{
+    MockExecutor mockExecutor;
+    const PoolExecutor poolExecutor(mockExecutor, withWorkers(4));
+    std::vector<FiberScheduler::Task> tasks;
+
+    EXPECT_CALL(mockExecutor, executeProgram(_))
+        .Times(4)
+        .WillRepeatedly(Invoke([](const IExecutor::ProgramParams&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }));
+
+    for (int index = 0; index < 4; ++index) {
+        tasks.emplace_back([&poolExecutor]() {
+            poolExecutor.executeProgram({"/bin/sleep", nullptr, nullptr});
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    FiberScheduler().run(std::move(tasks));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Tasks are suspended while a worker executes their program
+    ASSERT_LT(elapsed, std::chrono::milliseconds(1500));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,109 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <cstdlib>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "mocks/MockOsal.h"
+
+#include "utils/command/executor/osal/CountingOsal.h"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+using namespace utils::command::osal;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CountingOsalTestSuite, countCallsThenDelegateThem)
+{
+    const MockOsal mockOsal;
+    const CountingOsal osal(mockOsal);
+
+    EXPECT_CALL(mockOsal, createProcess())
+        .WillOnce(Return(IOsal::ProcessId::PARENT))
+        .WillOnce(Return(IOsal::ProcessId::CHILD));
+    EXPECT_CALL(mockOsal, waitChildProcess())
+        .WillOnce(Return(IOsal::ResourceUsage {}));
+    EXPECT_CALL(mockOsal, executeProgram(nullptr, nullptr, nullptr));
+    EXPECT_CALL(mockOsal, reseedPRNG());
+    EXPECT_CALL(mockOsal, sanitizeFiles());
+    EXPECT_CALL(mockOsal, dropPrivileges());
+
+    const CountingOsal::Counters start = osal.counters();
+
+    // A fork returns in both processes but is counted once, by the parent
+    ASSERT_EQ(osal.createProcess(), IOsal::ProcessId::PARENT);
+    ASSERT_EQ(osal.createProcess(), IOsal::ProcessId::CHILD);
+    (void)osal.waitChildProcess();
+    osal.executeProgram(nullptr, nullptr, nullptr);
+    osal.reseedPRNG();
+    osal.sanitizeFiles();
+    osal.dropPrivileges();
+
+    const CountingOsal::Counters counters = osal.counters() - start;
+    ASSERT_EQ(counters.forks, 1);
+    ASSERT_EQ(counters.execs, 1);
+    ASSERT_EQ(counters.waits, 1);
+    ASSERT_EQ(counters.closes, 1);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(CountingOsalTestSuite, seeCallsMadeByChildProcesses)
+{
+    const NiceMock<MockOsal> mockOsal;
+    const CountingOsal osal(mockOsal);
+
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        osal.sanitizeFiles();
+        osal.executeProgram(nullptr, nullptr, nullptr);
+        _exit(EXIT_SUCCESS);
+    }
+
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status));
+
+    ASSERT_EQ(osal.counters().execs, 1);
+    ASSERT_EQ(osal.counters().closes, 1);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -95,33 +95,65 @@ TEST_F(LinuxTestFixture, createProcessShouldReturnParentIfForkReturnsZero)
 }
 
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
-TEST_F(LinuxTestFixture, waitChildShouldCallWaitpidSeveralTimesIfInterrupted)
+TEST_F(LinuxTestFixture, waitChildShouldCallWait4SeveralTimesIfInterrupted)
 {
     int gSavedErrno = errno;
-    EXPECT_CALL(m_mockOS, waitpid)
+    EXPECT_CALL(m_mockOS, wait4)
         .WillOnce(SetErrnoAndReturn(EINTR, -1))
         .WillOnce(SetErrnoAndReturn(gSavedErrno, 0));
 
-    m_linux.waitChildProcess();
+    (void)m_linux.waitChildProcess();
 }
 
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
 TEST_F(LinuxTestFixture, waitChildShouldThrowAnExceptionIfChildProcessFails)
 {
     int stat_loc = EXIT_FAILURE;
-    EXPECT_CALL(m_mockOS, waitpid(_, _, _))
+    EXPECT_CALL(m_mockOS, wait4(_, _, _, _))
         .WillOnce(
             DoAll(SetArgPointee<1>(ByRef(stat_loc)), SetErrnoAndReturn(EAGAIN, -1)));
 
     try {
-        m_linux.waitChildProcess();
-        FAIL() << "Should fail because waitpid() has failed";
+        (void)m_linux.waitChildProcess();
+        FAIL() << "Should fail because wait4() has failed";
     }
     catch (const std::runtime_error& e2) {
         // Expected!
     }
 }
 
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST_F(LinuxTestFixture, waitChildShouldReturnResourcesConsumedByChildProcess)
+{
+    struct rusage usage {};
+    usage.ru_utime  = {1, 500};
+    usage.ru_stime  = {0, 250};
+    usage.ru_maxrss = 2048;
+    usage.ru_minflt = 10;
+    usage.ru_majflt = 1;
+    usage.ru_nvcsw  = 3;
+    usage.ru_nivcsw = 4;
+
+    // Only the child created by this thread must be waited for
+    EXPECT_CALL(m_mockOS, fork).WillOnce(Return(42));
+    ASSERT_EQ(m_linux.createProcess(), IOsal::ProcessId::PARENT);
+
+    int stat_loc = 0;
+    EXPECT_CALL(m_mockOS, wait4(42, _, 0, _))
+        .WillOnce(DoAll(SetArgPointee<1>(stat_loc),
+                        SetArgPointee<3>(usage),
+                        Return(1)));
+
+    const IOsal::ResourceUsage result = m_linux.waitChildProcess();
+    EXPECT_EQ(result.userTimeUs, 1000500);
+    EXPECT_EQ(result.systemTimeUs, 250);
+    EXPECT_EQ(result.maxResidentSetKb, 2048);
+    EXPECT_EQ(result.minorPageFaults, 10);
+    EXPECT_EQ(result.majorPageFaults, 1);
+    EXPECT_EQ(result.voluntaryContextSwitches, 3);
+    EXPECT_EQ(result.involuntaryContextSwitches, 4);
+}
+
 // NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
 TEST_F(LinuxTestFixture, shouldThrowAnExceptionIfExecuteProgramFails)
 {
@@ -33,6 +33,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <grp.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -82,6 +83,9 @@ public:
                 (const char* __restrict filename, const char* modes, FILE* stream));
     MOCK_METHOD(int, fileno, (FILE * stream));
     MOCK_METHOD(pid_t, waitpid, (pid_t pid, int* stat_loc, int options));
+    MOCK_METHOD(pid_t,
+                wait4,
+                (pid_t pid, int* stat_loc, int options, struct rusage* usage));
     MOCK_METHOD(int, clock_gettime, (clockid_t clock_id, struct timespec* tp));
     MOCK_METHOD(void, srand, (unsigned int seed));
     MOCK_METHOD(int, fstat, (int fd, struct stat* buf));
@@ -148,6 +148,12 @@ pid_t waitpid(pid_t pid, int* stat_loc, int options)
     return gMockOS->waitpid(pid, stat_loc, options);
 }
 
+pid_t wait4(pid_t pid, int* stat_loc, int options, struct rusage* usage)
+{
+    RETURN_IF_NOT_IN_TESTCASE(-1);
+    return gMockOS->wait4(pid, stat_loc, options, usage);
+}
+
 int clock_gettime(clockid_t clock_id, struct timespec* tp)
 {
     RETURN_IF_NOT_IN_TESTCASE(-1);
@@ -0,0 +1,221 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#include "utils/command/executor/osal/Linux.h"
+#include "utils/concurrency/FiberScheduler.h"
+
+using namespace utils::command;
+using namespace utils::command::osal;
+using namespace utils::concurrency;
+
+namespace {
+
+/* A pipe closed when leaving the scope */
+class Pipe {
+
+public:
+    Pipe()
+    {
+        if (pipe(m_fds.data()) == -1) {
+            throw std::runtime_error("pipe() failed");
+        }
+    }
+
+    ~Pipe()
+    {
+        (void)close(m_fds[0]);
+        (void)close(m_fds[1]);
+    }
+
+    Pipe(const Pipe&) = delete;
+    Pipe& operator=(const Pipe&) = delete;
+    Pipe(Pipe&&)                 = delete;
+    Pipe& operator=(Pipe&&) = delete;
+
+    [[nodiscard]] int readEnd() const { return m_fds[0]; }
+
+    void signal() const { ASSERT_EQ(write(m_fds[1], "x", 1), 1); }
+
+private:
+    std::array<int, 2> m_fds {};
+};
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, roundStackSizeUpToPages)
+{
+    const auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    ASSERT_EQ(FiberScheduler(1).stackSize(), pageSize);
+    ASSERT_EQ(FiberScheduler(pageSize + 1).stackSize(), 2 * pageSize);
+    ASSERT_EQ(FiberScheduler().stackSize(), FiberScheduler::DEFAULT_STACK_SIZE);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, runTasksInOrderOnTheCallingThread)
+{
+    const std::thread::id callerId = std::this_thread::get_id();
+    std::string order;
+    std::vector<FiberScheduler::Task> tasks;
+
+    for (char name = 'a'; name <= 'e'; ++name) {
+        tasks.emplace_back([&order, &callerId, name]() {
+            ASSERT_TRUE(FiberScheduler::isInFiber());
+            ASSERT_EQ(std::this_thread::get_id(), callerId);
+            order += name;
+        });
+    }
+
+    ASSERT_FALSE(FiberScheduler::isInFiber());
+    FiberScheduler().run(std::move(tasks));
+
+    ASSERT_EQ(order, "abcde");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, runOtherTasksWhileOneIsWaiting)
+{
+    const Pipe first;
+    const Pipe second;
+    std::string order;
+
+    FiberScheduler().run({[&]() {
+                              order += "1";
+                              FiberScheduler::awaitReadable(first.readEnd());
+                              order += "3";
+                              second.signal();
+                          },
+                          [&]() {
+                              order += "2";
+                              first.signal();
+                              FiberScheduler::awaitReadable(second.readEnd());
+                              order += "4";
+                          }});
+
+    ASSERT_EQ(order, "1234");
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, callTheResumeHookEachTimeATaskIsResumed)
+{
+    const Pipe pipe;
+    int nbResumes = 0;
+
+    auto countResumes = [&nbResumes]() { ++nbResumes; };
+
+    FiberScheduler().run({[&]() {
+                              FiberScheduler::onResume(countResumes);
+                              FiberScheduler::awaitReadable(pipe.readEnd());
+                              ASSERT_EQ(nbResumes, 1);
+                          },
+                          [&]() { pipe.signal(); }});
+
+    ASSERT_EQ(nbResumes, 1);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, rethrowTheFirstExceptionOnceAllTasksAreCompleted)
+{
+    const Pipe pipe;
+    bool isCompleted = false;
+
+    ASSERT_THROW(FiberScheduler().run(
+                     {[&pipe]() {
+                          FiberScheduler::awaitReadable(pipe.readEnd());
+                          throw std::logic_error("second");
+                      },
+                      [&pipe]() {
+                          pipe.signal();
+                          throw std::runtime_error("first");
+                      },
+                      [&isCompleted]() { isCompleted = true; }}),
+                 std::runtime_error);
+
+    ASSERT_TRUE(isCompleted);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, blockOutsideTasks)
+{
+    const Pipe pipe;
+    pipe.signal();
+
+    ASSERT_NO_THROW(FiberScheduler::awaitReadable(pipe.readEnd()));
+    ASSERT_THROW(FiberScheduler::onResume(nullptr), std::logic_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, refuseToRunFromATask)
+{
+    ASSERT_THROW(FiberScheduler().run(
+                     {[]() { FiberScheduler().run({[]() {}}); }}),
+                 std::logic_error);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(FiberSchedulerTestSuite, waitForChildProcessesWithoutBlockingTheThread)
+{
+    constexpr std::size_t nbTasks = 4;
+    const Linux osal;
+    std::vector<FiberScheduler::Task> tasks;
+
+    for (std::size_t index = 0; index < nbTasks; ++index) {
+        tasks.emplace_back([&osal]() {
+            if (osal.createProcess() == IOsal::ProcessId::CHILD) {
+                std::array<char*, 3> argv = {const_cast<char*>("sleep"),
+                                             const_cast<char*>("0.5"),
+                                             nullptr};
+                osal.executeProgram("/bin/sleep", argv.data(), nullptr);
+            }
+            (void)osal.waitChildProcess();
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    FiberScheduler().run(std::move(tasks));
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // All children sleep at the same time
+    ASSERT_LT(elapsed, std::chrono::milliseconds(1500));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,146 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/concurrency/MpmcQueue.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(MpmcQueueTestSuite, roundCapacityUpToPowerOfTwo)
+{
+    ASSERT_EQ(MpmcQueue<int>(0).capacity(), 2u);
+    ASSERT_EQ(MpmcQueue<int>(2).capacity(), 2u);
+    ASSERT_EQ(MpmcQueue<int>(5).capacity(), 8u);
+    ASSERT_EQ(MpmcQueue<int>(256).capacity(), 256u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(MpmcQueueTestSuite, popElementsInPushOrder)
+{
+    MpmcQueue<int> queue(4);
+    int value = 0;
+
+    /* Several laps of the ring */
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int index = 0; index < 3; ++index) {
+            ASSERT_TRUE(queue.tryPush(lap * 10 + index));
+        }
+        for (int index = 0; index < 3; ++index) {
+            ASSERT_TRUE(queue.tryPop(value));
+            ASSERT_EQ(value, lap * 10 + index);
+        }
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(MpmcQueueTestSuite, failToPushWhenFullAndToPopWhenEmpty)
+{
+    MpmcQueue<int> queue(2);
+    int value = 0;
+
+    ASSERT_FALSE(queue.tryPop(value));
+
+    ASSERT_TRUE(queue.tryPush(1));
+    ASSERT_TRUE(queue.tryPush(2));
+    ASSERT_FALSE(queue.tryPush(3));
+
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(queue.tryPush(3));
+
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_TRUE(queue.tryPop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_FALSE(queue.tryPop(value));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(MpmcQueueTestSuite, popEachElementOnceWithConcurrentProducersAndConsumers)
+{
+    constexpr std::size_t nbThreads  = 4;
+    constexpr std::size_t nbElements = 20000;
+
+    MpmcQueue<std::size_t> queue(16);
+    std::vector<std::vector<std::size_t>> popped(nbThreads);
+    std::vector<std::thread> threads;
+
+    for (std::size_t thread = 0; thread < nbThreads; ++thread) {
+        threads.emplace_back([&queue, thread]() {
+            for (std::size_t value = thread; value < nbElements;
+                 value += nbThreads) {
+                while (!queue.tryPush(std::size_t {value})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        threads.emplace_back([&queue, &popped, thread]() {
+            std::size_t value = 0;
+            while (popped[thread].size() < nbElements / nbThreads) {
+                if (queue.tryPop(value)) {
+                    popped[thread].push_back(value);
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> nbPops(nbElements, 0);
+    for (const std::vector<std::size_t>& values : popped) {
+        for (const std::size_t value : values) {
+            ASSERT_LT(value, nbElements);
+            ++nbPops[value];
+        }
+    }
+
+    for (const int count : nbPops) {
+        ASSERT_EQ(count, 1);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/concurrency/Pipeline.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, handleZeroCapacityAsOne)
+{
+    ASSERT_EQ(Pipeline(0).capacity(), 1u);
+    ASSERT_EQ(Pipeline(8).capacity(), 8u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, doNothingWithoutTask)
+{
+    const Pipeline pipeline(4);
+
+    ASSERT_NO_THROW(pipeline.run([](const Pipeline::Submit& /*submit*/) {}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, runTasksInOrderOnTheCallingThread)
+{
+    constexpr int nbTasks = 100;
+    std::vector<int> order;
+    std::vector<std::thread::id> threadIds;
+
+    Pipeline(4).run([&order, &threadIds](const Pipeline::Submit& submit) {
+        for (int index = 0; index < nbTasks; ++index) {
+            submit([&order, &threadIds, index]() {
+                order.push_back(index);
+                threadIds.push_back(std::this_thread::get_id());
+            });
+        }
+    });
+
+    ASSERT_EQ(order.size(), static_cast<std::size_t>(nbTasks));
+    for (int index = 0; index < nbTasks; ++index) {
+        ASSERT_EQ(order[static_cast<std::size_t>(index)], index);
+        ASSERT_EQ(threadIds[static_cast<std::size_t>(index)],
+                  std::this_thread::get_id());
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, neverLetTheProducerGetMoreThanCapacityTasksAhead)
+{
+    constexpr std::size_t capacity = 2;
+    constexpr int nbTasks          = 50;
+    std::atomic<std::size_t> nbSubmitted(0);
+    std::size_t nbCompleted = 0;
+    std::size_t maxAhead    = 0;
+
+    const Pipeline pipeline(capacity);
+    pipeline.run([&](const Pipeline::Submit& submit) {
+        for (int index = 0; index < nbTasks; ++index) {
+            submit([&]() {
+                // Give the producer time to fill the queue
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+                maxAhead = std::max(maxAhead, nbSubmitted - nbCompleted);
+                ++nbCompleted;
+            });
+            ++nbSubmitted;
+        }
+    });
+
+    ASSERT_EQ(nbCompleted, static_cast<std::size_t>(nbTasks));
+
+    // The running task plus the ones waiting in the queue
+    ASSERT_LE(maxAhead, capacity + 1);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, stopTheProducerAndRethrowWhenATaskFails)
+{
+    std::atomic<int> nbSubmitted(0);
+    int nbRun = 0;
+
+    try {
+        Pipeline(1).run([&nbSubmitted, &nbRun](const Pipeline::Submit& submit) {
+            // Would never end if submitting did not fail once cancelled
+            for (;;) {
+                submit([&nbRun]() {
+                    if (++nbRun == 3) {
+                        throw std::runtime_error("task");
+                    }
+                });
+                ++nbSubmitted;
+            }
+        });
+        FAIL() << "Should fail because a task has failed";
+    }
+    catch (const std::runtime_error& e) {
+        ASSERT_STREQ(e.what(), "task");
+    }
+
+    ASSERT_EQ(nbRun, 3);
+    ASSERT_LE(nbSubmitted.load(), 5);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PipelineTestSuite, runSubmittedTasksThenRethrowWhenTheProducerFails)
+{
+    int nbRun = 0;
+
+    try {
+        Pipeline(4).run([&nbRun](const Pipeline::Submit& submit) {
+            submit([&nbRun]() { ++nbRun; });
+            submit([&nbRun]() { ++nbRun; });
+            throw std::invalid_argument("producer");
+        });
+        FAIL() << "Should fail because the producer has failed";
+    }
+    catch (const std::invalid_argument& e) {
+        ASSERT_STREQ(e.what(), "producer");
+    }
+
+    ASSERT_EQ(nbRun, 2);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
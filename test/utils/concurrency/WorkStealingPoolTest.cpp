@@ -0,0 +1,171 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "utils/concurrency/WorkStealingPool.h"
+
+using namespace utils::concurrency;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, useAsManyWorkersAsCpusByDefault)
+{
+    const WorkStealingPool pool;
+
+    ASSERT_GE(pool.nbWorkers(), 1u);
+    if (std::thread::hardware_concurrency() != 0) {
+        ASSERT_EQ(pool.nbWorkers(), std::thread::hardware_concurrency());
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, doNothingWithoutTask)
+{
+    const WorkStealingPool pool(4);
+
+    ASSERT_NO_THROW(pool.run({}));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, runEachTaskExactlyOnce)
+{
+    constexpr std::size_t nbTasks = 100;
+    std::vector<std::atomic<int>> counters(nbTasks);
+    std::vector<WorkStealingPool::Task> tasks;
+
+    for (std::size_t index = 0; index < nbTasks; ++index) {
+        tasks.emplace_back([&counters, index]() { ++counters[index]; });
+    }
+
+    WorkStealingPool(4).run(std::move(tasks));
+
+    for (const std::atomic<int>& counter : counters) {
+        ASSERT_EQ(counter, 1);
+    }
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, neverUseMoreWorkersThanTasks)
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    std::vector<WorkStealingPool::Task> tasks;
+
+    for (int index = 0; index < 2; ++index) {
+        tasks.emplace_back([&mutex, &threadIds]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            threadIds.insert(std::this_thread::get_id());
+        });
+    }
+
+    WorkStealingPool(8).run(std::move(tasks));
+
+    ASSERT_GE(threadIds.size(), 1u);
+    ASSERT_LE(threadIds.size(), 2u);
+    ASSERT_EQ(threadIds.count(std::this_thread::get_id()), 0u);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, idleWorkersStealTasksFromBusyOnes)
+{
+    // Tasks are spread round-robin and a worker runs its most recent task
+    // first so worker 0 starts with the slow task (index 8). The other tasks
+    // wait for it to start and it waits for all of them to be done: worker 0
+    // stays busy with it so worker 1 must steal tasks 0, 2, 4 and 6
+    constexpr std::size_t nbTasks   = 10;
+    constexpr std::size_t slowIndex = 8;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool isSlowTaskStarted      = false;
+    std::size_t nbFastTasksDone = 0;
+    std::vector<std::thread::id> threadIds(nbTasks);
+    std::vector<WorkStealingPool::Task> tasks;
+
+    for (std::size_t index = 0; index < nbTasks; ++index) {
+        tasks.emplace_back([&, index]() {
+            std::unique_lock<std::mutex> lock(mutex);
+            threadIds[index] = std::this_thread::get_id();
+
+            if (index == slowIndex) {
+                isSlowTaskStarted = true;
+                condition.notify_all();
+                condition.wait(lock, [&]() {
+                    return nbFastTasksDone == nbTasks - 1;
+                });
+                return;
+            }
+
+            condition.wait(lock, [&]() { return isSlowTaskStarted; });
+            ++nbFastTasksDone;
+            condition.notify_all();
+        });
+    }
+
+    WorkStealingPool(2).run(std::move(tasks));
+
+    for (std::size_t index = 0; index < nbTasks; ++index) {
+        if (index != slowIndex) {
+            ASSERT_EQ(threadIds[index], threadIds[1]) << "Task " << index;
+        }
+    }
+    ASSERT_NE(threadIds[slowIndex], threadIds[1]);
+    ASSERT_NE(threadIds[slowIndex], std::this_thread::get_id());
+    ASSERT_NE(threadIds[1], std::this_thread::get_id());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(WorkStealingPoolTestSuite, rethrowFirstExceptionOnceAllTasksAreDone)
+{
+    std::atomic<int> nbTasksDone(0);
+    std::vector<WorkStealingPool::Task> tasks;
+
+    tasks.emplace_back([]() { throw std::runtime_error("Exception"); });
+    for (int index = 0; index < 10; ++index) {
+        tasks.emplace_back([&nbTasksDone]() { ++nbTasksDone; });
+    }
+
+    ASSERT_THROW(WorkStealingPool(3).run(std::move(tasks)), std::runtime_error);
+    ASSERT_EQ(nbTasksDone, 10);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
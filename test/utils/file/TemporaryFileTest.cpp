@@ -0,0 +1,92 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <sys/stat.h>
+
+#include "gtest/gtest.h"
+
+#include "utils/file/temporary/TemporaryFile.h"
+
+using namespace utils::file;
+
+namespace {
+
+bool exists(const std::string& pathname)
+{
+    struct stat status {};
+    return stat(pathname.c_str(), &status) == 0;
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TemporaryFileTestSuite, createAnEmptyFileInTheGivenDirectory)
+{
+    const TemporaryFile file(".");
+
+    ASSERT_EQ(file.pathname().rfind("./networkservice-", 0), 0u);
+    ASSERT_TRUE(exists(file.pathname()));
+
+    std::ifstream stream(file.pathname());
+    ASSERT_EQ(stream.peek(), std::ifstream::traits_type::eof());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TemporaryFileTestSuite, giveEachFileAUniqueName)
+{
+    const TemporaryFile first;
+    const TemporaryFile second;
+
+    ASSERT_NE(first.pathname(), second.pathname());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TemporaryFileTestSuite, removeTheFileWhenDestroyed)
+{
+    auto file                  = std::make_unique<TemporaryFile>();
+    const std::string pathname = file->pathname();
+
+    file.reset();
+
+    ASSERT_FALSE(exists(pathname));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(TemporaryFileTestSuite, raiseExceptionIfDirectoryDoesNotExist)
+{
+    ASSERT_THROW(TemporaryFile("/does/not/exist"), std::runtime_error);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,75 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/helper/AllocationCounter.h"
+
+using namespace utils::helper;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AllocationCounterTestSuite, countEachAllocation)
+{
+    constexpr std::size_t NB_ALLOCATIONS = 10;
+
+    std::vector<std::unique_ptr<std::size_t>> pointers;
+    pointers.reserve(NB_ALLOCATIONS);
+
+    const std::size_t start = AllocationCounter::count();
+    for (std::size_t index = 0; index < NB_ALLOCATIONS; ++index) {
+        pointers.push_back(std::make_unique<std::size_t>(index));
+    }
+    const std::size_t end = AllocationCounter::count();
+
+    ASSERT_EQ(end - start, NB_ALLOCATIONS);
+    ASSERT_EQ(*pointers.back(), NB_ALLOCATIONS - 1);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(AllocationCounterTestSuite, doNotCountDeallocations)
+{
+    auto pointer = std::make_unique<int>(0);
+
+    const std::size_t start = AllocationCounter::count();
+    pointer.reset();
+
+    ASSERT_EQ(AllocationCounter::count(), start);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
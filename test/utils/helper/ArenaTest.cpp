@@ -0,0 +1,107 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "utils/helper/AllocationCounter.h"
+#include "utils/helper/Arena.h"
+
+using namespace utils::helper;
+
+namespace {
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ArenaTestSuite, serveAllocationsWithoutHittingTheHeap)
+{
+    const Arena arena(1024);
+
+    const std::size_t start = AllocationCounter::count();
+    for (int index = 0; index < 16; ++index) {
+        void* pointer = arena.resource()->allocate(64, alignof(std::max_align_t));
+        ASSERT_NE(pointer, nullptr);
+        arena.resource()->deallocate(pointer, 64, alignof(std::max_align_t));
+    }
+
+    ASSERT_EQ(AllocationCounter::count(), start);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ArenaTestSuite, growWhenTheBufferIsExhausted)
+{
+    const Arena arena(16);
+
+    void* first  = arena.resource()->allocate(16, 1);
+    void* second = arena.resource()->allocate(64, 1);
+
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_NE(first, second);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ArenaTestSuite, makeTheArenaCurrentUntilTheEndOfTheScope)
+{
+    const Arena outerArena(16);
+    const Arena innerArena(16);
+
+    ASSERT_EQ(Arena::current(), std::pmr::get_default_resource());
+    {
+        const Arena::Scope outerScope(outerArena);
+        ASSERT_EQ(Arena::current(), outerArena.resource());
+        {
+            const Arena::Scope innerScope(innerArena);
+            ASSERT_EQ(Arena::current(), innerArena.resource());
+        }
+        ASSERT_EQ(Arena::current(), outerArena.resource());
+    }
+    ASSERT_EQ(Arena::current(), std::pmr::get_default_resource());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(ArenaTestSuite, makeTheArenaCurrentForTheCallingThreadOnly)
+{
+    const Arena arena(16);
+    const Arena::Scope scope(arena);
+
+    std::pmr::memory_resource* otherThreadResource = nullptr;
+    std::thread([&otherThreadResource]() {
+        otherThreadResource = Arena::current();
+    }).join();
+
+    ASSERT_EQ(otherThreadResource, std::pmr::get_default_resource());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+//                                                                                //
+// MIT License                                                                    //
+//                                                                                //
+// Copyright (c) 2020 Boubacar DIENE                                              //
+//                                                                                //
+// This file is part of NetworkService project                                    //
+//                                                                                //
+// Permission is hereby granted, free of charge, to any person obtaining a copy   //
+// of this software and associated documentation files (the "Software"), to deal  //
+// in the Software without restriction, including without limitation the rights   //
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell      //
+// copies of the Software, and to permit persons to whom the Software is          //
+// furnished to do so, subject to the following conditions:                       //
+//                                                                                //
+// The above copyright notice and this permission notice shall be included in all //
+// copies or substantial portions of the Software.                                //
+//                                                                                //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR     //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,       //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE    //
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER         //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,  //
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE  //
+// SOFTWARE.                                                                      //
+//                                                                                //
+//\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/helper/PerfCounters.h"
+
+using ::testing::HasSubstr;
+
+using namespace utils::helper;
+
+namespace {
+
+constexpr std::int64_t NA = PerfCounters::NOT_AVAILABLE;
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PerfCountersTestSuite, addSamplesFieldByField)
+{
+    PerfCounters::Sample total {1, 2, 3, 4, 5};
+    total += {10, 20, 30, 40, 50};
+
+    EXPECT_EQ(total.cycles, 11);
+    EXPECT_EQ(total.instructions, 22);
+    EXPECT_EQ(total.contextSwitches, 33);
+    EXPECT_EQ(total.pageFaults, 44);
+    EXPECT_EQ(total.cpuMigrations, 55);
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PerfCountersTestSuite, unavailableCountersStayUnavailableWhenAdded)
+{
+    PerfCounters::Sample total {NA, 2, 3, 4, 5};
+    total += {10, NA, 30, 40, 50};
+
+    EXPECT_EQ(total.cycles, NA);
+    EXPECT_EQ(total.instructions, NA);
+    EXPECT_EQ(total.contextSwitches, 33);
+    EXPECT_TRUE(total.isAvailable());
+
+    const PerfCounters::Sample none {NA, NA, NA, NA, NA};
+    EXPECT_FALSE(none.isAvailable());
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PerfCountersTestSuite, printUnavailableCountersAsNotApplicable)
+{
+    const std::string result = PerfCounters::Sample {NA, 2, 3, 4, 5}.toString();
+
+    EXPECT_THAT(result, HasSubstr("cycles n/a"));
+    EXPECT_THAT(result, HasSubstr("instructions 2"));
+    EXPECT_THAT(result, HasSubstr("cpu migrations 5"));
+}
+
+// NOLINTNEXTLINE(cert-err58-cpp, hicpp-special-member-functions)
+TEST(PerfCountersTestSuite, degradeGracefullyWhenPerfEventsAreNotAllowed)
+{
+    // Whether perf events are allowed depends on the host running the test
+    const PerfCounters counters;
+
+    counters.start();
+    const PerfCounters::Sample sample = counters.stop();
+
+    EXPECT_EQ(sample.isAvailable(), counters.isAvailable());
+    for (std::int64_t value : {sample.cycles,
+                               sample.instructions,
+                               sample.contextSwitches,
+                               sample.pageFaults,
+                               sample.cpuMigrations}) {
+        EXPECT_GE(value, NA);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}